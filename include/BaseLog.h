@@ -9,13 +9,16 @@
 #endif //_WIN32
 
 #include <stdio.h>
+#include <stdarg.h>
 #include <string.h>
 #include <time.h> //<ctime>
 
 #ifdef __linux__
 #include <sys/time.h> // struct timeval & gettimeofday()
 #include <semaphore.h>	/* semaphore */
+#include <pthread.h>	/* pthread */
 #include <syslog.h>     /* syslog */
+#include "ElanTsLogUtility.h" /* ELAN_LOG_LEVEL */
 
 #else // _WIN32
 #include <sys_win32/time.h> // struct timeval & gettimeofday()
@@ -47,6 +50,15 @@
 #define DEFAULT_TEST_RESULT_LOG_FILE    ""
 #endif //__ENABLE_SYSLOG_DEBUG__
 
+// Log Sink (Log File / syslog) Compiled in; without Sink, Log Records are Compiled out
+#if defined(__ENABLE_LOG_FILE_DEBUG__) || defined(__ENABLE_SYSLOG_DEBUG__)
+#define LOG_SINK_ENABLED	1
+#else
+#define LOG_SINK_ENABLED	0
+#define DEFAULT_DEBUG_LOG_DIR   ""
+#define DEFAULT_DEBUG_LOG_FILE  ""
+#endif //defined(__ENABLE_LOG_FILE_DEBUG__) || defined(__ENABLE_SYSLOG_DEBUG__)
+
 #ifndef LOG_BUF_SIZE
 #define LOG_BUF_SIZE 4096
 #endif //LOG_BUF_SIZE
@@ -55,6 +67,38 @@
 #define PATH_LEN_MAX 512
 #endif //LOG_BUF_SIZE
 
+// Asynchronous Log File Writer (Linux & Log File Only)
+#if defined(__ENABLE_ASYNC_LOG__) && (!defined(__linux__) || !defined(__ENABLE_LOG_FILE_DEBUG__))
+#undef __ENABLE_ASYNC_LOG__
+#endif //defined(__ENABLE_ASYNC_LOG__) && (!defined(__linux__) || !defined(__ENABLE_LOG_FILE_DEBUG__))
+
+#ifdef __ENABLE_ASYNC_LOG__
+// Lines Buffered in Ring (Power of 2)
+#ifndef ASYNC_LOG_RING_SLOTS
+#define ASYNC_LOG_RING_SLOTS 256
+#endif //ASYNC_LOG_RING_SLOTS
+
+// Max. Length of One Line in Ring (Longer Line Truncated)
+#ifndef ASYNC_LOG_LINE_MAX
+#define ASYNC_LOG_LINE_MAX 1024
+#endif //ASYNC_LOG_LINE_MAX
+
+// Max. Bytes per write() of Log Writer Thread
+#ifndef ASYNC_LOG_BATCH_SIZE
+#define ASYNC_LOG_BATCH_SIZE 65536
+#endif //ASYNC_LOG_BATCH_SIZE
+
+// Time Log Writer Thread Sleeps when Ring is Empty
+#ifndef ASYNC_LOG_IDLE_WAIT_MSEC
+#define ASYNC_LOG_IDLE_WAIT_MSEC 100
+#endif //ASYNC_LOG_IDLE_WAIT_MSEC
+
+// Max. Time Fatal Signal Handler Waits for Writer Thread to Finish Its Batch
+#ifndef ASYNC_LOG_EMERGENCY_WAIT_MSEC
+#define ASYNC_LOG_EMERGENCY_WAIT_MSEC 500
+#endif //ASYNC_LOG_EMERGENCY_WAIT_MSEC
+#endif //__ENABLE_ASYNC_LOG__
+
 //////////////////////////////////////////////////////////////////////
 // Global Variable
 //////////////////////////////////////////////////////////////////////
@@ -68,27 +112,32 @@ extern bool g_bEnableErrorMsg;
 //////////////////////////////////////////////////////////////////////
 
 #ifdef __linux__
-#define DEBUG(format, args...) if(g_bEnableDebug)    DebugLogFormat(format, ##args)
-#define   DBG(format, args...) if(g_bEnableDebug)    DebugLogFormat(format, ##args)
+// Level Checked at Compile Time, Sink Flag at Run Time, both before Arguments are Formatted
+#define DEBUG(format, args...) if(ELAN_LOG_ENABLED(ELAN_LOG_LEVEL_DEBUG, LOG_SINK_ENABLED && g_bEnableDebug))    DebugLogFormat(format, ##args)
+#define   DBG(format, args...) if(ELAN_LOG_ENABLED(ELAN_LOG_LEVEL_DEBUG, LOG_SINK_ENABLED && g_bEnableDebug))    DebugLogFormat(format, ##args)
+#define TRACE(format, args...) if(ELAN_LOG_ENABLED(ELAN_LOG_LEVEL_TRACE, LOG_SINK_ENABLED && g_bEnableDebug))    DebugLogFormat(format, ##args)
 
 #define ERROR(format, args...) \
 do{\
-   printf("[ERROR] " format "\r\n", ##args); \
-   if(g_bEnableErrorMsg) \
+   if(ELAN_LOG_COMPILED(ELAN_LOG_LEVEL_ERROR)) \
+      printf("[ERROR] " format "\r\n", ##args); \
+   if(ELAN_LOG_ENABLED(ELAN_LOG_LEVEL_ERROR, LOG_SINK_ENABLED && g_bEnableErrorMsg)) \
       ErrorLogFormat(format, ##args); \
 }while(0)
 
 #define ERR(format, args...) \
 do{\
-   printf("[ERR] " format "\r\n", ##args); \
-   if(g_bEnableErrorMsg) \
+   if(ELAN_LOG_COMPILED(ELAN_LOG_LEVEL_ERROR)) \
+      printf("[ERR] " format "\r\n", ##args); \
+   if(ELAN_LOG_ENABLED(ELAN_LOG_LEVEL_ERROR, LOG_SINK_ENABLED && g_bEnableErrorMsg)) \
       ErrorLogFormat(format, ##args); \
 }while(0)
 
 #define INFO(format, args...) \
 do{\
-   printf("[INFO] " format "\r\n", ##args); \
-   if(g_bEnableDebug) \
+   if(ELAN_LOG_COMPILED(ELAN_LOG_LEVEL_INFO)) \
+      printf("[INFO] " format "\r\n", ##args); \
+   if(ELAN_LOG_ENABLED(ELAN_LOG_LEVEL_INFO, LOG_SINK_ENABLED && g_bEnableDebug)) \
       DebugLogFormat(format, ##args); \
 }while(0)
 #else // _WIN32
@@ -119,6 +168,20 @@ do{\
 }while(0)
 #endif // __linux__
 
+//////////////////////////////////////////////////////////////////////
+// Data Structure
+//////////////////////////////////////////////////////////////////////
+
+#ifdef __ENABLE_ASYNC_LOG__
+// One Line in Ring (Bounded MPSC Queue: nSequence Tells Whether Slot is Free or Ready)
+typedef struct async_log_slot
+{
+    volatile unsigned long nSequence;
+    int nLen;
+    char szLine[ASYNC_LOG_LINE_MAX];
+} ASYNC_LOG_SLOT, *PASYNC_LOG_SLOT;
+#endif //__ENABLE_ASYNC_LOG__
+
 //////////////////////////////////////////////////////////////////////
 // Prototype
 //////////////////////////////////////////////////////////////////////
@@ -140,6 +203,13 @@ public:
     void DebugPrintBuffer(unsigned char *pbyBuf, int nLen);
     void DebugPrintBuffer(const char *pszBufName, unsigned char *pbyBuf, int nLen);
 
+    // Wait until Buffered Lines Written to Log File (Writer Shared by All Loggers)
+    static void Flush(void);
+#ifdef __ENABLE_ASYNC_LOG__
+    // Write Buffered Lines from Signal Handler (Async-Signal-Safe)
+    static void EmergencyFlush(void);
+#endif //__ENABLE_ASYNC_LOG__
+
 #ifdef __ENABLE_LOG_FILE_DEBUG__
     // File Operation
     int CleanFileContentWithPath(const char *pszFilePath);
@@ -187,6 +257,22 @@ protected:
     CRITICAL_SECTION m_csFileIoMutex;
 #endif //__linux__
     int m_nFileIoLockCounter;
+
+#ifdef __ENABLE_ASYNC_LOG__
+    // Asynchronous Log Writer (Ring & Writer Thread Shared by All Loggers in Process)
+    int AsyncLogStart(void);
+    void AsyncLogStop(void);
+    void AsyncLogSetFilePath(void);
+    static PASYNC_LOG_SLOT AsyncLogAcquireSlot(unsigned long *pnPosition);
+    static void AsyncLogPublishSlot(PASYNC_LOG_SLOT pSlot, unsigned long nPosition);
+    int AsyncLogFormatTimestamp(char *pszBuf, int nSize, const char *pszLevel);
+    void AsyncLogFormatV(const char *pszLevel, const char *pszFormat, va_list pArgs);
+    void AsyncLogFormat(const char *pszLevel, const char *pszFormat, ...);
+    void AsyncLogBuffer(const char *pszBufName, unsigned char *pbyBuf, int nLen);
+    static int AsyncLogOpenFile(void);
+    static int AsyncLogWriteBatch(void);
+    static void *AsyncLogWriterRoutine(void *pParam);
+#endif //__ENABLE_ASYNC_LOG__
 }; //CBaseLog
 
 #endif //ndef __BASELOG_H__
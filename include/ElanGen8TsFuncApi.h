@@ -33,6 +33,11 @@
 #define	ELAN_GEN8_INFO_ROM_FWID_MEMORY_ADDR	    0x40000
 #endif //ELAN_GEN8_INFO_ROM_FWID_MEMORY_ADDR
 
+// Max. Read ROM Data Commands in Flight of ROM Byte Stream Read
+#ifndef ELAN_GEN8_ROM_READ_PIPELINE_DEPTH
+#define ELAN_GEN8_ROM_READ_PIPELINE_DEPTH	8
+#endif //ELAN_GEN8_ROM_READ_PIPELINE_DEPTH
+
 /***************************************************
  * Macros
  ***************************************************/
@@ -70,6 +75,7 @@
 
 // ROM Data
 int gen8_get_rom_data(unsigned int addr, unsigned char data_len, unsigned int *p_data);
+int gen8_read_rom_bytes(unsigned int addr, unsigned char *p_buf, unsigned int len, bool recovery);
 
 // Information FWID
 int gen8_read_info_fwid(unsigned short *p_info_fwid, bool recovery);
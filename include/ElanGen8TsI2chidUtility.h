@@ -20,6 +20,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include "ElanTsLogUtility.h"
 
 /***************************************************
  * Definitions
@@ -33,17 +34,6 @@
  * Global Variables Declaration
  ***************************************************/
 
-// Debug
-extern bool g_debug;
-
-#ifndef DEBUG_PRINTF
-#define DEBUG_PRINTF(fmt, argv...) if(g_debug) printf(fmt, ##argv)
-#endif //DEBUG_PRINTF
-
-#ifndef ERROR_PRINTF
-#define ERROR_PRINTF(fmt, argv...) fprintf(stderr, fmt, ##argv)
-#endif //ERROR_PRINTF
-
 /***************************************************
  * Extern Variables Declaration
  ***************************************************/
@@ -54,9 +44,17 @@ extern int write_cmd(unsigned char *cmd_buf, int len, int timeout_ms);
 // Read Data
 extern int read_data(unsigned char *data_buf, int len, int timeout_ms);
 
+// Write Command (Keep Pending Replies, for Pipelined Commands)
+extern int write_pipelined_cmd(unsigned char *cmd_buf, int len, int timeout_ms);
+
 // Write Vendor Command
 extern int write_vendor_cmd(unsigned char *cmd_buf, int len, int timeout_ms);
 
+// Read Deadline (Shared Time Budget of Multi-Frame Read) & Latency
+extern int set_read_deadline(int timeout_ms);
+extern int clear_read_deadline(void);
+extern int get_last_read_latency(unsigned long long *p_latency_us);
+
 // HID Raw I/O
 extern int __hidraw_write(unsigned char* buf, int len, int timeout_ms);
 extern int __hidraw_read(unsigned char* buf, int len, int timeout_ms);
@@ -67,7 +65,9 @@ extern int __hidraw_read(unsigned char* buf, int len, int timeout_ms);
 
 // ROM Data
 int gen8_send_read_rom_data_command(unsigned int addr, unsigned char data_len);
+int gen8_send_pipelined_read_rom_data_command(unsigned int addr, unsigned char data_len);
 int gen8_receive_rom_data(unsigned int *p_rom_data);
+int gen8_receive_addressed_rom_data(unsigned int *p_addr, unsigned char *p_data_len, unsigned int *p_rom_data);
 
 // IAP Mode
 int send_gen8_write_flash_key_command(void);
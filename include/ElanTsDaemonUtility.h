@@ -0,0 +1,85 @@
+/** @file
+
+  Header of Daemon Utility (Unix Domain Socket Query Service) for Elan I2C-HID Touchscreen.
+
+  Copyright (c) ELAN microelectronics corp. 2022, All Rights Reserved
+
+  Module Name:
+	ElanTsDaemonUtility.h
+
+  Environment:
+	All kinds of Linux-like Platform.
+
+********************************************************************
+ Revision History
+
+**/
+
+#ifndef _ELAN_TS_DAEMON_UTILITY_H_
+#define _ELAN_TS_DAEMON_UTILITY_H_
+
+#include <stddef.h>
+#include "ElanTsLogUtility.h"
+
+/*******************************************
+ * Definitions
+ ******************************************/
+
+// Default Socket Path
+#ifndef DAEMON_SOCKET_PATH
+#define DAEMON_SOCKET_PATH				"/run/elan_fwid.sock"
+#endif //DAEMON_SOCKET_PATH
+
+// Max. Length of Request / Response Line (including '\n')
+#ifndef DAEMON_MESSAGE_LENGTH_MAX
+#define DAEMON_MESSAGE_LENGTH_MAX		512
+#endif //DAEMON_MESSAGE_LENGTH_MAX
+
+// Time to Wait for Request Line from Client
+#ifndef DAEMON_REQUEST_TIMEOUT_MSEC
+#define DAEMON_REQUEST_TIMEOUT_MSEC		1000
+#endif //DAEMON_REQUEST_TIMEOUT_MSEC
+
+// Time to Wait for Response from Daemon
+#ifndef DAEMON_QUERY_TIMEOUT_MSEC
+#define DAEMON_QUERY_TIMEOUT_MSEC		5000
+#endif //DAEMON_QUERY_TIMEOUT_MSEC
+
+// Pending Connections
+#ifndef DAEMON_LISTEN_BACKLOG
+#define DAEMON_LISTEN_BACKLOG			8
+#endif //DAEMON_LISTEN_BACKLOG
+
+/*******************************************
+ * Data Structure Declaration
+ ******************************************/
+
+/*
+ * Request Handler
+ * p_request: Request line without line break, ex: "fwid chrome".
+ * p_response: Response line without line break, ex: "OK 2a03" / "ERR 0x106".
+ */
+typedef int (*daemon_request_handler)(const char *p_request, char *p_response, size_t response_size, void *p_context);
+
+/*******************************************
+ * Global Variables Declaration
+ ******************************************/
+
+/*******************************************
+ * Extern Variables Declaration
+ ******************************************/
+
+/*******************************************
+ * Function Prototype
+ ******************************************/
+
+// Daemon (Server)
+int daemon_listen(const char *p_socket_path, int *p_listen_fd);
+int daemon_serve(int listen_fd, daemon_request_handler handler, void *p_context);
+void daemon_close(int listen_fd, const char *p_socket_path);
+void daemon_stop(void);
+
+// Client
+int daemon_query(const char *p_socket_path, const char *p_request, char *p_response, size_t response_size);
+
+#endif //_ELAN_TS_DAEMON_UTILITY_H_
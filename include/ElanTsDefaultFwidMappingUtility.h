@@ -0,0 +1,62 @@
+/** @file
+
+  Header of Default (Built-in) FWID Mapping Utility for Elan I2C-HID Touchscreen.
+
+  Copyright (c) ELAN microelectronics corp. 2022, All Rights Reserved
+
+  Module Name:
+	ElanTsDefaultFwidMappingUtility.h
+
+  Environment:
+	All kinds of Linux-like Platform.
+
+********************************************************************
+ Revision History
+
+**/
+
+#ifndef _ELAN_TS_DEFAULT_FWID_MAPPING_UTILITY_H_
+#define _ELAN_TS_DEFAULT_FWID_MAPPING_UTILITY_H_
+
+#include <stdint.h>
+#include "ElanTsLcmDevUtility.h"
+
+/*******************************************
+ * Definitions
+ ******************************************/
+
+// Seed Spreading Constant of Perfect Hash
+#ifndef DEFAULT_FWID_MAPPING_SEED_MULTIPLIER
+#define DEFAULT_FWID_MAPPING_SEED_MULTIPLIER	0x9E3779B9
+#endif //DEFAULT_FWID_MAPPING_SEED_MULTIPLIER
+
+/*******************************************
+ * Inline Functions
+ ******************************************/
+
+// Perfect Hash of Panel Key (Shared with Table Generator)
+//   bucket = get_default_fwid_mapping_hash(panel_key, 0) & (bucket_count - 1)
+//   slot   = get_default_fwid_mapping_hash(panel_key, seed[bucket]) & (slot_count - 1)
+static inline uint32_t get_default_fwid_mapping_hash(uint32_t panel_key, uint32_t seed)
+{
+    uint32_t hash = panel_key ^ (seed * DEFAULT_FWID_MAPPING_SEED_MULTIPLIER);
+
+    hash ^= hash >> 16;
+    hash *= 0x7FEB352D;
+    hash ^= hash >> 15;
+    hash *= 0x846CA68B;
+    hash ^= hash >> 16;
+
+    return hash;
+}
+
+/*******************************************
+ * Function Prototype
+ ******************************************/
+
+// Built-in FWID Mapping Table (Generated from bin/fwid_mapping_table.txt at Build Time)
+size_t get_default_fwid_mapping_entry_count(void);
+uint32_t get_default_fwid_mapping_checksum(void);
+const struct fwid_mapping_image_entry *find_default_fwid_mapping_entry(unsigned int panel_key);
+
+#endif //_ELAN_TS_DEFAULT_FWID_MAPPING_UTILITY_H_
@@ -18,10 +18,41 @@
 #ifndef _ELAN_TS_EDID_UTILITY_H_
 #define _ELAN_TS_EDID_UTILITY_H_
 
+#include "ElanTsLogUtility.h"
+
 /*******************************************
  * Definitions
  ******************************************/
 
+// Root of DRM Connectors in sysfs
+#ifndef DRM_SYSFS_ROOT
+#define DRM_SYSFS_ROOT			"/sys/class/drm"
+#endif //DRM_SYSFS_ROOT
+
+// Path Length of DRM Connector Node
+#ifndef DRM_SYSFS_PATH_LENGTH_MAX
+#define DRM_SYSFS_PATH_LENGTH_MAX	512
+#endif //DRM_SYSFS_PATH_LENGTH_MAX
+
+// Size of EDID Base Block
+#ifndef EDID_BLOCK_SIZE
+#define EDID_BLOCK_SIZE			128
+#endif //EDID_BLOCK_SIZE
+
+// EDID Header Size (in Byte)
+#ifndef EDID_HEADER_SIZE
+#define EDID_HEADER_SIZE		8
+#endif //EDID_HEADER_SIZE
+
+// Offset of Manufacturer Code & Product Code in EDID Base Block
+#ifndef EDID_MANUFACTURER_CODE_OFFSET
+#define EDID_MANUFACTURER_CODE_OFFSET	8
+#endif //EDID_MANUFACTURER_CODE_OFFSET
+
+#ifndef EDID_PRODUCT_CODE_OFFSET
+#define EDID_PRODUCT_CODE_OFFSET		10
+#endif //EDID_PRODUCT_CODE_OFFSET
+
 // Path of modetest command
 #ifndef MODETEST_CMD
 #define MODETEST_CMD			"/usr/bin/modetest -a"
@@ -48,17 +79,6 @@
  * Global Variables Declaration
  ******************************************/
 
-// Debug
-extern bool g_debug;
-
-#ifndef DEBUG_PRINTF
-#define DEBUG_PRINTF(fmt, argv...) if(g_debug) printf(fmt, ##argv)
-#endif //DEBUG_PRINTF
-
-#ifndef ERROR_PRINTF
-#define ERROR_PRINTF(fmt, argv...) fprintf(stderr, fmt, ##argv)
-#endif //ERROR_PRINTF
-
 /*******************************************
  * Extern Variables Declaration
  ******************************************/
@@ -68,7 +88,9 @@ extern bool g_debug;
  ******************************************/
 
 // EDID Info.
-int get_edid_manufacturer_product_code(unsigned short *p_manufacturer_code, unsigned short *p_product_code);
+int get_edid_manufacturer_product_code(const char *drm_sysfs_root, unsigned short *p_manufacturer_code, unsigned short *p_product_code);
+int get_edid_manufacturer_product_code_from_sysfs(const char *drm_sysfs_root, unsigned short *p_manufacturer_code, unsigned short *p_product_code);
+int get_edid_manufacturer_product_code_from_modetest(unsigned short *p_manufacturer_code, unsigned short *p_product_code);
 int show_edid_manufacturer_product_code(unsigned short manufacturer_code, unsigned short product_code);
 
 #endif //_ELAN_TS_EDID_UTILITY_H_
@@ -23,6 +23,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
+#include "ElanTsLogUtility.h"
 
 /***************************************************
  * Definitions
@@ -68,6 +69,35 @@
 #define ERROR_RETRY_COUNT	3
 #endif //ERROR_RETRY_COUNT
 
+// Fixed Delay before Reading Page Data (Used before Ready Time was Learned from fd)
+#ifndef ELAN_PAGE_READY_FIXED_DELAY_MSEC
+#define ELAN_PAGE_READY_FIXED_DELAY_MSEC	20
+#endif //ELAN_PAGE_READY_FIXED_DELAY_MSEC
+
+// Wait for First Page Frame: Learned Ready Time x Margin, at Least Min. Timeout
+#ifndef ELAN_PAGE_READY_TIME_MARGIN
+#define ELAN_PAGE_READY_TIME_MARGIN			8
+#endif //ELAN_PAGE_READY_TIME_MARGIN
+
+#ifndef ELAN_PAGE_READY_TIMEOUT_MIN_MSEC
+#define ELAN_PAGE_READY_TIMEOUT_MIN_MSEC	50
+#endif //ELAN_PAGE_READY_TIMEOUT_MIN_MSEC
+
+// Max. ROM Words per Show Bulk ROM Data Command of ROM Range Read
+#ifndef ELAN_READ_ROM_RANGE_MAX_WORDS
+#define ELAN_READ_ROM_RANGE_MAX_WORDS		0x800	// 4KB
+#endif //ELAN_READ_ROM_RANGE_MAX_WORDS
+
+// Read Time Budget Added per Frame of ROM Range Read
+#ifndef ELAN_READ_ROM_RANGE_FRAME_BUDGET_MSEC
+#define ELAN_READ_ROM_RANGE_FRAME_BUDGET_MSEC	10
+#endif //ELAN_READ_ROM_RANGE_FRAME_BUDGET_MSEC
+
+// Page Count of Page Read Benchmark
+#ifndef BENCHMARK_PAGE_READ_COUNT
+#define BENCHMARK_PAGE_READ_COUNT	32
+#endif //BENCHMARK_PAGE_READ_COUNT
+
 /***************************************************
  * Macros
  ***************************************************/
@@ -90,17 +120,6 @@
  * Global Variables Declaration
  ***************************************************/
 
-// Debug
-extern bool g_debug;
-
-#ifndef DEBUG_PRINTF
-#define DEBUG_PRINTF(fmt, argv...) if(g_debug) printf(fmt, ##argv)
-#endif //DEBUG_PRINTF
-
-#ifndef ERROR_PRINTF
-#define ERROR_PRINTF(fmt, argv...) fprintf(stderr, fmt, ##argv)
-#endif //ERROR_PRINTF
-
 /***************************************************
  * Extern Variables Declaration
  ***************************************************/
@@ -115,6 +134,11 @@ int get_firmware_id(unsigned short *p_fw_id);
 int get_fw_version(unsigned short *p_fw_version);
 int get_test_version(unsigned short *p_test_version);
 
+// Session Context (Cached Device Information of Opened Handle)
+void reset_session_context(void);
+int get_session_hello_packet_bc_version(unsigned char *p_hello_packet, unsigned short *p_bc_version, int retry_count);
+int get_session_boot_code_version(unsigned short *p_bc_version);
+
 // Solution ID
 int get_solution_id(unsigned char *p_solution_id);
 
@@ -134,6 +158,10 @@ int check_slave_address(void);
 // Remark ID
 int read_remark_id(bool recovery);
 
+// Page Data Ready Time (Learned per Device within a Run)
+void set_page_ready_time(unsigned int ready_time_us);
+void set_page_read_fixed_delay(bool fixed_delay);
+
 // Page Data
 int read_page_data(unsigned short page_data_addr, unsigned short page_data_size, unsigned char *page_data_buf, size_t page_data_buf_size);
 int write_page_data(unsigned char *page_buf, int page_buf_size);
@@ -152,4 +180,10 @@ int get_rom_data(unsigned short addr, bool recovery, unsigned short *p_data);
 // Bulk ROM Data
 int get_bulk_rom_data(unsigned short addr, unsigned short *p_data);
 
+// ROM Range (Streamed Bulk ROM Data)
+int read_rom_range(unsigned short addr, unsigned int len, unsigned char *p_buf, size_t buf_size);
+
+// Benchmark
+int benchmark_page_read(int page_count);
+
 #endif //_ELAN_TS_FUNC_API_H_
@@ -0,0 +1,129 @@
+/** @file
+
+  Header of FWID Resolution Cache Utility for Elan I2C-HID Touchscreen.
+
+  Copyright (c) ELAN microelectronics corp. 2022, All Rights Reserved
+
+  Module Name:
+	ElanTsFwidCacheUtility.h
+
+  Environment:
+	All kinds of Linux-like Platform.
+
+********************************************************************
+ Revision History
+
+**/
+
+#ifndef _ELAN_TS_FWID_CACHE_UTILITY_H_
+#define _ELAN_TS_FWID_CACHE_UTILITY_H_
+
+#include <stdint.h>
+#include "ElanTsLogUtility.h"
+
+/*******************************************
+ * Definitions
+ ******************************************/
+
+// Magic Number of Cache File ("EFWC")
+#ifndef FWID_CACHE_MAGIC
+#define FWID_CACHE_MAGIC		0x43574645
+#endif //FWID_CACHE_MAGIC
+
+// Version of Cache File Format
+#ifndef FWID_CACHE_VERSION
+#define FWID_CACHE_VERSION		6
+#endif //FWID_CACHE_VERSION
+
+// Cache Data Flags
+#ifndef FWID_CACHE_FLAG_GEN8_TOUCH
+#define FWID_CACHE_FLAG_GEN8_TOUCH		0x01
+#endif //FWID_CACHE_FLAG_GEN8_TOUCH
+
+#ifndef FWID_CACHE_FLAG_RECOVERY
+#define FWID_CACHE_FLAG_RECOVERY		0x02
+#endif //FWID_CACHE_FLAG_RECOVERY
+
+#ifndef FWID_CACHE_FLAG_CHROME_FWID_FOUND
+#define FWID_CACHE_FLAG_CHROME_FWID_FOUND	0x04
+#endif //FWID_CACHE_FLAG_CHROME_FWID_FOUND
+
+#ifndef FWID_CACHE_FLAG_WINDOWS_FWID_FOUND
+#define FWID_CACHE_FLAG_WINDOWS_FWID_FOUND	0x08
+#endif //FWID_CACHE_FLAG_WINDOWS_FWID_FOUND
+
+/*******************************************
+ * Data Structure Declaration
+ ******************************************/
+
+// Cache Key: Identity of Touch Device & Its Firmware, Panel & FWID Mapping File
+typedef struct fwid_cache_key
+{
+    uint16_t hid_vid;
+    uint16_t hid_pid;
+    uint16_t edid_manufacturer_code;
+    uint16_t edid_product_code;
+    uint32_t edid_info_found;
+    uint32_t mapping_file_size;
+    uint32_t default_mapping_checksum;	// Built-in Mapping Table
+    uint8_t  hello_packet;				// Touch Mode (Normal / Recovery) & HW Series
+    uint8_t  reserved;
+    uint16_t fw_version;				// FW Version (Normal Mode), BC Version of Hello Packet (Recovery Mode)
+    int64_t  mapping_file_mtime_sec;
+    int64_t  mapping_file_mtime_nsec;
+    uint64_t mapping_file_inode;
+    uint32_t mapping_image_size;		// Compiled Image "<mapping_file>.bin" (0 if Not Exist)
+    uint32_t mapping_image_reserved;
+    int64_t  mapping_image_mtime_sec;
+    int64_t  mapping_image_mtime_nsec;
+    uint64_t mapping_image_inode;
+} FWID_CACHE_KEY, *PFWID_CACHE_KEY;
+
+// Cache Data: Result of Touch Controller Queries & FWID Lookup
+typedef struct fwid_cache_data
+{
+    uint8_t  hello_packet;
+    uint8_t  flags;
+    uint16_t fw_bc_version;
+    uint16_t bc_bc_version;
+    uint16_t info_fwid;
+    uint16_t chrome_fwid;	// Valid if FWID_CACHE_FLAG_CHROME_FWID_FOUND
+    uint16_t windows_fwid;	// Valid if FWID_CACHE_FLAG_WINDOWS_FWID_FOUND
+} FWID_CACHE_DATA, *PFWID_CACHE_DATA;
+
+// Cache File Layout
+typedef struct fwid_cache_file
+{
+    uint32_t magic;
+    uint32_t version;
+    struct fwid_cache_key  key;
+    struct fwid_cache_data data;
+    uint32_t checksum;
+} FWID_CACHE_FILE, *PFWID_CACHE_FILE;
+
+/*******************************************
+ * Global Data Structure Declaration
+ ******************************************/
+
+/*******************************************
+ * Global Variables Declaration
+ ******************************************/
+
+/*******************************************
+ * Extern Variables Declaration
+ ******************************************/
+
+/*******************************************
+ * Function Prototype
+ ******************************************/
+
+// Cache Key
+int get_fwid_cache_key(unsigned short hid_vid, unsigned short hid_pid, unsigned char hello_packet, unsigned short fw_version, \
+                       bool edid_info_found, unsigned short edid_manufacturer_code, unsigned short edid_product_code, \
+                       const char *p_fwid_mapping_file_path, struct fwid_cache_key *p_cache_key);
+
+// Cache File
+int load_fwid_cache(const char *p_cache_file_path, struct fwid_cache_key *p_cache_key, struct fwid_cache_data *p_cache_data);
+int save_fwid_cache(const char *p_cache_file_path, struct fwid_cache_key *p_cache_key, struct fwid_cache_data *p_cache_data);
+
+#endif //_ELAN_TS_FWID_CACHE_UTILITY_H_
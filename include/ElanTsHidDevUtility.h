@@ -19,6 +19,8 @@
 #define _ELAN_TS_HID_DEVICE_UTILITY_H_
 
 #include <linux/hidraw.h>	/* hidraw */
+#include <pthread.h>		/* pthread_mutex */
+#include "ElanTsLogUtility.h"
 
 /*******************************************
  * Definitions
@@ -29,6 +31,16 @@
 #define DEV_INFO_SET_MAX		100
 #endif //DEV_INFO_SET_MAX
 
+// hidraw Class Directory of sysfs
+#ifndef HIDRAW_SYSFS_ROOT
+#define HIDRAW_SYSFS_ROOT		"/sys/class/hidraw"
+#endif //HIDRAW_SYSFS_ROOT
+
+// hidraw Device Node Directory
+#ifndef HIDRAW_DEV_ROOT
+#define HIDRAW_DEV_ROOT			"/dev"
+#endif //HIDRAW_DEV_ROOT
+
 // ELAN Default VID
 #ifndef ELAN_USB_VID
 #define ELAN_USB_VID			0x04F3
@@ -43,21 +55,19 @@
  * Global Data Structure Declaration
  ******************************************/
 
+// Entry of HID Device Inventory
+typedef struct hid_dev_entry
+{
+    char path[64];					// ex: /dev/hidraw0
+    struct hidraw_devinfo info;		// Bus Type, VID, PID
+    char name[128];					// HID_NAME
+    char phys[64];					// HID_PHYS
+} HID_DEV_ENTRY, *PHID_DEV_ENTRY;
+
 /*******************************************
  * Global Variables Declaration
  ******************************************/
 
-// Debug
-extern bool g_debug;
-
-#ifndef DEBUG_PRINTF
-#define DEBUG_PRINTF(fmt, argv...) if(g_debug) printf(fmt, ##argv)
-#endif //DEBUG_PRINTF
-
-#ifndef ERROR_PRINTF
-#define ERROR_PRINTF(fmt, argv...) fprintf(stderr, fmt, ##argv)
-#endif //ERROR_PRINTF
-
 /*******************************************
  * Extern Variables Declaration
  ******************************************/
@@ -66,6 +76,11 @@ extern bool g_debug;
  * Function Prototype
  ******************************************/
 
+// HID Device Inventory (One Enumeration Pass Shared by Device Open & System Info.)
+int build_hid_dev_inventory(bool rescan);
+int get_hid_dev_count(void);
+int get_hid_dev_entry(int index, struct hid_dev_entry *p_entry);
+
 // HID Device Info.
 const char *bus_str(int bus);
 int get_hid_dev_info(struct hidraw_devinfo *p_hid_dev_info, size_t dev_info_size);
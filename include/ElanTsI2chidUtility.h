@@ -21,6 +21,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "ElanTsI2chidHwParameters.h" // HW Parameters for Elan Gen5 / Gen6 / Gen7 Touch Controllers
+#include "ElanTsLogUtility.h"
 
 /***************************************************
  * Definitions
@@ -69,17 +70,6 @@ enum POWER_MODE
  * Global Variables Declaration
  ******************************************/
 
-// Debug
-extern bool g_debug;
-
-#ifndef DEBUG_PRINTF
-#define DEBUG_PRINTF(fmt, argv...) if(g_debug) printf(fmt, ##argv)
-#endif //DEBUG_PRINTF
-
-#ifndef ERROR_PRINTF
-#define ERROR_PRINTF(fmt, argv...) fprintf(stderr, fmt, ##argv)
-#endif //ERROR_PRINTF
-
 /*******************************************
  * Extern Variables Declaration
  ******************************************/
@@ -90,9 +80,18 @@ extern int write_cmd(unsigned char *cmd_buf, int len, int timeout_ms);
 // Read Data
 extern int read_data(unsigned char *data_buf, int len, int timeout_ms);
 
+// Read Data without Copy (View Valid until Released)
+extern int read_data_view(const unsigned char **pp_data, int len, int timeout_ms);
+extern void release_data_view(const unsigned char *p_data);
+
 // Write Vendor Command
 extern int write_vendor_cmd(unsigned char *cmd_buf, int len, int timeout_ms);
 
+// Read Deadline (Shared Time Budget of Multi-Frame Read) & Latency
+extern int set_read_deadline(int timeout_ms);
+extern int clear_read_deadline(void);
+extern int get_last_read_latency(unsigned long long *p_latency_us);
+
 // HID Raw I/O
 extern int __hidraw_write(unsigned char* buf, int len, int timeout_ms);
 extern int __hidraw_read(unsigned char* buf, int len, int timeout_ms);
@@ -18,6 +18,9 @@
 #ifndef _ELAN_TS_LCM_DEVICE_UTILITY_H_
 #define _ELAN_TS_LCM_DEVICE_UTILITY_H_
 
+#include <stdint.h>
+#include "ElanTsLogUtility.h"
+
 /*******************************************
  * Definitions
  ******************************************/
@@ -27,6 +30,30 @@
 #define DEV_INFO_SET_MAX		100
 #endif //DEV_INFO_SET_MAX
 
+// Initial Capacity of LCM Device Table (Grows on Demand)
+#ifndef LCM_DEV_TABLE_INIT_CAPACITY
+#define LCM_DEV_TABLE_INIT_CAPACITY	64
+#endif //LCM_DEV_TABLE_INIT_CAPACITY
+
+// Row Count of Synthetic Mapping Table for Benchmark
+#ifndef BENCHMARK_MAPPING_ROW_COUNT
+#define BENCHMARK_MAPPING_ROW_COUNT	100000
+#endif //BENCHMARK_MAPPING_ROW_COUNT
+
+// Binary FWID Mapping Image
+#ifndef FWID_MAPPING_IMAGE_MAGIC
+#define FWID_MAPPING_IMAGE_MAGIC	0x4D574645	// "EFWM"
+#endif //FWID_MAPPING_IMAGE_MAGIC
+
+#ifndef FWID_MAPPING_IMAGE_VERSION
+#define FWID_MAPPING_IMAGE_VERSION	2
+#endif //FWID_MAPPING_IMAGE_VERSION
+
+// Image Path: "<mapping_file_path>.bin"
+#ifndef FWID_MAPPING_IMAGE_SUFFIX
+#define FWID_MAPPING_IMAGE_SUFFIX	".bin"
+#endif //FWID_MAPPING_IMAGE_SUFFIX
+
 // File Length
 #ifndef FILE_NAME_LENGTH_MAX
 #define FILE_NAME_LENGTH_MAX	256
@@ -47,6 +74,15 @@
 #define SYSTEM_NAME_LENGTH		16
 #endif //SYSTEM_NAME_LENGTH
 
+/*******************************************
+ * Macros
+ ******************************************/
+
+// Panel Key: Packed EDID Manufacturer Code & Product Code
+#ifndef LCM_PANEL_KEY
+#define LCM_PANEL_KEY(manufacturer_code, product_code)	((((unsigned int)(manufacturer_code) & 0xFFFF) << 16) | ((unsigned int)(product_code) & 0xFFFF))
+#endif //LCM_PANEL_KEY
+
 /*******************************************
  * Data Structure Declaration
  ******************************************/
@@ -54,11 +90,46 @@
 // LCM Device Info.
 typedef struct lcm_dev_info
 {
+    unsigned int panel_key;
     char panel_info[PANEL_INFO_LENGTH_MAX];
     unsigned short chrome_fwid;
     unsigned short windows_fwid;
 } DEV_INFO, *PDEV_INFO;
 
+// Binary FWID Mapping Image: Header, then Entries Sorted by Panel Key (Host Byte Order)
+typedef struct fwid_mapping_image_header
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t entry_count;
+    uint32_t checksum;			// FNV-1a of Entries (Verified by "-C" Only)
+    uint32_t header_checksum;	// FNV-1a of Header Fields above (Verified on Every Load)
+} FWID_MAPPING_IMAGE_HEADER, *PFWID_MAPPING_IMAGE_HEADER;
+
+typedef struct fwid_mapping_image_entry
+{
+    uint32_t panel_key;
+    uint16_t chrome_fwid;
+    uint16_t windows_fwid;
+} FWID_MAPPING_IMAGE_ENTRY, *PFWID_MAPPING_IMAGE_ENTRY;
+
+// LCM Device Table: Entries in File Order, Indexed by Open-Addressing Hash of Panel Key,
+//                   or Entries of Mapped Binary Image
+typedef struct lcm_dev_table
+{
+    struct lcm_dev_info *p_dev_info;
+    size_t dev_info_count;
+    size_t dev_info_capacity;
+    unsigned int *p_hash_slot;	// (Entry Index + 1), 0: Empty Slot
+    size_t hash_slot_count;		// Power of 2
+
+    // Mapped Binary Image (NULL if Loaded from Text File)
+    void *p_image_map;
+    size_t image_map_size;
+    const struct fwid_mapping_image_entry *p_image_entry;
+    size_t image_entry_count;
+} LCM_DEV_TABLE, *PLCM_DEV_TABLE;
+
 // System Type
 enum system_type
 {
@@ -75,17 +146,6 @@ enum system_type
  * Global Variables Declaration
  ******************************************/
 
-// Debug
-extern bool g_debug;
-
-#ifndef DEBUG_PRINTF
-#define DEBUG_PRINTF(fmt, argv...) if(g_debug) printf(fmt, ##argv)
-#endif //DEBUG_PRINTF
-
-#ifndef ERROR_PRINTF
-#define ERROR_PRINTF(fmt, argv...) fprintf(stderr, fmt, ##argv)
-#endif //ERROR_PRINTF
-
 /*******************************************
  * Extern Variables Declaration
  ******************************************/
@@ -94,15 +154,29 @@ extern bool g_debug;
  * Function Prototype
  ******************************************/
 
+// LCM Device Table
+int init_lcm_dev_table(struct lcm_dev_table *p_dev_table);
+void free_lcm_dev_table(struct lcm_dev_table *p_dev_table);
+int add_lcm_dev_info(struct lcm_dev_table *p_dev_table, unsigned int panel_key, unsigned short chrome_fwid, unsigned short windows_fwid);
+struct lcm_dev_info *find_lcm_dev_info(struct lcm_dev_table *p_dev_table, unsigned int panel_key);
+
 // FWID Mapping File & LCM Dev Info.
-int parse_fwid_mapping_file(FILE *fd_mapping_file, struct lcm_dev_info *dev_info, size_t dev_info_size);
-int show_lcm_dev_info(struct lcm_dev_info *p_dev_info, size_t dev_info_size);
+int load_fwid_mapping_file(const char *p_mapping_file_path, struct lcm_dev_table *p_dev_table);
+int parse_fwid_mapping_file(FILE *fd_mapping_file, struct lcm_dev_table *p_dev_table);
+int show_lcm_dev_info(struct lcm_dev_table *p_dev_table);
+
+// Binary FWID Mapping Image
+int compile_fwid_mapping_image(const char *p_mapping_file_path);
+int map_fwid_mapping_image(const char *p_image_file_path, struct lcm_dev_table *p_dev_table, bool verify_entries);
 
 // FWID
-int get_fwid_from_edid(struct lcm_dev_info *p_dev_info, size_t dev_info_size, unsigned short manufacturer_code, unsigned short product_code, system_type system, unsigned short *p_fwid);
+int get_fwid_from_edid(struct lcm_dev_table *p_dev_table, unsigned short manufacturer_code, unsigned short product_code, system_type system, unsigned short *p_fwid);
 int show_fwid(system_type system, unsigned short fwid, bool silent_mode);
 
 int get_fwid_from_rom(unsigned short *p_fwid, bool recovery);
 int show_fwid_from_rom(unsigned short fwid);
 
+// Benchmark
+int benchmark_fwid_mapping_file(size_t row_count);
+
 #endif //_ELAN_TS_LCM_DEVICE_UTILITY_H_
@@ -0,0 +1,82 @@
+/** @file
+
+  Header of Log Utility (Log Levels & Log Macros) for Elan I2C-HID Touchscreen.
+
+  Copyright (c) ELAN microelectronics corp. 2022, All Rights Reserved
+
+  Module Name:
+	ElanTsLogUtility.h
+
+  Environment:
+	All kinds of Linux-like Platform.
+
+********************************************************************
+ Revision History
+
+**/
+
+#ifndef _ELAN_TS_LOG_UTILITY_H_
+#define _ELAN_TS_LOG_UTILITY_H_
+
+#include <stdio.h>
+
+/*******************************************
+ * Definitions
+ ******************************************/
+
+// Log Levels
+#define ELAN_LOG_LEVEL_NONE		0
+#define ELAN_LOG_LEVEL_ERROR	1	// Error Message (stderr)
+#define ELAN_LOG_LEVEL_INFO		2	// Information Message
+#define ELAN_LOG_LEVEL_DEBUG	3	// Debug Message ("-d" / Debug Log File)
+#define ELAN_LOG_LEVEL_TRACE	4	// Command / Report Dump of Every hidraw Transaction
+
+/*
+ * Compile-time Log Level
+ * Records above this level are compiled out with their arguments ("make release" sets ELAN_LOG_LEVEL_ERROR).
+ * Default follows debug flags of Makefile, so "-d" works as before.
+ */
+#ifndef ELAN_LOG_LEVEL
+#if defined(__ENABLE_DEBUG__) && (defined(__ENABLE_OUTBUF_DEBUG__) || defined(__ENABLE_INBUF_DEBUG__))
+#define ELAN_LOG_LEVEL	ELAN_LOG_LEVEL_TRACE
+#else
+#define ELAN_LOG_LEVEL	ELAN_LOG_LEVEL_DEBUG
+#endif //defined(__ENABLE_DEBUG__) && (defined(__ENABLE_OUTBUF_DEBUG__) || defined(__ENABLE_INBUF_DEBUG__))
+#endif //ELAN_LOG_LEVEL
+
+// Record Compiled in (Constant Expression)
+#define ELAN_LOG_COMPILED(level)			((level) <= ELAN_LOG_LEVEL)
+
+// Record Compiled in & Accepted by Sink; Arguments are Evaluated & Formatted Only when True
+#define ELAN_LOG_ENABLED(level, sink_on)	(ELAN_LOG_COMPILED(level) && (sink_on))
+
+/*******************************************
+ * Global Variables Declaration
+ ******************************************/
+
+// Debug
+extern bool g_debug;
+
+/*******************************************
+ * Macros
+ ******************************************/
+
+#define ELAN_LOG_PRINTF(level, sink_on, stream, fmt, argv...) \
+do{ \
+    if(ELAN_LOG_ENABLED(level, sink_on)) \
+        fprintf(stream, fmt, ##argv); \
+}while(0)
+
+#ifndef ERROR_PRINTF
+#define ERROR_PRINTF(fmt, argv...) ELAN_LOG_PRINTF(ELAN_LOG_LEVEL_ERROR, true, stderr, fmt, ##argv)
+#endif //ERROR_PRINTF
+
+#ifndef DEBUG_PRINTF
+#define DEBUG_PRINTF(fmt, argv...) ELAN_LOG_PRINTF(ELAN_LOG_LEVEL_DEBUG, g_debug, stdout, fmt, ##argv)
+#endif //DEBUG_PRINTF
+
+#ifndef TRACE_PRINTF
+#define TRACE_PRINTF(fmt, argv...) ELAN_LOG_PRINTF(ELAN_LOG_LEVEL_TRACE, g_debug, stdout, fmt, ##argv)
+#endif //TRACE_PRINTF
+
+#endif //_ELAN_TS_LOG_UTILITY_H_
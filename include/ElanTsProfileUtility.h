@@ -0,0 +1,108 @@
+/** @file
+
+  Header of Profile Utility (Phase Timing & I/O Latency Histogram) for Elan I2C-HID Touchscreen.
+
+  Copyright (c) ELAN microelectronics corp. 2022, All Rights Reserved
+
+  Module Name:
+	ElanTsProfileUtility.h
+
+  Environment:
+	All kinds of Linux-like Platform.
+
+********************************************************************
+ Revision History
+
+**/
+
+#ifndef _ELAN_TS_PROFILE_UTILITY_H_
+#define _ELAN_TS_PROFILE_UTILITY_H_
+
+#include <stdio.h>
+#include "ElanTsLogUtility.h"
+
+/*******************************************
+ * Definitions
+ ******************************************/
+
+/*
+ * Latency Histogram (Log-Linear)
+ * Latencies below PROFILE_HISTOGRAM_SUB_BUCKETS us are exact, others fall into one of
+ * PROFILE_HISTOGRAM_SUB_BUCKETS buckets per power of 2 (percentiles within 12.5%).
+ * Latencies of 2^PROFILE_HISTOGRAM_MAX_EXP us or longer are counted in the last bucket.
+ */
+#ifndef PROFILE_HISTOGRAM_SUB_BUCKET_BITS
+#define PROFILE_HISTOGRAM_SUB_BUCKET_BITS	3
+#endif //PROFILE_HISTOGRAM_SUB_BUCKET_BITS
+
+#define PROFILE_HISTOGRAM_SUB_BUCKETS		(1 << PROFILE_HISTOGRAM_SUB_BUCKET_BITS)
+
+#ifndef PROFILE_HISTOGRAM_MAX_EXP
+#define PROFILE_HISTOGRAM_MAX_EXP			27		// ~134 Seconds
+#endif //PROFILE_HISTOGRAM_MAX_EXP
+
+#define PROFILE_HISTOGRAM_BUCKETS			((PROFILE_HISTOGRAM_MAX_EXP - PROFILE_HISTOGRAM_SUB_BUCKET_BITS + 1) * PROFILE_HISTOGRAM_SUB_BUCKETS)
+
+/*******************************************
+ * Data Structure Declaration
+ ******************************************/
+
+// Report Format
+typedef enum profile_format
+{
+    PROFILE_FORMAT_TABLE = 0,
+    PROFILE_FORMAT_JSON
+} PROFILE_FORMAT;
+
+// Raw I/O Recorded by Interface (Only when Built with __ENABLE_PROFILE__)
+typedef enum profile_io
+{
+    PROFILE_IO_WRITE = 0,	// Output report (WriteRawBytes)
+    PROFILE_IO_READ,		// Input report (ReadRawBytes)
+    PROFILE_IO_COUNT
+} PROFILE_IO;
+
+// Phase Timing (Offset from Process Start)
+typedef struct phase_timing
+{
+    const char *name;
+    unsigned long long start_us;
+    unsigned long long end_us;		// 0: Not executed
+} PHASE_TIMING, *PPHASE_TIMING;
+
+// Latency Summary of One Kind of I/O
+typedef struct latency_summary
+{
+    unsigned long count;
+    unsigned long timeouts;
+    unsigned long errors;			// Errors other than timeout
+    unsigned long retries;			// Extra attempts inside one call (ex: short hidraw write)
+    unsigned long long mean_us;
+    unsigned long long p50_us;
+    unsigned long long p95_us;
+    unsigned long long p99_us;
+    unsigned long long max_us;
+} LATENCY_SUMMARY, *PLATENCY_SUMMARY;
+
+/*******************************************
+ * Global Variables Declaration
+ ******************************************/
+
+/*******************************************
+ * Extern Variables Declaration
+ ******************************************/
+
+/*******************************************
+ * Function Prototype
+ ******************************************/
+
+// Latency Histogram (Updated Atomically, I/O may Run on Several Device Threads)
+void profile_record_io(PROFILE_IO io, unsigned long long latency_us, int err, int retries);
+void get_latency_summary(PROFILE_IO io, struct latency_summary *p_summary);
+
+// Report
+int parse_profile_format(const char *p_format_str, PROFILE_FORMAT *p_format);
+void show_profile(FILE *p_stream, PROFILE_FORMAT format, const char *p_mode, \
+                  const struct phase_timing *p_phases, int phase_count, unsigned long long total_us);
+
+#endif //_ELAN_TS_PROFILE_UTILITY_H_
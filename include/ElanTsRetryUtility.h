@@ -0,0 +1,95 @@
+/** @file
+
+  Header of Retry Policy Utility for Elan I2C-HID Touchscreen.
+
+  Copyright (c) ELAN microelectronics corp. 2022, All Rights Reserved
+
+  Module Name:
+	ElanTsRetryUtility.h
+
+  Environment:
+	All kinds of Linux-like Platform.
+
+********************************************************************
+ Revision History
+
+**/
+
+#ifndef _ELAN_TS_RETRY_UTILITY_H_
+#define _ELAN_TS_RETRY_UTILITY_H_
+
+#include "ElanTsLogUtility.h"
+
+/*******************************************
+ * Definitions
+ ******************************************/
+
+// Upper Bound of Single Retry Delay
+#ifndef RETRY_MAX_DELAY_MSEC
+#define RETRY_MAX_DELAY_MSEC	500
+#endif //RETRY_MAX_DELAY_MSEC
+
+/*******************************************
+ * Data Structure Declaration
+ ******************************************/
+
+// Backoff between Attempts
+typedef enum retry_backoff
+{
+    RETRY_BACKOFF_IMMEDIATE = 0,	// No delay
+    RETRY_BACKOFF_FIXED,			// base_delay_ms every time
+    RETRY_BACKOFF_LINEAR,			// base_delay_ms * n
+    RETRY_BACKOFF_EXPONENTIAL		// base_delay_ms * 2^(n-1), randomized in [delay/2, delay]
+} RETRY_BACKOFF;
+
+// Retry Policy
+typedef struct retry_policy
+{
+    int max_attempts;				// Attempts including the first one
+    RETRY_BACKOFF backoff;
+    unsigned int base_delay_ms;
+    unsigned int max_delay_ms;		// Cap of single delay
+    unsigned int deadline_ms;		// Overall time budget of all attempts (0: No deadline)
+} RETRY_POLICY, *PRETRY_POLICY;
+
+// Retry Statistics (Accumulated over All Operations)
+typedef struct retry_statistics
+{
+    unsigned long operations;
+    unsigned long attempts;
+    unsigned long failed_operations;	// Gave up or non-retriable error
+    unsigned long long sleep_us;		// Time spent in backoff delay
+} RETRY_STATISTICS, *PRETRY_STATISTICS;
+
+// Operation to Retry (Returns TP_SUCCESS or Error Code)
+typedef int (*retry_operation)(void *p_context);
+
+/*******************************************
+ * Global Data Structure Declaration
+ ******************************************/
+
+/*******************************************
+ * Global Variables Declaration
+ ******************************************/
+
+/*******************************************
+ * Extern Variables Declaration
+ ******************************************/
+
+/*******************************************
+ * Function Prototype
+ ******************************************/
+
+// Retry Policy
+void init_retry_policy(struct retry_policy *p_policy, int max_attempts, RETRY_BACKOFF backoff, unsigned int base_delay_ms);
+int parse_retry_policy(const char *p_policy_str, struct retry_policy *p_policy);
+void set_retry_policy_override(const struct retry_policy *p_policy);
+
+// Retry Engine
+bool is_retriable_error(int err);
+int run_with_retry(const char *p_operation_name, const struct retry_policy *p_policy, retry_operation operation, void *p_context);
+
+// Retry Statistics
+void get_retry_statistics(struct retry_statistics *p_statistics);
+
+#endif //_ELAN_TS_RETRY_UTILITY_H_
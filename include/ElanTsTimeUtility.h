@@ -0,0 +1,45 @@
+/** @file
+
+  Header of Time Utility for Elan I2C-HID Touchscreen.
+
+  Copyright (c) ELAN microelectronics corp. 2022, All Rights Reserved
+
+  Module Name:
+	ElanTsTimeUtility.h
+
+  Environment:
+	All kinds of Linux-like Platform.
+
+********************************************************************
+ Revision History
+
+**/
+
+#ifndef _ELAN_TS_TIME_UTILITY_H_
+#define _ELAN_TS_TIME_UTILITY_H_
+
+/*******************************************
+ * Definitions
+ ******************************************/
+
+/*******************************************
+ * Global Data Structure Declaration
+ ******************************************/
+
+/*******************************************
+ * Global Variables Declaration
+ ******************************************/
+
+/*******************************************
+ * Extern Variables Declaration
+ ******************************************/
+
+/*******************************************
+ * Function Prototype
+ ******************************************/
+
+// Monotonic Clock (Not Affected by System Time Change)
+unsigned long long get_monotonic_time_us(void);
+unsigned long long get_elapsed_time_us(unsigned long long start_time_us);
+
+#endif //_ELAN_TS_TIME_UTILITY_H_
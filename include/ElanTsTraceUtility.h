@@ -0,0 +1,104 @@
+/** @file
+
+  Header of HID Transaction Trace Utility (Binary Trace Record & Load) for Elan I2C-HID Touchscreen.
+
+  Copyright (c) ELAN microelectronics corp. 2022, All Rights Reserved
+
+  Module Name:
+	ElanTsTraceUtility.h
+
+  Environment:
+	All kinds of Linux-like Platform.
+
+********************************************************************
+ Revision History
+
+**/
+
+#ifndef _ELAN_TS_TRACE_UTILITY_H_
+#define _ELAN_TS_TRACE_UTILITY_H_
+
+#include <stdio.h>
+#include "ElanTsLogUtility.h"
+
+/*******************************************
+ * Definitions
+ ******************************************/
+
+/*
+ * Trace File Format (Little Endian)
+ * Header (24 bytes):
+ *   "ELTR" | version (2) | reserved (2) | VID (2) | PID (2) | reserved (4) | capture time (8, seconds since epoch)
+ * Record (7 bytes + data):
+ *   time delta from previous record (4, us) | direction (1) | report size (1) | data length (1) | data
+ *   Trailing zero bytes of a report are not stored (report size - data length), data[0] is report ID.
+ */
+#define TRACE_FILE_MAGIC				"ELTR"
+#define TRACE_FILE_VERSION				1
+#define TRACE_FILE_HEADER_SIZE			24
+#define TRACE_RECORD_HEADER_SIZE		7
+
+// Max. Report Size (Input Report, Report ID Included)
+#ifndef TRACE_REPORT_SIZE_MAX
+#define TRACE_REPORT_SIZE_MAX			65
+#endif //TRACE_REPORT_SIZE_MAX
+
+/*******************************************
+ * Data Structure Declaration
+ ******************************************/
+
+// Direction of Report
+typedef enum trace_direction
+{
+    TRACE_DIRECTION_OUT = 0,	// Output report (host to device)
+    TRACE_DIRECTION_IN			// Input report (device to host)
+} TRACE_DIRECTION;
+
+// Trace File Header
+typedef struct trace_header
+{
+    unsigned short version;
+    unsigned short vid;
+    unsigned short pid;
+    unsigned long long capture_time;		// Seconds since epoch
+} TRACE_HEADER, *PTRACE_HEADER;
+
+// Trace Record (Loaded)
+typedef struct trace_record
+{
+    unsigned long long time_us;				// From first record
+    unsigned char direction;				// TRACE_DIRECTION
+    unsigned char report_size;
+    unsigned char data[TRACE_REPORT_SIZE_MAX];	// Report padded with zero to report_size
+} TRACE_RECORD, *PTRACE_RECORD;
+
+// Trace Writer
+typedef struct trace_writer
+{
+    FILE *p_file;
+    unsigned long long last_time_us;		// Monotonic time of previous record (0: none)
+    unsigned long records;
+} TRACE_WRITER, *PTRACE_WRITER;
+
+/*******************************************
+ * Global Variables Declaration
+ ******************************************/
+
+/*******************************************
+ * Extern Variables Declaration
+ ******************************************/
+
+/*******************************************
+ * Function Prototype
+ ******************************************/
+
+// Record (Caller Serializes Appends)
+int trace_writer_open(const char *p_file_path, unsigned short vid, unsigned short pid, struct trace_writer *p_writer);
+int trace_writer_append(struct trace_writer *p_writer, TRACE_DIRECTION direction, unsigned long long time_us, const unsigned char *p_report, int report_size);
+void trace_writer_close(struct trace_writer *p_writer);
+
+// Load Whole Trace (Records Released by trace_free)
+int trace_load(const char *p_file_path, struct trace_header *p_header, struct trace_record **pp_records, int *p_record_count);
+void trace_free(struct trace_record *p_records);
+
+#endif //_ELAN_TS_TRACE_UTILITY_H_
@@ -0,0 +1,77 @@
+/** @file
+
+  Header of Kernel Uevent Utility for Elan I2C-HID Touchscreen.
+
+  Copyright (c) ELAN microelectronics corp. 2022, All Rights Reserved
+
+  Module Name:
+	ElanTsUeventUtility.h
+
+  Environment:
+	All kinds of Linux-like Platform.
+
+********************************************************************
+ Revision History
+
+**/
+
+#ifndef _ELAN_TS_UEVENT_UTILITY_H_
+#define _ELAN_TS_UEVENT_UTILITY_H_
+
+#include <stdio.h>
+#include "ElanTsLogUtility.h"
+
+/*******************************************
+ * Definitions
+ ******************************************/
+
+// Receive Buffer of One Kernel Uevent
+#ifndef UEVENT_BUFFER_SIZE
+#define UEVENT_BUFFER_SIZE		4096
+#endif //UEVENT_BUFFER_SIZE
+
+// Length of HID Device Name in DEVPATH, ex: "0018:04F3:2A03.0001"
+#define UEVENT_HID_NAME_LENGTH	19
+
+/*******************************************
+ * Data Structure Declaration
+ ******************************************/
+
+// Kernel Uevent (Fields Used by Watch Mode)
+typedef struct uevent_message
+{
+    char action[16];		// ACTION, ex: add, remove, change
+    char subsystem[32];		// SUBSYSTEM, ex: hidraw, drm
+    char devname[64];		// DEVNAME, ex: hidraw3, dri/card0
+    char devpath[256];		// DEVPATH, ex: /devices/.../hidraw/hidraw3
+    char edid[16];			// EDID, ex: 06af:3d31 (Replay Only: Panel after drm Change, Not Sent by Kernel)
+} UEVENT_MESSAGE, *PUEVENT_MESSAGE;
+
+/*******************************************
+ * Global Variables Declaration
+ ******************************************/
+
+/*******************************************
+ * Extern Variables Declaration
+ ******************************************/
+
+/*******************************************
+ * Function Prototype
+ ******************************************/
+
+// Kernel Uevent Socket (NETLINK_KOBJECT_UEVENT)
+int uevent_open(int *p_fd);
+int uevent_receive(int fd, struct uevent_message *p_message, int timeout_ms);
+void uevent_close(int fd);
+
+// Parse Uevent: Kernel Message ("action@devpath\0KEY=VALUE\0...") or One "KEY=VALUE" Line
+int uevent_parse(const char *p_buf, size_t len, struct uevent_message *p_message);
+int uevent_parse_property(const char *p_property, struct uevent_message *p_message);
+
+// Identity of HID Device behind hidraw Node, from Its DEVPATH (ex: ".../0018:04F3:2A03.0001/hidraw/hidraw3")
+int uevent_get_hid_id(const struct uevent_message *p_message, unsigned int *p_bus, unsigned short *p_vid, unsigned short *p_pid);
+
+// Replay Recorded Uevents ("udevadm monitor --kernel --property" Output, Blank Line Ends a Message)
+int uevent_replay_next(FILE *p_file, struct uevent_message *p_message);
+
+#endif //_ELAN_TS_UEVENT_UTILITY_H_
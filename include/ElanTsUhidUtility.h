@@ -0,0 +1,80 @@
+/** @file
+
+  Header of uhid Utility (Virtual Elan I2C-HID Touchscreen behind Kernel hidraw).
+
+  Copyright (c) ELAN microelectronics corp. 2022, All Rights Reserved
+
+  Module Name:
+	ElanTsUhidUtility.h
+
+  Environment:
+	All kinds of Linux-like Platform.
+
+********************************************************************
+ Revision History
+
+**/
+
+#ifndef _ELAN_TS_UHID_UTILITY_H_
+#define _ELAN_TS_UHID_UTILITY_H_
+
+#include <pthread.h>		/* pthread_t */
+#include "ElanTsLogUtility.h"
+
+/*******************************************
+ * Definitions
+ ******************************************/
+
+// uhid Character Device
+#ifndef UHID_DEV_PATH
+#define UHID_DEV_PATH				"/dev/uhid"
+#endif //UHID_DEV_PATH
+
+// Time to Wait for hidraw Node of Virtual Device after Creation
+#ifndef UHID_START_TIMEOUT_MSEC
+#define UHID_START_TIMEOUT_MSEC		2000
+#endif //UHID_START_TIMEOUT_MSEC
+
+// Max. Time Server Thread Waits for uhid Event (Stop Request is Checked in Between)
+#ifndef UHID_POLL_INTERVAL_MSEC
+#define UHID_POLL_INTERVAL_MSEC		100
+#endif //UHID_POLL_INTERVAL_MSEC
+
+/*******************************************
+ * Data Structure Declaration
+ ******************************************/
+
+class CI2CHIDSimulatorGet;
+
+// Virtual Device Created through uhid, Served by Simulated Controller on Its Own Thread
+typedef struct uhid_standin
+{
+    int fd;									// /dev/uhid
+    pthread_t thread;						// Server thread
+    bool thread_created;
+    volatile bool stop;						// Set to end server thread
+    volatile bool started;					// UHID_START received (HID driver bound)
+    CI2CHIDSimulatorGet *p_simulator;		// Controller model answering output reports
+    char phys[64];							// HID_PHYS, identifies virtual device among hidraw nodes
+    char hidraw_path[64];					// ex: /dev/hidraw3
+    unsigned long output_reports;			// Output reports received from hidraw
+    unsigned long input_reports;			// Input reports delivered to hidraw
+} UHID_STANDIN, *PUHID_STANDIN;
+
+/*******************************************
+ * Global Variables Declaration
+ ******************************************/
+
+/*******************************************
+ * Extern Variables Declaration
+ ******************************************/
+
+/*******************************************
+ * Function Prototype
+ ******************************************/
+
+// Virtual Device (p_config: Simulator Config, ex: "gen8,delay=500")
+int uhid_standin_start(const char *p_config, struct uhid_standin *p_standin);
+void uhid_standin_stop(struct uhid_standin *p_standin);
+
+#endif //_ELAN_TS_UHID_UTILITY_H_
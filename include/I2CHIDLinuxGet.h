@@ -9,11 +9,12 @@
 #include <cstdlib>
 #include <cstring>
 #include <semaphore.h>			/* semaphore */
-#include <sys/select.h>         /* select */
+#include <poll.h>               /* poll */
 #include <sys/time.h>           /* timeval */
 #include <errno.h>              /* errno */
 #include "InterfaceGet.h"
 #include "BaseLog.h"
+#include "ElanTsTraceUtility.h"
 
 //////////////////////////////////////////////////////////////////////
 // Version of Interface Implementation
@@ -43,6 +44,22 @@ const int ELAN_HID_CONNECT_RETRY = 20;
 const int ELAN_I2CHID_OUTPUT_BUFFER_SIZE = 0x21; //1+32
 const int ELAN_I2CHID_INPUT_BUFFER_SIZE  = 0x41; //1+64
 
+/* Input Reports (Finger / Pen) Kept while Waiting for Command Response */
+const int ELAN_HID_INPUT_REPORT_RING_SIZE = 16;
+
+/* Max Reports Drained before Command (Keep Report Flood from Stalling Command) */
+const int ELAN_HID_DRAIN_REPORT_MAX = 64;
+
+/* Report Slots Lent to Callers by ReadReportView() / ReadDataView() (Cache Line Aligned) */
+const int ELAN_HID_REPORT_SLOT_COUNT = 4;
+const int ELAN_HID_REPORT_SLOT_ALIGN = 64;
+const int ELAN_HID_REPORT_SLOT_STRIDE = 128; // ELAN_I2CHID_INPUT_BUFFER_SIZE rounded up to ELAN_HID_REPORT_SLOT_ALIGN
+
+/* Report Class of Incoming Report */
+const int ELAN_HID_REPORT_CLASS_UNKNOWN          = 0;
+const int ELAN_HID_REPORT_CLASS_COMMAND_RESPONSE = 1;
+const int ELAN_HID_REPORT_CLASS_INPUT            = 2;
+
 #ifndef __ELAN_HID_DEFINITION__
 // ELAN Default VID
 #ifndef ELAN_USB_VID
@@ -109,6 +126,7 @@ public:
 
     // Basic Functions
     int GetDeviceHandle(int nVID, int nPID);
+    int GetDeviceHandleByPath(const char *pszDevicePath, int nVID, int nPID);
     void Close(void);
     bool IsConnected(void);
 
@@ -126,6 +144,11 @@ public:
     // Modify by Johnny 20171123
     int ReadGhostRawBytes(unsigned char* pszBuf, int nLen, int nTimeout = ELAN_READ_DATA_TIMEOUT_MSEC, int nDevIdx = 0);
 
+    // Zero-Copy Read (Report Received Straight into Slot of Interface, View Valid until Released)
+    int ReadReportView(const unsigned char** ppszReport, int* pnReportLen, int nTimeout = ELAN_READ_DATA_TIMEOUT_MSEC, int nDevIdx = 0);
+    int ReadDataView(const unsigned char** ppszData, int nDataLen, int nTimeout = ELAN_READ_DATA_TIMEOUT_MSEC, int nDevIdx = 0, bool bFilter = true);
+    void ReleaseReportView(const unsigned char* pszView);
+
     // Buffer Size Info.
     int GetInBufferSize(void);
     int GetOutBufferSize(void);
@@ -133,15 +156,36 @@ public:
     // PID
     int	GetDevVidPid(unsigned int* p_nVid, unsigned int* p_nPid, int nDevIdx = 0);
 
+    // Read Deadline & Latency
+    int SetReadDeadline(int nTimeoutMS);
+    int ClearReadDeadline(void);
+    int GetLastReadLatency(unsigned long long* p_ullLatencyUS);
+
+    // Input Reports Routed Away from Command Responses
+    int PopInputReport(unsigned char* pszBuf, int nBufLen);
+    int DrainInputReports(unsigned long* p_ulDiscardedReports);
+    int GetReportStatistics(unsigned long* p_ulCommandReports, unsigned long* p_ulInputReports, unsigned long* p_ulDroppedReports, unsigned long* p_ulUnknownReports, unsigned long* p_ulDiscardedReports);
+
+    // HID Transaction Trace (Every Output / Input Report Recorded to Binary Trace File)
+    int StartTrace(const char *pszTraceFilePath);
+    void StopTrace(void);
+
 protected:
     // Basic Functions
 
     const char* bus_str(int bus);
     int FindHidrawDevice(int nVID, int nPID, char *pszDevicePath);
+    int OpenHidrawDevice(const char *pszDevicePath);
+    int WaitForInputReport(int nTimeout);
+    virtual int ReceiveReport(unsigned char* pszReport, int nTimeout, int* pnReportLen);
+    int ClassifyReport(unsigned char* pszReport);
+    void PushInputReport(unsigned char* pszReport);
+    void TraceReport(TRACE_DIRECTION direction, unsigned char* pszReport, int nReportLen);
 
     int m_nHidrawFd;
-    fd_set m_fdsHidraw;
-    struct timeval m_tvRead;
+    struct pollfd m_pfdHidraw;                  // Registered once when device opened
+    unsigned long long m_ullReadDeadlineUS;     // Absolute deadline on CLOCK_MONOTONIC (0: none)
+    unsigned long long m_ullLastReadLatencyUS;  // Time waited for the last input report
 
     unsigned char *m_inBuf;
     unsigned char *m_outBuf;
@@ -155,5 +199,24 @@ protected:
 
     unsigned char m_szOutputBuf[32 /* ELAN_USB_OUTPUT_LEN */];    // Command Raw Buffer
     unsigned char m_szInputBuf[128 /* ELAN_USB_INPUT_LEN * 2 */]; // Data Raw Buffer
+
+    // Report Slots (ELAN_HID_REPORT_SLOT_COUNT x ELAN_HID_REPORT_SLOT_STRIDE Bytes, Aligned)
+    unsigned char *m_pReportSlots;
+    bool m_bReportSlotInUse[ELAN_HID_REPORT_SLOT_COUNT];
+
+    // Input Report Ring (Oldest Report Overwritten when Full)
+    unsigned char m_szInputReportRing[ELAN_HID_INPUT_REPORT_RING_SIZE][ELAN_I2CHID_INPUT_BUFFER_SIZE];
+    unsigned int m_nInputReportRingHead;
+    unsigned int m_nInputReportRingCount;
+
+    // Report Statistics
+    unsigned long m_ulCommandReportCount;
+    unsigned long m_ulInputReportCount;
+    unsigned long m_ulDroppedReportCount;
+    unsigned long m_ulUnknownReportCount;
+    unsigned long m_ulDiscardedReportCount;
+
+    // HID Transaction Trace
+    struct trace_writer m_traceWriter;
 };
 #endif //__I2CHIDLINUXGET_H__
@@ -0,0 +1,49 @@
+// I2CHIDQueuedReportGet.h: Declaration for the CI2CHIDQueuedReportGet class.
+//
+// Transport of reports queued in memory with ready times, shared by
+// backends standing in for hidraw (simulated controller, trace replay).
+// A backend only implements NextReport(); waiting for a report up to the
+// read deadline and draining input reports are done here, the same way
+// CI2CHIDLinuxGet does on hidraw fd.
+//
+//////////////////////////////////////////////////////////////////////
+
+#ifndef __I2CHIDQUEUEDREPORTGET_H__
+#define __I2CHIDQUEUEDREPORTGET_H__
+
+#include "I2CHIDLinuxGet.h"
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDQueuedReportGet Class
+
+class CI2CHIDQueuedReportGet: public CI2CHIDLinuxGet
+{
+public:
+    // Constructor / Deconstructor
+    CI2CHIDQueuedReportGet(char *pszLogDirPath = (char *)DEFAULT_DEBUG_LOG_DIR, char *pszDebugLogFileName = (char *)DEFAULT_DEBUG_LOG_FILE);
+    ~CI2CHIDQueuedReportGet(void);
+
+    // Basic Functions
+    bool IsConnected(void);
+
+    // Input Reports Routed Away from Command Responses
+    int DrainInputReports(unsigned long* p_ulDiscardedReports);
+
+protected:
+    // Transport (Report Read by ReadRawBytes(), ReadReportView() & ReadData() of CI2CHIDLinuxGet)
+    int ReceiveReport(unsigned char* pszReport, int nTimeout, int* pnReportLen);
+
+    // Report Queue of Backend
+    // Take the next report if ready at ullNowUS
+    // Return TP_SUCCESS if taken, TP_ERR_TIMEOUT if next report not ready yet
+    // (ready time in *p_ullReadyUS), TP_ERR_DATA_NOT_FOUND if nothing comes.
+    virtual int NextReport(unsigned char* pszReport, unsigned long long ullNowUS, unsigned long long* p_ullReadyUS) = 0;
+
+    // Time Actually Waited for a Read Timeout (in Microsecond)
+    virtual unsigned long long ScaleWaitTime(unsigned long long ullWaitUS);
+
+    void SleepUntil(unsigned long long ullTimeUS);
+
+    bool m_bConnected;
+};
+#endif //__I2CHIDQUEUEDREPORTGET_H__
@@ -0,0 +1,91 @@
+// I2CHIDReplayGet.h: Declaration for the CI2CHIDReplayGet class.
+//
+// Replay of HID transaction trace recorded by CI2CHIDLinuxGet::StartTrace(),
+// so a field failure or a slow device can be reproduced without the device.
+// Each output report is matched against the next output report of the trace,
+// and input reports recorded after it are released with their original delay
+// to that output report (divided by replay speed).
+//
+//////////////////////////////////////////////////////////////////////
+
+#ifndef __I2CHIDREPLAYGET_H__
+#define __I2CHIDREPLAYGET_H__
+
+#include "I2CHIDQueuedReportGet.h"
+
+//////////////////////////////////////////////////////////////////////
+// Version of Interface Implementation
+//////////////////////////////////////////////////////////////////////
+#ifndef I2CHID_REPLAY_INTF_IMPL_VER
+#define I2CHID_REPLAY_INTF_IMPL_VER	"I2CHIDReplayGet Version : 0.0.0.1"
+#endif //I2CHID_REPLAY_INTF_IMPL_VER
+
+//////////////////////////////////////////////////////////////////////
+// Definitions
+//////////////////////////////////////////////////////////////////////
+
+/* Replay Speed */
+const unsigned int REPLAY_SPEED_ORIGINAL	= 1;	// Original timing
+const unsigned int REPLAY_SPEED_NO_WAIT		= 0;	// Reports released at once, timeouts not waited
+
+/////////////////////////////////////////////////////////////////////////////
+// Replay Statistics
+
+struct replay_statistics
+{
+    unsigned long ulMatchedWrites;		// Output reports identical to trace
+    unsigned long ulDivergedWrites;		// Output reports differing from trace (or after end of trace)
+    unsigned long ulReplayedReports;	// Input reports delivered (read or drained)
+    unsigned long ulSkippedReports;		// Input reports of trace never read before next output report
+};
+typedef struct replay_statistics structReplayStatistics;
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDReplayGet Class
+
+class CI2CHIDReplayGet: public CI2CHIDQueuedReportGet
+{
+public:
+    // Constructor / Deconstructor
+    CI2CHIDReplayGet(char *pszLogDirPath = (char *)DEFAULT_DEBUG_LOG_DIR, char *pszDebugLogFileName = (char *)DEFAULT_DEBUG_LOG_FILE);
+    ~CI2CHIDReplayGet(void);
+
+    // Trace to Replay
+    // nSpeed: N for N times faster than recorded (REPLAY_SPEED_ORIGINAL / REPLAY_SPEED_NO_WAIT)
+    int LoadTrace(const char *pszTraceFilePath, unsigned int nSpeed = REPLAY_SPEED_ORIGINAL);
+    void GetReplayStatistics(structReplayStatistics *pStatistics);
+
+    // Interface Info.
+    int GetInterfaceType(void);
+    const char* GetInterfaceVersion(void);
+
+    // Basic Functions
+    int GetDeviceHandle(int nVID, int nPID);
+    void Close(void);
+
+    // Raw Data Access Functions
+    int WriteRawBytes(unsigned char* pszBuf, int nLen, int nTimeout = ELAN_WRITE_DATA_TIMEOUT_MSEC, int nDevIdx = 0);
+
+protected:
+    // Report Queue (Input Reports of Trace up to Next Output Report)
+    int NextReport(unsigned char* pszReport, unsigned long long ullNowUS, unsigned long long* p_ullReadyUS);
+    unsigned long long ScaleWaitTime(unsigned long long ullWaitUS);
+
+    void ReleaseTrace(void);
+    unsigned long long ScaleTime(unsigned long long ullTraceUS);
+
+    unsigned int m_nSpeed;
+
+    // Trace
+    struct trace_header m_traceHeader;
+    struct trace_record *m_pRecords;
+    int m_nRecordCount;
+    int m_nCursor;							// Next record to replay
+
+    // Timing Anchor (Last Matched Output Report)
+    unsigned long long m_ullAnchorHostUS;	// Host time the output report was written
+    unsigned long long m_ullAnchorTraceUS;	// Trace time of the output report
+
+    structReplayStatistics m_statistics;
+};
+#endif //__I2CHIDREPLAYGET_H__
@@ -0,0 +1,133 @@
+// I2CHIDSimulatorGet.h: Declaration for the CI2CHIDSimulatorGet class.
+//
+// Software Elan touch controller behind I2C-HID, so protocol layer
+// (command / response routing, frame streaming, deadlines) can be
+// measured without a physical panel.
+// Only raw report I/O is replaced (reports queued with ready times, see
+// CI2CHIDQueuedReportGet); WriteCommand(), ReadData() and input report
+// routing of CI2CHIDLinuxGet are exercised as they are.
+//
+//////////////////////////////////////////////////////////////////////
+
+#ifndef __I2CHIDSIMULATORGET_H__
+#define __I2CHIDSIMULATORGET_H__
+
+#include "I2CHIDQueuedReportGet.h"
+
+//////////////////////////////////////////////////////////////////////
+// Version of Interface Implementation
+//////////////////////////////////////////////////////////////////////
+#ifndef I2CHID_SIMULATOR_INTF_IMPL_VER
+#define I2CHID_SIMULATOR_INTF_IMPL_VER	"I2CHIDSimulatorGet Version : 0.0.0.1"
+#endif //I2CHID_SIMULATOR_INTF_IMPL_VER
+
+//////////////////////////////////////////////////////////////////////
+// Definitions
+//////////////////////////////////////////////////////////////////////
+
+/* Reports Waiting to be Read (Responses in Flight) */
+const int SIMULATOR_REPORT_QUEUE_SIZE = 256;
+
+/* ROM Image: 64K Words (Gen5/6/7), or 128KB from Information ROM (Gen8) */
+const int SIMULATOR_ROM_SIZE = 0x20000;
+
+/* Page Data Received by Frame Data Commands before Flash Write (30-Page Block) */
+const int SIMULATOR_PAGE_BUFFER_SIZE = 132 * 30;
+
+/* Default Timing (in Microsecond) */
+const unsigned int SIMULATOR_DEFAULT_RESPONSE_DELAY_US	= 1000;		// Command to first response report
+const unsigned int SIMULATOR_DEFAULT_FRAME_INTERVAL_US	= 250;		// Between reports of one response
+const unsigned int SIMULATOR_DEFAULT_FLASH_PAGE_US		= 12000;	// Flash write / erase of one page
+
+/////////////////////////////////////////////////////////////////////////////
+// Simulated Controller Configuration
+
+struct simulator_config
+{
+    bool bGen8Touch;					// Gen8 (EM32F90x) instead of Gen5/6/7
+    bool bRecovery;						// Boot code (recovery mode) instead of main code
+    unsigned short usPID;				// PID of simulated HID device
+    unsigned short usFwID;				// FW ID (0x53 0xf0)
+    unsigned short usFwVersion;			// FW Version (0x53 0x00), high byte is solution ID
+    unsigned short usTestVersion;		// Test Version (0x53 0xe0)
+    unsigned short usFwBcVersion;		// BC Version (0x53 0x10) of main code
+    unsigned short usBcBcVersion;		// BC Version in hello packet
+    unsigned short usInfoFwID;			// FWID in information ROM
+    unsigned int nResponseDelayUS;		// Command to first response report
+    unsigned int nFrameIntervalUS;		// Between reports of one response
+    unsigned int nFlashPageUS;			// Flash write / erase of one page
+    unsigned int nTouchReportHz;		// Finger reports injected per second (0: none)
+};
+typedef struct simulator_config structSimulatorConfig;
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDSimulatorGet Class
+
+class CI2CHIDSimulatorGet: public CI2CHIDQueuedReportGet
+{
+public:
+    // Constructor / Deconstructor
+    CI2CHIDSimulatorGet(char *pszLogDirPath = (char *)DEFAULT_DEBUG_LOG_DIR, char *pszDebugLogFileName = (char *)DEFAULT_DEBUG_LOG_FILE);
+    ~CI2CHIDSimulatorGet(void);
+
+    // Simulated Controller Configuration
+    // pszConfig: Comma-separated items, ex: "gen8,recovery,delay=500,frame=100,flash=5000,touch=120,fwid=2a03,pid=2a03"
+    int SetConfig(const char *pszConfig);
+    void GetConfig(structSimulatorConfig *pConfig);
+
+    // Interface Info.
+    int GetInterfaceType(void);
+    const char* GetInterfaceVersion(void);
+
+    // Basic Functions
+    int GetDeviceHandle(int nVID, int nPID);
+    void Close(void);
+
+    // Raw Data Access Functions
+    int WriteRawBytes(unsigned char* pszBuf, int nLen, int nTimeout = ELAN_WRITE_DATA_TIMEOUT_MSEC, int nDevIdx = 0);
+
+    // Take Next Report without Waiting (Reports Served to Another Transport, ex: uhid)
+    int TakeReport(unsigned char* pszBuf, int nLen, unsigned long long* p_ullReadyUS);
+
+protected:
+    // Controller Model
+    void ResetController(void);
+    void LoadRomImage(void);
+    void HandleCommand(unsigned char* pszCommand, int nCommandLen);
+    void HandleGen8Command(unsigned char* pszCommand, int nCommandLen);
+    void HandleFrameData(unsigned char* pszReport);
+    void HandleFlashWrite(void);
+    void HandleEraseFlashSection(unsigned char* pszReport);
+    void HandleHelloPacketRequest(void);
+    void HandleShowBulkRomData(unsigned short usAddr, unsigned short usWordCount, bool bStream);
+    unsigned short GetRomWord(unsigned short usAddr);
+    unsigned char GetGen8RomByte(unsigned int nAddr);
+
+    // Report Queue
+    void QueueResponse(unsigned char* pszData, int nDataLen, unsigned int nExtraDelayUS);
+    void QueueVersionResponse(unsigned char ucType, unsigned short usVersion);
+    int NextReport(unsigned char* pszReport, unsigned long long ullNowUS, unsigned long long* p_ullReadyUS);
+    void BuildTouchReport(unsigned char* pszReport);
+
+    structSimulatorConfig m_config;
+
+    // Controller State
+    bool m_bFlashKey;				// Flash key written, flash write / IAP allowed
+    bool m_bIapMode;				// Boot code entered by IAP command
+    bool m_bTestMode;
+    unsigned char m_szRom[SIMULATOR_ROM_SIZE];
+    unsigned char m_szPageBuf[SIMULATOR_PAGE_BUFFER_SIZE];
+    int m_nPageBufLen;				// End of frame data received
+
+    // Response Reports (FIFO, Ready Time Never Decreases as Controller Handles Commands One by One)
+    unsigned char m_szReportQueue[SIMULATOR_REPORT_QUEUE_SIZE][ELAN_I2CHID_INPUT_BUFFER_SIZE];
+    unsigned long long m_ullReportReadyUS[SIMULATOR_REPORT_QUEUE_SIZE];
+    unsigned int m_nReportQueueHead;
+    unsigned int m_nReportQueueCount;
+    unsigned long long m_ullLastReadyUS;	// Ready time of the last queued report
+
+    // Injected Finger Reports
+    unsigned long long m_ullNextTouchUS;	// Ready time of the next finger report (0: none)
+    unsigned int m_nTouchReportIndex;
+};
+#endif //__I2CHIDSIMULATORGET_H__
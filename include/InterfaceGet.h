@@ -42,6 +42,8 @@ const int INTF_TYPE_I2C_CHROME_LINUX			= 5;
 const int INTF_TYPE_ELAN_I2CHID_LINUX			= 6;
 const int INTF_TYPE_SOCKET						= 7;
 const int INTF_TYPE_ELAN_I2CHID_CHROME_LINUX	= 8;
+const int INTF_TYPE_ELAN_I2CHID_SIMULATOR		= 9;
+const int INTF_TYPE_ELAN_I2CHID_REPLAY			= 10;
 
 // General Data Length Setting
 const int MAX_LENGTH = 256;
@@ -153,6 +155,21 @@ public:
 
     virtual int GetDevVidPid(unsigned int* p_nVid, unsigned int* p_nPid, int nDevIdx) { return TP_ERR_COMMAND_NOT_SUPPORT; }
 
+    // option. Read deadline shared by all reads of a multi-frame operation (Only for Linux/I2CHID)
+    virtual int SetReadDeadline(int nTimeoutMS)							{ return TP_ERR_COMMAND_NOT_SUPPORT; }
+    virtual int ClearReadDeadline(void)									{ return TP_ERR_COMMAND_NOT_SUPPORT; }
+    virtual int GetLastReadLatency(unsigned long long* p_ullLatencyUS)	{ return TP_ERR_COMMAND_NOT_SUPPORT; }
+
+    // option. Input reports (finger / pen) received while waiting for command response (Only for Linux/I2CHID)
+    virtual int PopInputReport(unsigned char* pszBuf, int nBufLen)		{ return TP_ERR_COMMAND_NOT_SUPPORT; }
+    virtual int DrainInputReports(unsigned long* p_ulDiscardedReports)	{ return TP_ERR_COMMAND_NOT_SUPPORT; }
+    virtual int GetReportStatistics(unsigned long* p_ulCommandReports, unsigned long* p_ulInputReports, unsigned long* p_ulDroppedReports, unsigned long* p_ulUnknownReports, unsigned long* p_ulDiscardedReports) { return TP_ERR_COMMAND_NOT_SUPPORT; }
+
+    // option. Zero-copy read, view into report slot of interface valid until released (Only for Linux/I2CHID)
+    virtual int ReadReportView(const unsigned char** ppszReport, int* pnReportLen, int nTimeoutMS, int nDevIdx) { return TP_ERR_COMMAND_NOT_SUPPORT; }
+    virtual int ReadDataView(const unsigned char** ppszData, int nDataLen, int nTimeoutMS, int nDevIdx, bool bFilter) { return TP_ERR_COMMAND_NOT_SUPPORT; }
+    virtual void ReleaseReportView(const unsigned char* pszView) { return; }
+
     // option. Only for Linux/I2C
     virtual int SwitchChip(int nChipID)			{ return TP_ERR_COMMAND_NOT_SUPPORT; }
     virtual int EnableDriverIRQ(bool bEnable)	{ return TP_ERR_COMMAND_NOT_SUPPORT; }
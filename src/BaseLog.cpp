@@ -7,6 +7,10 @@
 #include <stdarg.h>
 #ifdef __linux__
 #include <unistd.h>
+#include <stdlib.h>
+#include <fcntl.h>  /* open */
+#include <signal.h> /* sigaction */
+#include <sched.h>  /* sched_yield */
 #else
 #include <io.h>
 #endif //__linux__
@@ -26,6 +30,32 @@
 #endif //S_ISDIR
 #endif //_WIN32
 
+#ifdef __ENABLE_ASYNC_LOG__
+// Ring & Writer Thread (One per Process)
+typedef struct async_log_backend
+{
+    PASYNC_LOG_SLOT pRing;
+    volatile unsigned long nHead;		// Next Position Claimed by Producers
+    volatile unsigned long nTail;		// Next Position Taken by Writer Thread
+    volatile unsigned long nWritten;	// Lines Already Written to Log File
+    volatile int nWriterIdle;
+    volatile int nWriterBusy;	// Writer Thread Taking / Writing Batch
+    volatile int nStop;
+    volatile int nEmergency;	// Set by Fatal Signal Handler, Writer Thread Takes No More Lines
+    volatile int nFd;
+    int nRefCount;				// Loggers Sharing Writer Thread
+    bool bWriterRunning;
+    pthread_t tWriter;
+    sem_t semWakeup;
+    char szFilePath[PATH_LEN_MAX];
+
+    // Batch in Hand of Writer Thread (Not on Its Stack, so Fatal Signal Handler Can Finish It)
+    char szBatch[ASYNC_LOG_BATCH_SIZE];
+    volatile size_t nBatchLen;
+    volatile size_t nBatchWrittenLen;
+} ASYNC_LOG_BACKEND;
+#endif //__ENABLE_ASYNC_LOG__
+
 //////////////////////////////////////////////////////////////////////
 // Global Variable
 //////////////////////////////////////////////////////////////////////
@@ -35,6 +65,21 @@ bool g_bEnableDebug = true;
 bool g_bEnableOutputBufferDebug = true;
 bool g_bEnableErrorMsg = true;
 
+#ifdef __ENABLE_LOG_FILE_DEBUG__
+// Log Files Cleared Only by First Logger of Process (Loggers of -M Workers & Watch Events Append to Same Files)
+static bool s_bLogFilesCleared = false;
+#ifdef __linux__
+static pthread_mutex_t s_mutexLogFilesCleared = PTHREAD_MUTEX_INITIALIZER;
+#endif //__linux__
+#endif //__ENABLE_LOG_FILE_DEBUG__
+
+#ifdef __ENABLE_ASYNC_LOG__
+// Log Writer Shared by All Loggers (Log File Path is Process-Wide; Flushed by atexit() & Fatal Signal Handler)
+static ASYNC_LOG_BACKEND s_AsyncLog;
+static pthread_mutex_t s_mutexAsyncLog = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t s_onceAsyncLogHooks = PTHREAD_ONCE_INIT;
+#endif //__ENABLE_ASYNC_LOG__
+
 //////////////////////////////////////////////////////////////////////
 // Construction/Destruction
 //////////////////////////////////////////////////////////////////////
@@ -43,6 +88,7 @@ CBaseLog::CBaseLog(char *pszLogDirPath, char *pszDebugLogFileName)
 {
 #ifdef __ENABLE_LOG_FILE_DEBUG__
     struct stat file_stat;
+    bool bClearLogFiles = false;
     //printf("%s: pszLogDirPath=\"%s\", pszDebugLogFileName=\"%s\".\r\n", __func__, pszLogDirPath, pszDebugLogFileName);
 #endif //__ENABLE_LOG_FILE_DEBUG__
 
@@ -74,6 +120,13 @@ CBaseLog::CBaseLog(char *pszLogDirPath, char *pszDebugLogFileName)
 #endif //defined(__linux__) && defined(__ENABLE_SYSLOG_DEBUG__)
 
 #ifdef __ENABLE_LOG_FILE_DEBUG__
+    // Other Loggers Wait until First One Has Cleared Log Files
+#ifdef __linux__
+    pthread_mutex_lock(&s_mutexLogFilesCleared);
+#endif //__linux__
+    bClearLogFiles = (s_bLogFilesCleared == false);
+    s_bLogFilesCleared = true;
+
     // Initialize Debug Directory Path
     if (pszLogDirPath != NULL)
         SetLogDirPath(pszLogDirPath);
@@ -95,7 +148,7 @@ CBaseLog::CBaseLog(char *pszLogDirPath, char *pszDebugLogFileName)
 #endif //__linux__
 
         // Clear Content of Debug Log File
-        if (stat(m_szDebugLogFilePath, &file_stat) == 0)
+        if ((bClearLogFiles == true) && (stat(m_szDebugLogFilePath, &file_stat) == 0))
         {
             //CleanFileContentWithPath(DEFAULT_DEBUG_LOG_FILE);
             remove(m_szDebugLogFilePath);
@@ -124,13 +177,26 @@ CBaseLog::CBaseLog(char *pszLogDirPath, char *pszDebugLogFileName)
     //printf("%s: TestResultLogFileName=\"%s\", TestResultLogFilePath=\"%s\".\r\n", __func__, m_szTestResultLogFileName, m_szTestResultLogFilePath);
 
     // Clear Content of Debug Log File
-    if (stat(m_szTestResultLogFilePath, &file_stat) == 0)
+    if ((bClearLogFiles == true) && (stat(m_szTestResultLogFilePath, &file_stat) == 0))
         remove(m_szTestResultLogFilePath);
+#ifdef __linux__
+    pthread_mutex_unlock(&s_mutexLogFilesCleared);
+#endif //__linux__
 #endif //__ENABLE_LOG_FILE_DEBUG__
+
+#ifdef __ENABLE_ASYNC_LOG__
+    // Start Log Writer Thread (Log File Opened on First Write)
+    AsyncLogStart();
+#endif //__ENABLE_ASYNC_LOG__
 }
 
 CBaseLog::~CBaseLog(void)
 {
+#ifdef __ENABLE_ASYNC_LOG__
+    // Write All Buffered Lines & Stop Log Writer Thread
+    AsyncLogStop();
+#endif //__ENABLE_ASYNC_LOG__
+
 #if defined(__linux__) && defined(__ENABLE_SYSLOG_DEBUG__)
     // syslog
     closelog();
@@ -551,6 +617,10 @@ int CBaseLog::SetLogDirPath(char *pszDirPath)
 #endif // __linux__
             m_nFileIoLockCounter--;
         }
+
+#ifdef __ENABLE_ASYNC_LOG__
+        AsyncLogSetFilePath();
+#endif //__ENABLE_ASYNC_LOG__
     }
 
     // Move Test Result Log File If Exist
@@ -702,6 +772,10 @@ int CBaseLog::SetDebugLogFileName(char *pszFileName)
         m_nFileIoLockCounter--;
     }
 
+#ifdef __ENABLE_ASYNC_LOG__
+    AsyncLogSetFilePath();
+#endif //__ENABLE_ASYNC_LOG__
+
 SET_DEBUG_LOG_FILE_NAME_EXIT:
     return nRet;
 }
@@ -860,7 +934,7 @@ int CBaseLog::GetTestResultLogFilePath(char *pszFilePathBuffer)
 
 void CBaseLog::DebugLog(char *pszLog)
 {
-#ifdef __ENABLE_LOG_FILE_DEBUG__
+#if defined(__ENABLE_LOG_FILE_DEBUG__) && !defined(__ENABLE_ASYNC_LOG__)
     FILE *fd = NULL;
 #endif //__ENABLE_LOG_FILE_DEBUG__
 
@@ -868,6 +942,14 @@ void CBaseLog::DebugLog(char *pszLog)
     if (pszLog == NULL)
         goto DEBUG_LOG_EXIT;
 
+#ifdef __ENABLE_ASYNC_LOG__
+    // Lock-free: Line Formatted into Ring, File I/O Done by Log Writer Thread
+    AsyncLogFormat("DEBUG", "%s", pszLog);
+#ifndef __ENABLE_SYSLOG_DEBUG__
+    goto DEBUG_LOG_EXIT;
+#endif //__ENABLE_SYSLOG_DEBUG__
+#endif //__ENABLE_ASYNC_LOG__
+
     // Make Sure All Locks Unlocked
     assert(m_nFileIoLockCounter == 0);
 
@@ -883,7 +965,7 @@ void CBaseLog::DebugLog(char *pszLog)
     syslog(LOG_DEBUG, "%s\n", pszLog);
 #endif //__ENABLE_SYSLOG_DEBUG__
 
-#ifdef __ENABLE_LOG_FILE_DEBUG__
+#if defined(__ENABLE_LOG_FILE_DEBUG__) && !defined(__ENABLE_ASYNC_LOG__)
     fd = fopen(m_szDebugLogFilePath, "a+");
     if (fd == NULL)
     {
@@ -923,16 +1005,30 @@ DEBUG_LOG_EXIT:
 
 void CBaseLog::DebugLogFormat(const char *pszFormat, ...)
 {
-#ifdef __ENABLE_LOG_FILE_DEBUG__
+#if defined(__ENABLE_LOG_FILE_DEBUG__) && !defined(__ENABLE_ASYNC_LOG__)
     FILE *fd = NULL;
 #endif //__ENABLE_LOG_FILE_DEBUG__
+#if LOG_SINK_ENABLED && (!defined(__ENABLE_ASYNC_LOG__) || defined(__ENABLE_SYSLOG_DEBUG__))
     char szLogBuffer[LOG_BUF_SIZE] = {0};
+#endif //LOG_SINK_ENABLED && (!defined(__ENABLE_ASYNC_LOG__) || defined(__ENABLE_SYSLOG_DEBUG__))
+#if LOG_SINK_ENABLED
     va_list pArgs;
+#endif //LOG_SINK_ENABLED
 
     // Make Sure Log String Valid
     if (pszFormat == NULL)
         goto DEBUG_LOG_FORMAT_EXIT;
 
+#ifdef __ENABLE_ASYNC_LOG__
+    // Lock-free Async Log
+    va_start(pArgs, pszFormat);
+    AsyncLogFormatV("DEBUG", pszFormat, pArgs);
+    va_end(pArgs);
+#ifndef __ENABLE_SYSLOG_DEBUG__
+    goto DEBUG_LOG_FORMAT_EXIT;
+#endif //__ENABLE_SYSLOG_DEBUG__
+#endif //__ENABLE_ASYNC_LOG__
+
     // Make Sure All Locks Unlocked
     assert(m_nFileIoLockCounter == 0);
 
@@ -953,7 +1049,7 @@ void CBaseLog::DebugLogFormat(const char *pszFormat, ...)
     syslog(LOG_DEBUG, "%s\n", szLogBuffer);
 #endif //__ENABLE_SYSLOG_DEBUG__
 
-#ifdef __ENABLE_LOG_FILE_DEBUG__
+#if defined(__ENABLE_LOG_FILE_DEBUG__) && !defined(__ENABLE_ASYNC_LOG__)
     // Make Sure Log File Exist
     fd = fopen(m_szDebugLogFilePath, "a+");
     if (fd == NULL)
@@ -999,7 +1095,7 @@ DEBUG_LOG_FORMAT_EXIT:
 
 void CBaseLog::ErrorLog(char *pszLog)
 {
-#ifdef __ENABLE_LOG_FILE_DEBUG__
+#if defined(__ENABLE_LOG_FILE_DEBUG__) && !defined(__ENABLE_ASYNC_LOG__)
     FILE *fd = NULL;
 #endif //__ENABLE_LOG_FILE_DEBUG__
 
@@ -1007,6 +1103,14 @@ void CBaseLog::ErrorLog(char *pszLog)
     if (pszLog == NULL)
         goto ERROR_LOG_EXIT;
 
+#ifdef __ENABLE_ASYNC_LOG__
+    // Lock-free Async Log
+    AsyncLogFormat("ERROR", "%s", pszLog);
+#ifndef __ENABLE_SYSLOG_DEBUG__
+    goto ERROR_LOG_EXIT;
+#endif //__ENABLE_SYSLOG_DEBUG__
+#endif //__ENABLE_ASYNC_LOG__
+
     // Make Sure All Locks Unlocked
     assert(m_nFileIoLockCounter == 0);
 
@@ -1022,7 +1126,7 @@ void CBaseLog::ErrorLog(char *pszLog)
     syslog(LOG_ERR, "%s\n", pszLog);
 #endif //__ENABLE_SYSLOG_DEBUG__
 
-#ifdef __ENABLE_LOG_FILE_DEBUG__
+#if defined(__ENABLE_LOG_FILE_DEBUG__) && !defined(__ENABLE_ASYNC_LOG__)
     fd = fopen(m_szDebugLogFilePath, "a+");
     if (fd == NULL)
     {
@@ -1062,16 +1166,30 @@ ERROR_LOG_EXIT:
 
 void CBaseLog::ErrorLogFormat(const char *pszFormat, ...)
 {
-#ifdef __ENABLE_LOG_FILE_DEBUG__
+#if defined(__ENABLE_LOG_FILE_DEBUG__) && !defined(__ENABLE_ASYNC_LOG__)
     FILE *fd = NULL;
 #endif //__ENABLE_SYSLOG_DEBUG__
+#if LOG_SINK_ENABLED && (!defined(__ENABLE_ASYNC_LOG__) || defined(__ENABLE_SYSLOG_DEBUG__))
     char szLogBuffer[LOG_BUF_SIZE] = {0};
+#endif //LOG_SINK_ENABLED && (!defined(__ENABLE_ASYNC_LOG__) || defined(__ENABLE_SYSLOG_DEBUG__))
+#if LOG_SINK_ENABLED
     va_list pArgs;
+#endif //LOG_SINK_ENABLED
 
     // Make Sure Log String Valid
     if (pszFormat == NULL)
         goto ERROR_LOG_FORMAT_EXIT;
 
+#ifdef __ENABLE_ASYNC_LOG__
+    // Lock-free Async Log
+    va_start(pArgs, pszFormat);
+    AsyncLogFormatV("ERROR", pszFormat, pArgs);
+    va_end(pArgs);
+#ifndef __ENABLE_SYSLOG_DEBUG__
+    goto ERROR_LOG_FORMAT_EXIT;
+#endif //__ENABLE_SYSLOG_DEBUG__
+#endif //__ENABLE_ASYNC_LOG__
+
     // Make Sure All Locks Unlocked
     assert(m_nFileIoLockCounter == 0);
 
@@ -1092,7 +1210,7 @@ void CBaseLog::ErrorLogFormat(const char *pszFormat, ...)
     syslog(LOG_ERR, "%s\n", szLogBuffer);
 #endif //__ENABLE_SYSLOG_DEBUG__
 
-#ifdef __ENABLE_LOG_FILE_DEBUG__
+#if defined(__ENABLE_LOG_FILE_DEBUG__) && !defined(__ENABLE_ASYNC_LOG__)
     fd = fopen(m_szDebugLogFilePath, "a+");
     if (fd == NULL)
     {
@@ -1137,12 +1255,14 @@ ERROR_LOG_FORMAT_EXIT:
 
 void CBaseLog::DebugPrintBuffer(unsigned char *pbyBuf, int nLen)
 {
-#ifdef __ENABLE_LOG_FILE_DEBUG__
+#if defined(__ENABLE_LOG_FILE_DEBUG__) && !defined(__ENABLE_ASYNC_LOG__)
     FILE *fd = NULL;
 #endif //__ENABLE_LOG_FILE_DEBUG__
+#if LOG_SINK_ENABLED && (!defined(__ENABLE_ASYNC_LOG__) || defined(__ENABLE_SYSLOG_DEBUG__))
     int nIndex = 0;
     unsigned char *pbyData = NULL;
     char szBuffer[8] = { 0 };
+#endif //LOG_SINK_ENABLED && (!defined(__ENABLE_ASYNC_LOG__) || defined(__ENABLE_SYSLOG_DEBUG__))
 
     if (pbyBuf == NULL)
     {
@@ -1150,6 +1270,14 @@ void CBaseLog::DebugPrintBuffer(unsigned char *pbyBuf, int nLen)
         goto DEBUG_PRINT_BUFFER_EXIT;
     }
 
+#ifdef __ENABLE_ASYNC_LOG__
+    // Lock-free Async Log (Hex Dump Formatted Directly into Ring)
+    AsyncLogBuffer("buffer", pbyBuf, nLen);
+#ifndef __ENABLE_SYSLOG_DEBUG__
+    goto DEBUG_PRINT_BUFFER_EXIT;
+#endif //__ENABLE_SYSLOG_DEBUG__
+#endif //__ENABLE_ASYNC_LOG__
+
     // Make Sure All Locks Unlocked
     assert(m_nFileIoLockCounter == 0);
 
@@ -1174,7 +1302,7 @@ void CBaseLog::DebugPrintBuffer(unsigned char *pbyBuf, int nLen)
     syslog(LOG_DEBUG, "buffer[%d]=%s.\n", nIndex, m_szDebugBuf);
 #endif //__ENABLE_SYSLOG_DEBUG__
 
-#ifdef __ENABLE_LOG_FILE_DEBUG__
+#if defined(__ENABLE_LOG_FILE_DEBUG__) && !defined(__ENABLE_ASYNC_LOG__)
     fd = fopen(m_szDebugLogFilePath, "a+");
     if (fd == NULL)
     {
@@ -1223,12 +1351,14 @@ DEBUG_PRINT_BUFFER_EXIT:
 
 void CBaseLog::DebugPrintBuffer(const char *pszBufName, unsigned char *pbyBuf, int nLen)
 {
-#ifdef __ENABLE_LOG_FILE_DEBUG__
+#if defined(__ENABLE_LOG_FILE_DEBUG__) && !defined(__ENABLE_ASYNC_LOG__)
     FILE *fd = NULL;
 #endif //__ENABLE_LOG_FILE_DEBUG__
+#if LOG_SINK_ENABLED && (!defined(__ENABLE_ASYNC_LOG__) || defined(__ENABLE_SYSLOG_DEBUG__))
     int nIndex = 0;
     unsigned char *pbyData = NULL;
     char szBuffer[8] = { 0 };
+#endif //LOG_SINK_ENABLED && (!defined(__ENABLE_ASYNC_LOG__) || defined(__ENABLE_SYSLOG_DEBUG__))
 
     if ((!pszBufName) || (!pbyBuf))
     {
@@ -1236,6 +1366,14 @@ void CBaseLog::DebugPrintBuffer(const char *pszBufName, unsigned char *pbyBuf, i
         goto DEBUG_PRINT_BUFFER_2_EXIT;
     }
 
+#ifdef __ENABLE_ASYNC_LOG__
+    // Lock-free Async Log (Hex Dump Formatted Directly into Ring)
+    AsyncLogBuffer(pszBufName, pbyBuf, nLen);
+#ifndef __ENABLE_SYSLOG_DEBUG__
+    goto DEBUG_PRINT_BUFFER_2_EXIT;
+#endif //__ENABLE_SYSLOG_DEBUG__
+#endif //__ENABLE_ASYNC_LOG__
+
     // Make Sure All Locks Unlocked
     assert(m_nFileIoLockCounter == 0);
 
@@ -1260,7 +1398,7 @@ void CBaseLog::DebugPrintBuffer(const char *pszBufName, unsigned char *pbyBuf, i
     syslog(LOG_DEBUG, "%s[%d]=%s.\n", pszBufName, nIndex, m_szDebugBuf);
 #endif //__ENABLE_SYSLOG_DEBUG__
 
-#ifdef __ENABLE_LOG_FILE_DEBUG__
+#if defined(__ENABLE_LOG_FILE_DEBUG__) && !defined(__ENABLE_ASYNC_LOG__)
     fd = fopen(m_szDebugLogFilePath, "a+");
     if (fd == NULL)
     {
@@ -1307,3 +1445,470 @@ DEBUG_PRINT_BUFFER_2_EXIT:
     return;
 }
 
+void CBaseLog::Flush(void)
+{
+#ifdef __ENABLE_ASYNC_LOG__
+    unsigned long nTarget = s_AsyncLog.nHead;
+
+    if (s_AsyncLog.bWriterRunning == false)
+        return;
+
+    // Wait until Writer Thread Has Written All Lines Claimed before This Call
+    while ((long)(s_AsyncLog.nWritten - nTarget) < 0)
+    {
+        if (s_AsyncLog.nWriterIdle)
+            sem_post(&s_AsyncLog.semWakeup);
+        usleep(1000);
+    }
+#endif //__ENABLE_ASYNC_LOG__
+    return;
+}
+
+#ifdef __ENABLE_ASYNC_LOG__
+//////////////////////////////////////////////////////////////////////
+// Asynchronous Log Writer
+//////////////////////////////////////////////////////////////////////
+
+static void AsyncLogExitHandler(void)
+{
+    CBaseLog::Flush();
+    return;
+}
+
+static void AsyncLogFatalSignalHandler(int nSignal)
+{
+    CBaseLog::EmergencyFlush();
+
+    // Handler Reset by SA_RESETHAND, Default Action (Core Dump) Taken
+    raise(nSignal);
+    return;
+}
+
+static void AsyncLogInstallHooks(void)
+{
+    struct sigaction action;
+    int anSignals[] = {SIGSEGV, SIGBUS, SIGFPE, SIGILL, SIGABRT};
+    unsigned int nIndex = 0;
+
+    atexit(AsyncLogExitHandler);
+
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = AsyncLogFatalSignalHandler;
+    action.sa_flags = SA_RESETHAND;
+    sigemptyset(&action.sa_mask);
+    for (nIndex = 0; nIndex < (sizeof(anSignals) / sizeof(anSignals[0])); nIndex++)
+        sigaction(anSignals[nIndex], &action, NULL);
+
+    return;
+}
+
+// Writer Thread Started by First Logger, Stopped by Last One
+int CBaseLog::AsyncLogStart(void)
+{
+    int nRet = TP_SUCCESS,
+        nIndex = 0;
+
+    pthread_once(&s_onceAsyncLogHooks, AsyncLogInstallHooks);
+
+    pthread_mutex_lock(&s_mutexAsyncLog);
+    if (s_AsyncLog.nRefCount++ > 0)
+        goto ASYNC_LOG_START_EXIT;
+
+    s_AsyncLog.pRing = NULL;
+    s_AsyncLog.nHead = 0;
+    s_AsyncLog.nTail = 0;
+    s_AsyncLog.nWritten = 0;
+    s_AsyncLog.nWriterIdle = 0;
+    s_AsyncLog.nWriterBusy = 0;
+    s_AsyncLog.nStop = 0;
+    s_AsyncLog.nEmergency = 0;
+    s_AsyncLog.nFd = -1;
+    s_AsyncLog.bWriterRunning = false;
+    s_AsyncLog.nBatchLen = 0;
+    s_AsyncLog.nBatchWrittenLen = 0;
+    strcpy(s_AsyncLog.szFilePath, m_szDebugLogFilePath);
+    sem_init(&s_AsyncLog.semWakeup, 0, 0);
+
+    s_AsyncLog.pRing = (PASYNC_LOG_SLOT)malloc(sizeof(ASYNC_LOG_SLOT) * ASYNC_LOG_RING_SLOTS);
+    if (s_AsyncLog.pRing == NULL)
+    {
+        printf("%s: Fail to allocate log ring!\r\n", __func__);
+        nRet = TP_ERR_NO_INTERFACE_CREATE;
+        goto ASYNC_LOG_START_EXIT;
+    }
+    for (nIndex = 0; nIndex < ASYNC_LOG_RING_SLOTS; nIndex++)
+    {
+        s_AsyncLog.pRing[nIndex].nSequence = nIndex;
+        s_AsyncLog.pRing[nIndex].nLen = 0;
+    }
+
+    if (pthread_create(&s_AsyncLog.tWriter, NULL, AsyncLogWriterRoutine, NULL) != 0)
+    {
+        printf("%s: Fail to create log writer thread! (errno=%d)\r\n", __func__, errno);
+        free(s_AsyncLog.pRing);
+        s_AsyncLog.pRing = NULL;
+        nRet = TP_ERR_NO_INTERFACE_CREATE;
+        goto ASYNC_LOG_START_EXIT;
+    }
+    s_AsyncLog.bWriterRunning = true;
+
+ASYNC_LOG_START_EXIT:
+    pthread_mutex_unlock(&s_mutexAsyncLog);
+    return nRet;
+}
+
+void CBaseLog::AsyncLogStop(void)
+{
+    pthread_mutex_lock(&s_mutexAsyncLog);
+    if (--s_AsyncLog.nRefCount > 0)
+        goto ASYNC_LOG_STOP_EXIT;
+
+    if (s_AsyncLog.bWriterRunning == true)
+    {
+        // Writer Thread Drains Ring before Exit
+        s_AsyncLog.nStop = 1;
+        sem_post(&s_AsyncLog.semWakeup);
+        pthread_join(s_AsyncLog.tWriter, NULL);
+        s_AsyncLog.bWriterRunning = false;
+    }
+
+    if (s_AsyncLog.nFd >= 0)
+    {
+        close(s_AsyncLog.nFd);
+        s_AsyncLog.nFd = -1;
+    }
+
+    if (s_AsyncLog.pRing != NULL)
+    {
+        free(s_AsyncLog.pRing);
+        s_AsyncLog.pRing = NULL;
+    }
+
+    sem_destroy(&s_AsyncLog.semWakeup);
+
+ASYNC_LOG_STOP_EXIT:
+    pthread_mutex_unlock(&s_mutexAsyncLog);
+    return;
+}
+
+// Log File Path Changed by Set*Path Functions (Taken by Writer Thread if Log File Not Opened Yet)
+void CBaseLog::AsyncLogSetFilePath(void)
+{
+    pthread_mutex_lock(&s_mutexAsyncLog);
+    if (s_AsyncLog.nRefCount > 0)
+        strcpy(s_AsyncLog.szFilePath, m_szDebugLogFilePath);
+    pthread_mutex_unlock(&s_mutexAsyncLog);
+
+    return;
+}
+
+// Claim Next Free Slot (Multiple Producers, No Lock); Wait for Writer Thread if Ring is Full
+PASYNC_LOG_SLOT CBaseLog::AsyncLogAcquireSlot(unsigned long *pnPosition)
+{
+    PASYNC_LOG_SLOT pSlot = NULL;
+    unsigned long nPosition = 0;
+    long nDiff = 0;
+
+    if ((s_AsyncLog.pRing == NULL) || (s_AsyncLog.bWriterRunning == false))
+        return NULL;
+
+    nPosition = s_AsyncLog.nHead;
+    while (1)
+    {
+        pSlot = &s_AsyncLog.pRing[nPosition & (ASYNC_LOG_RING_SLOTS - 1)];
+        nDiff = (long)(pSlot->nSequence - nPosition);
+        if (nDiff == 0)
+        {
+            // Slot Free: Take It if No Other Producer Did
+            if (__sync_bool_compare_and_swap(&s_AsyncLog.nHead, nPosition, nPosition + 1))
+                break;
+        }
+        else if (nDiff < 0)
+        {
+            // Ring Full: Lines are Never Dropped
+            if (s_AsyncLog.nWriterIdle)
+                sem_post(&s_AsyncLog.semWakeup);
+            sched_yield();
+        }
+        nPosition = s_AsyncLog.nHead;
+    }
+
+    *pnPosition = nPosition;
+    return pSlot;
+}
+
+void CBaseLog::AsyncLogPublishSlot(PASYNC_LOG_SLOT pSlot, unsigned long nPosition)
+{
+    // Line Content Visible before Slot Marked Ready
+    __sync_synchronize();
+    pSlot->nSequence = nPosition + 1;
+    __sync_synchronize();
+
+    // Wake up Writer Thread Only when It Sleeps
+    if (s_AsyncLog.nWriterIdle)
+        sem_post(&s_AsyncLog.semWakeup);
+
+    return;
+}
+
+// "YYYY-mm-dd HH:MM:SS:mmm:uuu [LEVEL] ", Date Part Cached per Second per Thread
+int CBaseLog::AsyncLogFormatTimestamp(char *pszBuf, int nSize, const char *pszLevel)
+{
+    static __thread time_t tCachedSecond = (time_t)-1;
+    static __thread char szCachedDate[32];
+    struct timeval tvCurTime;
+    struct tm tmCurTime;
+    int nLen = 0;
+
+    gettimeofday(&tvCurTime, NULL);
+    if (tvCurTime.tv_sec != tCachedSecond)
+    {
+        localtime_r(&tvCurTime.tv_sec, &tmCurTime);
+        strftime(szCachedDate, sizeof(szCachedDate), "%Y-%m-%d %H:%M:%S", &tmCurTime);
+        tCachedSecond = tvCurTime.tv_sec;
+    }
+
+    nLen = snprintf(pszBuf, nSize, "%s:%03d:%03d [%s] ", szCachedDate, \
+                    (int)tvCurTime.tv_usec / 1000, (int)tvCurTime.tv_usec % 1000, pszLevel);
+    if (nLen >= nSize)
+        nLen = nSize - 1;
+
+    return nLen;
+}
+
+void CBaseLog::AsyncLogFormatV(const char *pszLevel, const char *pszFormat, va_list pArgs)
+{
+    PASYNC_LOG_SLOT pSlot = NULL;
+    unsigned long nPosition = 0;
+    int nLen = 0,
+        nMsgLen = 0;
+
+    pSlot = AsyncLogAcquireSlot(&nPosition);
+    if (pSlot == NULL)
+        return;
+
+    // Formatted Once, Directly into Slot (Room Kept for '\n')
+    nLen = AsyncLogFormatTimestamp(pSlot->szLine, ASYNC_LOG_LINE_MAX - 1, pszLevel);
+    nMsgLen = vsnprintf(&pSlot->szLine[nLen], ASYNC_LOG_LINE_MAX - 1 - nLen, pszFormat, pArgs);
+    if (nMsgLen < 0)
+        nMsgLen = 0;
+    else if (nMsgLen > (ASYNC_LOG_LINE_MAX - 2 - nLen))
+        nMsgLen = ASYNC_LOG_LINE_MAX - 2 - nLen; // Truncated
+    nLen += nMsgLen;
+    pSlot->szLine[nLen++] = '\n';
+    pSlot->nLen = nLen;
+
+    AsyncLogPublishSlot(pSlot, nPosition);
+    return;
+}
+
+void CBaseLog::AsyncLogFormat(const char *pszLevel, const char *pszFormat, ...)
+{
+    va_list pArgs;
+
+    va_start(pArgs, pszFormat);
+    AsyncLogFormatV(pszLevel, pszFormat, pArgs);
+    va_end(pArgs);
+
+    return;
+}
+
+// "<timestamp> [DEBUG] <name>[<len>]= xx xx ... xx."
+void CBaseLog::AsyncLogBuffer(const char *pszBufName, unsigned char *pbyBuf, int nLen)
+{
+    static const char szHexDigits[] = "0123456789abcdef";
+    PASYNC_LOG_SLOT pSlot = NULL;
+    unsigned long nPosition = 0;
+    int nLineLen = 0,
+        nIndex = 0;
+
+    pSlot = AsyncLogAcquireSlot(&nPosition);
+    if (pSlot == NULL)
+        return;
+
+    nLineLen = AsyncLogFormatTimestamp(pSlot->szLine, ASYNC_LOG_LINE_MAX, "DEBUG");
+    nLineLen += snprintf(&pSlot->szLine[nLineLen], ASYNC_LOG_LINE_MAX - nLineLen, "%s[%d]=", pszBufName, nLen);
+    if (nLineLen > (ASYNC_LOG_LINE_MAX - 2))
+        nLineLen = ASYNC_LOG_LINE_MAX - 2;
+
+    // Room Kept for ".\n"
+    for (nIndex = 0; (nIndex < nLen) && (nLineLen <= (ASYNC_LOG_LINE_MAX - 5)); nIndex++)
+    {
+        pSlot->szLine[nLineLen++] = ' ';
+        pSlot->szLine[nLineLen++] = szHexDigits[pbyBuf[nIndex] >> 4];
+        pSlot->szLine[nLineLen++] = szHexDigits[pbyBuf[nIndex] & 0x0F];
+    }
+    pSlot->szLine[nLineLen++] = '.';
+    pSlot->szLine[nLineLen++] = '\n';
+    pSlot->nLen = nLineLen;
+
+    AsyncLogPublishSlot(pSlot, nPosition);
+    return;
+}
+
+// Log File Kept Open by Writer Thread (Follows rename() of Set*Path Functions)
+int CBaseLog::AsyncLogOpenFile(void)
+{
+    if (s_AsyncLog.nFd >= 0)
+        return TP_SUCCESS;
+
+    pthread_mutex_lock(&s_mutexAsyncLog);
+    s_AsyncLog.nFd = open(s_AsyncLog.szFilePath, O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+    pthread_mutex_unlock(&s_mutexAsyncLog);
+    if (s_AsyncLog.nFd < 0)
+    {
+        printf("%s: Fail to open \"%s\"! (errno=%d)\r\n", __func__, s_AsyncLog.szFilePath, errno);
+        return TP_ERR_FILE_IO_ERROR;
+    }
+
+    return TP_SUCCESS;
+}
+
+// Take Ready Lines from Ring & Write Them with One write(); Return Number of Lines
+int CBaseLog::AsyncLogWriteBatch(void)
+{
+    PASYNC_LOG_SLOT pSlot = NULL;
+    unsigned long nPosition = 0;
+    size_t nBatchLen = 0;
+    ssize_t nRet = 0;
+    int nLines = 0;
+
+    // Busy until Batch Written; Fatal Signal Handler Sets Emergency Flag then Waits while Busy,
+    // so either This Batch is Written Here or No Line is Taken Here
+    s_AsyncLog.nWriterBusy = 1;
+    __sync_synchronize();
+    if (s_AsyncLog.nEmergency)
+        goto ASYNC_LOG_WRITE_BATCH_EXIT;
+
+    s_AsyncLog.nBatchLen = 0;
+    s_AsyncLog.nBatchWrittenLen = 0;
+    while ((nBatchLen + ASYNC_LOG_LINE_MAX) <= sizeof(s_AsyncLog.szBatch))
+    {
+        nPosition = s_AsyncLog.nTail;
+        pSlot = &s_AsyncLog.pRing[nPosition & (ASYNC_LOG_RING_SLOTS - 1)];
+        if (pSlot->nSequence != (nPosition + 1)) // Not Published Yet
+            break;
+        __sync_synchronize();
+
+        memcpy(&s_AsyncLog.szBatch[nBatchLen], pSlot->szLine, pSlot->nLen);
+
+        // Take Line (Signal Handler May Have Taken It after Copy: Drop Copy)
+        if (__sync_bool_compare_and_swap(&s_AsyncLog.nTail, nPosition, nPosition + 1) == false)
+            break;
+        nBatchLen += pSlot->nLen;
+        s_AsyncLog.nBatchLen = nBatchLen;
+
+        // Give Slot Back to Producers
+        __sync_synchronize();
+        pSlot->nSequence = nPosition + ASYNC_LOG_RING_SLOTS;
+        nLines++;
+    }
+
+    if (nBatchLen == 0)
+        goto ASYNC_LOG_WRITE_BATCH_EXIT;
+
+    if (AsyncLogOpenFile() == TP_SUCCESS)
+    {
+        while (s_AsyncLog.nBatchWrittenLen < nBatchLen)
+        {
+            nRet = write(s_AsyncLog.nFd, &s_AsyncLog.szBatch[s_AsyncLog.nBatchWrittenLen], nBatchLen - s_AsyncLog.nBatchWrittenLen);
+            if ((nRet < 0) && (errno == EINTR))
+                continue;
+            if (nRet <= 0)
+                break;
+            s_AsyncLog.nBatchWrittenLen += nRet;
+        }
+    }
+
+    __sync_synchronize();
+    s_AsyncLog.nWritten = s_AsyncLog.nTail;
+
+ASYNC_LOG_WRITE_BATCH_EXIT:
+    __sync_synchronize();
+    s_AsyncLog.nWriterBusy = 0;
+    return nLines;
+}
+
+void *CBaseLog::AsyncLogWriterRoutine(void *pParam)
+{
+    struct timespec tsDeadline;
+
+    while (1)
+    {
+        if (AsyncLogWriteBatch() > 0)
+            continue;
+        if (s_AsyncLog.nStop)
+            break;
+
+        // Ring Empty: Sleep until Producer Posts (Re-check after Idle Flag Set, so No Wakeup is Missed)
+        s_AsyncLog.nWriterIdle = 1;
+        __sync_synchronize();
+        if (s_AsyncLog.pRing[s_AsyncLog.nTail & (ASYNC_LOG_RING_SLOTS - 1)].nSequence != (s_AsyncLog.nTail + 1))
+        {
+            clock_gettime(CLOCK_REALTIME, &tsDeadline);
+            tsDeadline.tv_nsec += (ASYNC_LOG_IDLE_WAIT_MSEC % 1000) * 1000000L;
+            tsDeadline.tv_sec += (ASYNC_LOG_IDLE_WAIT_MSEC / 1000) + (tsDeadline.tv_nsec / 1000000000L);
+            tsDeadline.tv_nsec %= 1000000000L;
+            sem_timedwait(&s_AsyncLog.semWakeup, &tsDeadline);
+        }
+        s_AsyncLog.nWriterIdle = 0;
+    }
+
+    return NULL;
+}
+
+// Called from Fatal Signal Handler (Async-Signal-Safe: Only nanosleep(), open() & write())
+// Batch the writer thread has in hand is waited for; if the writer thread does not finish it in time
+// (e.g. it is the thread that crashed), the unwritten part of the batch is written here.
+// Lines still in ring are taken with CAS on tail, so none of them is written twice.
+void CBaseLog::EmergencyFlush(void)
+{
+    PASYNC_LOG_SLOT pSlot = NULL;
+    unsigned long nPosition = 0,
+                  nHead = s_AsyncLog.nHead;
+    struct timespec tsWait = {0, 1000000L}; // 1ms
+    int nWaitMsec = 0;
+    ssize_t nRet = 0;
+
+    // Writer Thread Takes No More Lines from Now on
+    s_AsyncLog.nEmergency = 1;
+    __sync_synchronize();
+
+    if ((s_AsyncLog.pRing == NULL) || (s_AsyncLog.bWriterRunning == false))
+        return;
+
+    for (nWaitMsec = 0; s_AsyncLog.nWriterBusy && (nWaitMsec < ASYNC_LOG_EMERGENCY_WAIT_MSEC); nWaitMsec++)
+        nanosleep(&tsWait, NULL);
+
+    if (s_AsyncLog.nFd < 0)
+        s_AsyncLog.nFd = open(s_AsyncLog.szFilePath, O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+    if (s_AsyncLog.nFd < 0)
+        return;
+
+    // Batch Left Unfinished by Writer Thread
+    if (s_AsyncLog.nWriterBusy && (s_AsyncLog.nBatchWrittenLen < s_AsyncLog.nBatchLen))
+    {
+        nRet = write(s_AsyncLog.nFd, &s_AsyncLog.szBatch[s_AsyncLog.nBatchWrittenLen], \
+                     s_AsyncLog.nBatchLen - s_AsyncLog.nBatchWrittenLen);
+        if (nRet < 0)
+            return;
+    }
+
+    for (nPosition = s_AsyncLog.nTail; nPosition != nHead; nPosition = s_AsyncLog.nTail)
+    {
+        pSlot = &s_AsyncLog.pRing[nPosition & (ASYNC_LOG_RING_SLOTS - 1)];
+        if (pSlot->nSequence != (nPosition + 1)) // Not Published Yet
+            break;
+        __sync_synchronize();
+
+        if (__sync_bool_compare_and_swap(&s_AsyncLog.nTail, nPosition, nPosition + 1) == false)
+            continue; // Taken by Writer Thread in Between
+
+        nRet = write(s_AsyncLog.nFd, pSlot->szLine, pSlot->nLen);
+        if (nRet < 0)
+            break;
+    }
+
+    return;
+}
+#endif //__ENABLE_ASYNC_LOG__
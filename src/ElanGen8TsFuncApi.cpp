@@ -66,77 +66,147 @@ GEN8_GET_ROM_DATA_EXIT:
     return err;
 }
 
-// Information FWID
-int gen8_read_info_fwid(unsigned short *p_info_fwid, bool recovery)
+// ROM Byte Stream (Pipelined Read ROM Data Commands)
+int gen8_read_rom_bytes(unsigned int addr, unsigned char *p_buf, unsigned int len, bool recovery)
 {
     int err = TP_SUCCESS;
-    unsigned char info_fwid_low_byte = 0,
-                  info_fwid_high_byte = 0;
-    unsigned short info_fwid = 0;
-    unsigned int rom_data = 0;
+    unsigned int issue_offset = 0,
+                 pending_addr[ELAN_GEN8_ROM_READ_PIPELINE_DEPTH] = {0},
+                 pending_offset[ELAN_GEN8_ROM_READ_PIPELINE_DEPTH] = {0},
+                 reply_addr = 0,
+                 rom_data = 0;
+    unsigned char pending_len[ELAN_GEN8_ROM_READ_PIPELINE_DEPTH] = {0},
+                  reply_len = 0,
+                  data_len = 0;
+    int pending_count = 0,
+        reply_index = 0,
+        pending_index = 0,
+        oldest_index = 0,
+        byte_index = 0;
 
     // Check if Parameter Invalid
-    if (p_info_fwid == NULL)
+    if ((p_buf == NULL) || (len == 0))
     {
-        ERROR_PRINTF("%s: Invalid Parameter! (p_info_fwid=0x%p)\r\n", __func__, p_info_fwid);
+        ERROR_PRINTF("%s: Invalid Parameter! (p_buf=0x%p, len=%u)\r\n", __func__, p_buf, len);
         err = TP_ERR_INVALID_PARAM;
-        goto GEN8_READ_INFO_FWID_EXIT;
+        goto GEN8_READ_ROM_BYTES_EXIT;
     }
 
-    // Read ROM Data from Information ROM Address (0x40000)
-    if(!recovery) // Normal Mode
+    while(issue_offset < len)
     {
-        /*
-         * Touch firmware supports Read  8-bit RAM/ROM Data Command,
-         *                         Read 16-bit RAM/ROM Data Command, and
-         *                         Read 32-bit RAM/ROM Data Command.
-         */
-
-        err = gen8_get_rom_data(ELAN_GEN8_INFO_ROM_FWID_MEMORY_ADDR, 2, &rom_data); // Word Data / 16-bit
-        if(err != TP_SUCCESS)
+        // Issue Read Commands Back-to-Back (First One Drops Stale Reports)
+        for(pending_count = 0; (pending_count < ELAN_GEN8_ROM_READ_PIPELINE_DEPTH) && (issue_offset < len); pending_count++)
         {
-            ERROR_PRINTF("%s: Fail to Get ROM Data of MEM[0x%08x]! err=0x%x.\r\n", \
-                         __func__, ELAN_GEN8_INFO_ROM_FWID_MEMORY_ADDR, err);
-            goto GEN8_READ_INFO_FWID_EXIT;
+            /*
+             * Boot code only supports Read 8-bit RAM/ROM Data Command,
+             *   while main code also supports 16-bit & 32-bit reads of aligned address.
+             */
+            if((recovery == false) && ((len - issue_offset) >= 4) && (((addr + issue_offset) % 4) == 0))
+                data_len = 4;
+            else if((recovery == false) && ((len - issue_offset) >= 2) && (((addr + issue_offset) % 2) == 0))
+                data_len = 2;
+            else
+                data_len = 1;
+
+            if(pending_count == 0)
+                err = gen8_send_read_rom_data_command(addr + issue_offset, data_len);
+            else
+                err = gen8_send_pipelined_read_rom_data_command(addr + issue_offset, data_len);
+            if(err != TP_SUCCESS)
+            {
+                ERROR_PRINTF("%s: Fail to Send Read ROM Data Command of MEM[0x%08x]! err=0x%x.\r\n", __func__, addr + issue_offset, err);
+                goto GEN8_READ_ROM_BYTES_EXIT;
+            }
+
+            pending_addr[pending_count] = addr + issue_offset;
+            pending_offset[pending_count] = issue_offset;
+            pending_len[pending_count] = data_len;
+            issue_offset += data_len;
         }
 
-        // Get Low Word (16-bit) of ROM Data
-        info_fwid = LOW_WORD(rom_data);
-        DEBUG_PRINTF("%s: Information FWID: 0x%04x.\r\n", __func__, info_fwid);
-    }
-    else // Recovery Mode
-    {
-        /*
-         * Touch boot code only supports Read 8-bit RAM/ROM Data Command.
-         */
-
-        // Low Byte of Information FWID
-        err = gen8_get_rom_data(ELAN_GEN8_INFO_ROM_FWID_MEMORY_ADDR, 1, &rom_data); // Byte Data / 8-bit
-        if(err != TP_SUCCESS)
+        // Collect Replies & Match with Pending Commands by Address / Length Echo
+        // Echo is not guaranteed by every firmware: a reply without matching echo is taken
+        // as reply of the oldest pending command (commands are answered in order they are sent).
+        oldest_index = 0;
+        for(reply_index = 0; reply_index < pending_count; reply_index++)
         {
-            ERROR_PRINTF("%s: Fail to Get ROM Data of MEM[0x%08x]! err=0x%x.\r\n", \
-                         __func__, ELAN_GEN8_INFO_ROM_FWID_MEMORY_ADDR, err);
-            goto GEN8_READ_INFO_FWID_EXIT;
+            err = gen8_receive_addressed_rom_data(&reply_addr, &reply_len, &rom_data);
+            if(err != TP_SUCCESS)
+            {
+                ERROR_PRINTF("%s: Fail to Receive ROM Data (%d/%d)! err=0x%x.\r\n", __func__, reply_index + 1, pending_count, err);
+                goto GEN8_READ_ROM_BYTES_EXIT;
+            }
+
+            for(pending_index = 0; pending_index < pending_count; pending_index++)
+            {
+                if((pending_len[pending_index] != 0) && (pending_addr[pending_index] == reply_addr) && (pending_len[pending_index] == reply_len))
+                    break;
+            }
+            if(pending_index == pending_count) // No Echo: FIFO Order
+            {
+                while(pending_len[oldest_index] == 0)
+                    oldest_index++;
+                if(pending_len[oldest_index] != reply_len)
+                {
+                    ERROR_PRINTF("%s: Unexpected Reply of MEM[0x%08x] (Length %d, Expected %d)!\r\n", \
+                                 __func__, pending_addr[oldest_index], reply_len, pending_len[oldest_index]);
+                    err = TP_ERR_DATA_MISMATCHED;
+                    goto GEN8_READ_ROM_BYTES_EXIT;
+                }
+                DEBUG_PRINTF("%s: No address echo (0x%08x) in reply, take it as reply of MEM[0x%08x].\r\n", \
+                             __func__, reply_addr, pending_addr[oldest_index]);
+                pending_index = oldest_index;
+                reply_addr = pending_addr[oldest_index];
+            }
+
+            // ROM Data is Little Endian in Memory
+            for(byte_index = 0; byte_index < reply_len; byte_index++)
+                p_buf[pending_offset[pending_index] + byte_index] = (unsigned char)((rom_data >> (8 * byte_index)) & 0xFF);
+            DEBUG_PRINTF("%s: MEM[0x%08x]=0x%0*x.\r\n", __func__, reply_addr, reply_len * 2, rom_data);
+
+            // Reply Received
+            pending_len[pending_index] = 0;
         }
-        info_fwid_low_byte = LOW_BYTE(rom_data);
-        DEBUG_PRINTF("%s: MEM[0x%08x]=0x%02x.\r\n", __func__, ELAN_GEN8_INFO_ROM_FWID_MEMORY_ADDR, info_fwid_low_byte);
+    }
 
-        // High Byte of Information FWID
-        err = gen8_get_rom_data((ELAN_GEN8_INFO_ROM_FWID_MEMORY_ADDR + 1), 1, &rom_data); // Byte Data / 8-bit
-        if(err != TP_SUCCESS)
-        {
-            ERROR_PRINTF("%s: Fail to Get ROM Data of MEM[0x%08x]! err=0x%x.\r\n", \
-                         __func__, (ELAN_GEN8_INFO_ROM_FWID_MEMORY_ADDR + 1), err);
-            goto GEN8_READ_INFO_FWID_EXIT;
-        }
-        info_fwid_high_byte = LOW_BYTE(rom_data);
-        DEBUG_PRINTF("%s: MEM[0x%08x]=0x%02x.\r\n", __func__, (ELAN_GEN8_INFO_ROM_FWID_MEMORY_ADDR + 1), info_fwid_high_byte);
+    // Success
+    err = TP_SUCCESS;
 
-        // Get Low Word (16-bit) of ROM Data
-        info_fwid = ((unsigned short)info_fwid_high_byte << 8) | (unsigned short)info_fwid_low_byte;
-        DEBUG_PRINTF("%s: Information FWID: 0x%04x.\r\n", __func__, info_fwid);
+GEN8_READ_ROM_BYTES_EXIT:
+    return err;
+}
+
+// Information FWID
+int gen8_read_info_fwid(unsigned short *p_info_fwid, bool recovery)
+{
+    int err = TP_SUCCESS;
+    unsigned char info_fwid_buf[2] = {0};
+    unsigned short info_fwid = 0;
+
+    // Check if Parameter Invalid
+    if (p_info_fwid == NULL)
+    {
+        ERROR_PRINTF("%s: Invalid Parameter! (p_info_fwid=0x%p)\r\n", __func__, p_info_fwid);
+        err = TP_ERR_INVALID_PARAM;
+        goto GEN8_READ_INFO_FWID_EXIT;
+    }
+
+    /*
+     * Read ROM Data from Information ROM Address (0x40000)
+     * Normal Mode:   One 16-bit Read ROM Data Command.
+     * Recovery Mode: Two pipelined 8-bit Read ROM Data Commands (Boot code only supports 8-bit read).
+     */
+    err = gen8_read_rom_bytes(ELAN_GEN8_INFO_ROM_FWID_MEMORY_ADDR, info_fwid_buf, sizeof(info_fwid_buf), recovery);
+    if(err != TP_SUCCESS)
+    {
+        ERROR_PRINTF("%s: Fail to Get ROM Data of MEM[0x%08x]! err=0x%x.\r\n", \
+                     __func__, ELAN_GEN8_INFO_ROM_FWID_MEMORY_ADDR, err);
+        goto GEN8_READ_INFO_FWID_EXIT;
     }
 
+    info_fwid = ((unsigned short)info_fwid_buf[1] << 8) | (unsigned short)info_fwid_buf[0];
+    DEBUG_PRINTF("%s: Information FWID: 0x%04x.\r\n", __func__, info_fwid);
+
     // Load Information FWID to Input Buffer
     *p_info_fwid = info_fwid;
 
@@ -20,7 +20,7 @@
  ***************************************************/
 
 // ROM Data
-int gen8_send_read_rom_data_command(unsigned int addr, unsigned char data_len)
+static int __gen8_send_read_rom_data_command(unsigned int addr, unsigned char data_len, bool pipelined)
 {
     int err = TP_SUCCESS;
     unsigned char new_read_rom_data_cmd[10] =  {0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00} /* Read 32-bit RAM/ROM Data Command */;
@@ -45,11 +45,14 @@ int gen8_send_read_rom_data_command(unsigned int addr, unsigned char data_len)
     new_read_rom_data_cmd[5] = (unsigned char)((addr & 0x000000FF)		); //ADDR_0, ex: 0x00
 
     /* Send Read 32-bit RAM/ROM Data Command */
-    DEBUG_PRINTF("cmd: 0x%02x, 0x%02x, 0x%02x, 0x%02x, 0x%02x, 0x%02x, 0x%02x, 0x%02x, 0x%02x, 0x%02x.\r\n", \
+    TRACE_PRINTF("cmd: 0x%02x, 0x%02x, 0x%02x, 0x%02x, 0x%02x, 0x%02x, 0x%02x, 0x%02x, 0x%02x, 0x%02x.\r\n", \
                  new_read_rom_data_cmd[0], new_read_rom_data_cmd[1], \
                  new_read_rom_data_cmd[2], new_read_rom_data_cmd[3], new_read_rom_data_cmd[4], new_read_rom_data_cmd[5], \
                  new_read_rom_data_cmd[6], new_read_rom_data_cmd[7], new_read_rom_data_cmd[8], new_read_rom_data_cmd[9]);
-    err = write_cmd(new_read_rom_data_cmd, sizeof(new_read_rom_data_cmd), ELAN_WRITE_DATA_TIMEOUT_MSEC);
+    if(pipelined) // Keep Replies of Earlier Commands in Flight
+        err = write_pipelined_cmd(new_read_rom_data_cmd, sizeof(new_read_rom_data_cmd), ELAN_WRITE_DATA_TIMEOUT_MSEC);
+    else
+        err = write_cmd(new_read_rom_data_cmd, sizeof(new_read_rom_data_cmd), ELAN_WRITE_DATA_TIMEOUT_MSEC);
     if (err != TP_SUCCESS)
     {
         ERROR_PRINTF("%s: Fail to send Read 32-bit RAM/ROM Data Command! err=0x%x.\r\n", __func__, err);
@@ -63,16 +66,34 @@ GEN8_SEND_READ_ROM_DATA_COMMAND_EXIT:
     return err;
 }
 
+int gen8_send_read_rom_data_command(unsigned int addr, unsigned char data_len)
+{
+    return __gen8_send_read_rom_data_command(addr, data_len, false);
+}
+
+int gen8_send_pipelined_read_rom_data_command(unsigned int addr, unsigned char data_len)
+{
+    return __gen8_send_read_rom_data_command(addr, data_len, true);
+}
+
 int gen8_receive_rom_data(unsigned int *p_rom_data)
+{
+    unsigned int addr = 0;
+    unsigned char data_len = 0;
+
+    return gen8_receive_addressed_rom_data(&addr, &data_len, p_rom_data);
+}
+
+int gen8_receive_addressed_rom_data(unsigned int *p_addr, unsigned char *p_data_len, unsigned int *p_rom_data)
 {
     int err = TP_SUCCESS;
     unsigned char cmd_data[10] = {0};
-    unsigned short rom_data = 0;
+    unsigned int rom_data = 0;
 
     // Check if Parameter Invalid
-    if (p_rom_data == NULL)
+    if ((p_addr == NULL) || (p_data_len == NULL) || (p_rom_data == NULL))
     {
-        ERROR_PRINTF("%s: Invalid Parameter! (p_rom_data=0x%p)\r\n", __func__, p_rom_data);
+        ERROR_PRINTF("%s: Invalid Parameter! (p_addr=0x%p, p_data_len=0x%p, p_rom_data=0x%p)\r\n", __func__, p_addr, p_data_len, p_rom_data);
         err = TP_ERR_INVALID_PARAM;
         goto GEN8_RECEIVE_ROM_DATA_EXIT;
     }
@@ -84,7 +105,7 @@ int gen8_receive_rom_data(unsigned int *p_rom_data)
         ERROR_PRINTF("Fail to receive ROM data! err=0x%x.\r\n", err);
         goto GEN8_RECEIVE_ROM_DATA_EXIT;
     }
-    DEBUG_PRINTF("cmd_data: 0x%x, 0x%x, 0x%x, 0x%x, 0x%x, 0x%x, 0x%x, 0x%x, 0x%x, 0x%x.\r\n", \
+    TRACE_PRINTF("cmd_data: 0x%x, 0x%x, 0x%x, 0x%x, 0x%x, 0x%x, 0x%x, 0x%x, 0x%x, 0x%x.\r\n", \
                  cmd_data[0], cmd_data[1], cmd_data[2], cmd_data[3], cmd_data[4], cmd_data[5], \
                  cmd_data[6], cmd_data[7], cmd_data[8], cmd_data[9]);
 
@@ -99,9 +120,13 @@ int gen8_receive_rom_data(unsigned int *p_rom_data)
         goto GEN8_RECEIVE_ROM_DATA_EXIT;
     }
 
+    // Address & Length Echoed from Command
+    *p_addr = ((unsigned int)cmd_data[2] << 24) | ((unsigned int)cmd_data[3] << 16) | ((unsigned int)cmd_data[4] << 8) | (unsigned int)cmd_data[5];
+    *p_data_len = cmd_data[1];
+
     // Load 4-byte ROM Data to Input Buffer
-    rom_data = (unsigned int)((cmd_data[6] << 24) | (cmd_data[7] << 16) | (cmd_data[8] << 8) | cmd_data[9]);
-    DEBUG_PRINTF("ROM Data: 0x%08x.\r\n", rom_data);
+    rom_data = ((unsigned int)cmd_data[6] << 24) | ((unsigned int)cmd_data[7] << 16) | ((unsigned int)cmd_data[8] << 8) | (unsigned int)cmd_data[9];
+    TRACE_PRINTF("ROM Data: 0x%08x.\r\n", rom_data);
     *p_rom_data = rom_data;
 
     // Success
@@ -118,7 +143,7 @@ int send_gen8_write_flash_key_command(void)
     unsigned char gen8_write_flash_key_cmd[10] = {0x54, 0xc0, 0xcd, 0xab, 0x34, 0x84, 0x01, 0x67, 0x94, 0x81};
 
     /* Send Gen8 Write Flash Key Command */
-    DEBUG_PRINTF("cmd: 0x%x, 0x%x, 0x%x, 0x%x, 0x%x, 0x%x, 0x%x, 0x%x, 0x%x, 0x%x.\r\n", \
+    TRACE_PRINTF("cmd: 0x%x, 0x%x, 0x%x, 0x%x, 0x%x, 0x%x, 0x%x, 0x%x, 0x%x, 0x%x.\r\n", \
                  gen8_write_flash_key_cmd[0], gen8_write_flash_key_cmd[1], gen8_write_flash_key_cmd[2], gen8_write_flash_key_cmd[3], \
                  gen8_write_flash_key_cmd[4], gen8_write_flash_key_cmd[5], gen8_write_flash_key_cmd[6], gen8_write_flash_key_cmd[7], \
                  gen8_write_flash_key_cmd[8], gen8_write_flash_key_cmd[9]);
@@ -185,7 +210,7 @@ int receive_erase_flash_section_response(void)
         ERROR_PRINTF("Fail to receive Erase Flash Section Response data! err=0x%x.\r\n", err);
         goto RECEIVE_ERASE_FLASH_SECTION_RESPONSE_EXIT;
     }
-    DEBUG_PRINTF("Erase Flash Section Response: 0x%02x, 0x%02x.\r\n", erase_flash_section_response_data[0], erase_flash_section_response_data[1]);
+    TRACE_PRINTF("Erase Flash Section Response: 0x%02x, 0x%02x.\r\n", erase_flash_section_response_data[0], erase_flash_section_response_data[1]);
 
     /* Check if Correct Response */
     if((erase_flash_section_response_data[0] != 0xAA) || (erase_flash_section_response_data[1] != 0xAA))
@@ -0,0 +1,405 @@
+/** @file
+
+  Implementation of Daemon Utility (Unix Domain Socket Query Service) for Elan I2C-HID Touchscreen.
+
+  Copyright (c) ELAN microelectronics corp. 2022, All Rights Reserved
+
+  Module Name:
+	ElanTsDaemonUtility.cpp
+
+  Environment:
+	All kinds of Linux-like Platform.
+
+**/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>			/* errno */
+#include <signal.h>			/* sigaction */
+#include <unistd.h>     	/* close, unlink */
+#include <poll.h>			/* poll */
+#include <sys/socket.h>		/* socket */
+#include <sys/un.h>			/* sockaddr_un */
+#include <sys/stat.h>		/* chmod, lstat */
+#include "ErrCode.h"
+#include "ElanTsTimeUtility.h"
+#include "ElanTsDaemonUtility.h"
+
+/***************************************************
+ * Global Variables Declaration
+ ***************************************************/
+
+// Set by Signal Handler or "quit" Request
+static volatile sig_atomic_t g_daemon_stop = 0;
+
+/***************************************************
+ * Function Prototype
+ ***************************************************/
+
+static void daemon_signal_handler(int signal_number);
+static int fill_socket_address(const char *p_socket_path, struct sockaddr_un *p_address);
+static int remove_stale_socket(const char *p_socket_path, const struct sockaddr_un *p_address);
+static int recv_line(int fd, char *p_line, size_t line_size, int timeout_ms);
+static int send_line(int fd, const char *p_line);
+
+/***************************************************
+ * Function Implements
+ ***************************************************/
+
+static void daemon_signal_handler(int signal_number)
+{
+    g_daemon_stop = 1;
+    return;
+}
+
+static int fill_socket_address(const char *p_socket_path, struct sockaddr_un *p_address)
+{
+    int err = TP_SUCCESS;
+
+    if((p_socket_path == NULL) || (strlen(p_socket_path) == 0) || (strlen(p_socket_path) >= sizeof(p_address->sun_path)))
+    {
+        ERROR_PRINTF("%s: Invalid Socket Path \"%s\"!\r\n", __func__, (p_socket_path) ? p_socket_path : "");
+        err = TP_ERR_INVALID_PARAM;
+        goto FILL_SOCKET_ADDRESS_EXIT;
+    }
+
+    memset(p_address, 0, sizeof(struct sockaddr_un));
+    p_address->sun_family = AF_UNIX;
+    strncpy(p_address->sun_path, p_socket_path, sizeof(p_address->sun_path) - 1);
+
+FILL_SOCKET_ADDRESS_EXIT:
+    return err;
+}
+
+// Remove Socket File Left by Previous Daemon
+// Only a socket no daemon answers on is removed; other files are never touched.
+static int remove_stale_socket(const char *p_socket_path, const struct sockaddr_un *p_address)
+{
+    int err = TP_SUCCESS,
+        fd = -1;
+    struct stat file_stat;
+
+    if(lstat(p_socket_path, &file_stat) < 0)
+    {
+        if(errno != ENOENT)
+        {
+            ERROR_PRINTF("%s: Fail to Stat \"%s\"! errno=%d.\r\n", __func__, p_socket_path, errno);
+            err = TP_ERR_FILE_IO_ERROR;
+        }
+        goto REMOVE_STALE_SOCKET_EXIT; // Nothing to Remove
+    }
+
+    if(!S_ISSOCK(file_stat.st_mode))
+    {
+        ERROR_PRINTF("%s: \"%s\" exists and is not a socket!\r\n", __func__, p_socket_path);
+        err = TP_ERR_FILE_IO_ERROR;
+        goto REMOVE_STALE_SOCKET_EXIT;
+    }
+
+    fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if(fd < 0)
+    {
+        ERROR_PRINTF("%s: Fail to Create Socket! errno=%d.\r\n", __func__, errno);
+        err = TP_ERR_IO_ERROR;
+        goto REMOVE_STALE_SOCKET_EXIT;
+    }
+
+    if(connect(fd, (const struct sockaddr *)p_address, sizeof(struct sockaddr_un)) == 0)
+    {
+        ERROR_PRINTF("%s: Daemon already running on \"%s\"!\r\n", __func__, p_socket_path);
+        err = TP_ERR_DEVICE_BUSY;
+        goto REMOVE_STALE_SOCKET_EXIT;
+    }
+
+    DEBUG_PRINTF("%s: Remove stale socket \"%s\".\r\n", __func__, p_socket_path);
+    if((unlink(p_socket_path) < 0) && (errno != ENOENT))
+    {
+        ERROR_PRINTF("%s: Fail to Remove \"%s\"! errno=%d.\r\n", __func__, p_socket_path, errno);
+        err = TP_ERR_FILE_IO_ERROR;
+        goto REMOVE_STALE_SOCKET_EXIT;
+    }
+
+REMOVE_STALE_SOCKET_EXIT:
+    if(fd >= 0)
+        close(fd);
+    return err;
+}
+
+// Receive One Line (Without Line Break) within Time Budget
+// Data is received in chunks; bytes after the line break are dropped (one request / response per connection).
+static int recv_line(int fd, char *p_line, size_t line_size, int timeout_ms)
+{
+    int err = TP_SUCCESS,
+        ret = 0,
+        index = 0,
+        remain_ms = 0;
+    size_t line_len = 0;
+    unsigned long long start_time_us = get_monotonic_time_us();
+    struct pollfd pfd;
+    char chunk[DAEMON_MESSAGE_LENGTH_MAX] = {0};
+
+    while(1)
+    {
+        remain_ms = timeout_ms - (int)(get_elapsed_time_us(start_time_us) / 1000);
+        if(remain_ms <= 0)
+        {
+            err = TP_ERR_TIMEOUT;
+            goto RECV_LINE_EXIT;
+        }
+
+        pfd.fd = fd;
+        pfd.events = POLLIN;
+        pfd.revents = 0;
+        ret = poll(&pfd, 1, remain_ms);
+        if((ret < 0) && (errno == EINTR))
+            continue;
+        if(ret < 0)
+        {
+            err = TP_ERR_IO_ERROR;
+            goto RECV_LINE_EXIT;
+        }
+        if(ret == 0)
+        {
+            err = TP_ERR_TIMEOUT;
+            goto RECV_LINE_EXIT;
+        }
+
+        ret = recv(fd, chunk, sizeof(chunk), 0);
+        if((ret < 0) && (errno == EINTR))
+            continue;
+        if(ret <= 0) // Error or Peer Closed
+        {
+            err = (line_len > 0) ? TP_SUCCESS : TP_ERR_IO_ERROR;
+            break;
+        }
+
+        for(index = 0; index < ret; index++)
+        {
+            if(chunk[index] == '\n')
+                break;
+            if(chunk[index] == '\r')
+                continue;
+
+            if(line_len >= (line_size - 1))
+            {
+                err = TP_ERR_INVALID_PARAM; // Line Too Long
+                goto RECV_LINE_EXIT;
+            }
+            p_line[line_len++] = chunk[index];
+        }
+        if(index < ret) // Line Break Found
+            break;
+    }
+
+    p_line[line_len] = '\0';
+
+RECV_LINE_EXIT:
+    return err;
+}
+
+static int send_line(int fd, const char *p_line)
+{
+    int err = TP_SUCCESS,
+        ret = 0;
+    char line[DAEMON_MESSAGE_LENGTH_MAX] = {0};
+    size_t line_len = 0,
+           sent_len = 0;
+
+    line_len = snprintf(line, sizeof(line), "%s\n", p_line);
+    if(line_len >= sizeof(line))
+        line_len = sizeof(line) - 1;
+
+    while(sent_len < line_len)
+    {
+        ret = send(fd, &line[sent_len], line_len - sent_len, MSG_NOSIGNAL);
+        if((ret < 0) && (errno == EINTR))
+            continue;
+        if(ret <= 0)
+        {
+            err = TP_ERR_IO_ERROR;
+            break;
+        }
+        sent_len += ret;
+    }
+
+    return err;
+}
+
+int daemon_listen(const char *p_socket_path, int *p_listen_fd)
+{
+    int err = TP_SUCCESS,
+        fd = -1;
+    struct sockaddr_un address;
+    struct sigaction action;
+
+    if(p_listen_fd == NULL)
+    {
+        ERROR_PRINTF("%s: NULL Pointer!\r\n", __func__);
+        err = TP_ERR_INVALID_PARAM;
+        goto DAEMON_LISTEN_EXIT;
+    }
+
+    err = fill_socket_address(p_socket_path, &address);
+    if(err != TP_SUCCESS)
+        goto DAEMON_LISTEN_EXIT;
+
+    fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if(fd < 0)
+    {
+        ERROR_PRINTF("%s: Fail to Create Socket! errno=%d.\r\n", __func__, errno);
+        err = TP_ERR_IO_ERROR;
+        goto DAEMON_LISTEN_EXIT;
+    }
+
+    // Remove Socket File Left by Previous Daemon (Fail if Daemon still Running)
+    err = remove_stale_socket(p_socket_path, &address);
+    if(err != TP_SUCCESS)
+        goto DAEMON_LISTEN_EXIT;
+
+    if(bind(fd, (struct sockaddr *)&address, sizeof(address)) < 0)
+    {
+        ERROR_PRINTF("%s: Fail to Bind Socket \"%s\"! errno=%d.\r\n", __func__, p_socket_path, errno);
+        err = TP_ERR_FILE_IO_ERROR;
+        goto DAEMON_LISTEN_EXIT;
+    }
+    chmod(p_socket_path, 0660);
+
+    if(listen(fd, DAEMON_LISTEN_BACKLOG) < 0)
+    {
+        ERROR_PRINTF("%s: Fail to Listen on Socket \"%s\"! errno=%d.\r\n", __func__, p_socket_path, errno);
+        err = TP_ERR_IO_ERROR;
+        goto DAEMON_LISTEN_EXIT;
+    }
+
+    // Stop Serving on SIGINT / SIGTERM (No SA_RESTART, so accept() is Interrupted)
+    g_daemon_stop = 0;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = daemon_signal_handler;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGINT, &action, NULL);
+    sigaction(SIGTERM, &action, NULL);
+
+    DEBUG_PRINTF("%s: Listening on \"%s\" (fd=%d).\r\n", __func__, p_socket_path, fd);
+    *p_listen_fd = fd;
+    fd = -1;
+    err = TP_SUCCESS;
+
+DAEMON_LISTEN_EXIT:
+    if(fd >= 0)
+        close(fd);
+    return err;
+}
+
+// Serve Requests One by One (Touch Controller I/O is Not Re-entrant) until Stopped
+int daemon_serve(int listen_fd, daemon_request_handler handler, void *p_context)
+{
+    int err = TP_SUCCESS,
+        client_fd = -1;
+    char request[DAEMON_MESSAGE_LENGTH_MAX] = {0},
+         response[DAEMON_MESSAGE_LENGTH_MAX] = {0};
+
+    if((listen_fd < 0) || (handler == NULL))
+    {
+        ERROR_PRINTF("%s: Invalid Parameter! (listen_fd=%d, handler=0x%p)\r\n", __func__, listen_fd, handler);
+        err = TP_ERR_INVALID_PARAM;
+        goto DAEMON_SERVE_EXIT;
+    }
+
+    while(g_daemon_stop == 0)
+    {
+        client_fd = accept(listen_fd, NULL, NULL);
+        if(client_fd < 0)
+        {
+            if(errno == EINTR)
+                continue;
+            ERROR_PRINTF("%s: Fail to Accept Connection! errno=%d.\r\n", __func__, errno);
+            err = TP_ERR_IO_ERROR;
+            break;
+        }
+
+        memset(request, 0, sizeof(request));
+        memset(response, 0, sizeof(response));
+        if(recv_line(client_fd, request, sizeof(request), DAEMON_REQUEST_TIMEOUT_MSEC) == TP_SUCCESS)
+        {
+            DEBUG_PRINTF("%s: Request \"%s\".\r\n", __func__, request);
+            handler(request, response, sizeof(response), p_context);
+            DEBUG_PRINTF("%s: Response \"%s\".\r\n", __func__, response);
+            send_line(client_fd, response);
+        }
+
+        close(client_fd);
+        client_fd = -1;
+    }
+
+DAEMON_SERVE_EXIT:
+    return err;
+}
+
+void daemon_close(int listen_fd, const char *p_socket_path)
+{
+    if(listen_fd >= 0)
+        close(listen_fd);
+    if(p_socket_path != NULL)
+        unlink(p_socket_path);
+
+    return;
+}
+
+void daemon_stop(void)
+{
+    g_daemon_stop = 1;
+    return;
+}
+
+int daemon_query(const char *p_socket_path, const char *p_request, char *p_response, size_t response_size)
+{
+    int err = TP_SUCCESS,
+        fd = -1;
+    struct sockaddr_un address;
+
+    if((p_request == NULL) || (p_response == NULL) || (response_size == 0))
+    {
+        ERROR_PRINTF("%s: Invalid Parameter!\r\n", __func__);
+        err = TP_ERR_INVALID_PARAM;
+        goto DAEMON_QUERY_EXIT;
+    }
+
+    err = fill_socket_address(p_socket_path, &address);
+    if(err != TP_SUCCESS)
+        goto DAEMON_QUERY_EXIT;
+
+    fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if(fd < 0)
+    {
+        ERROR_PRINTF("%s: Fail to Create Socket! errno=%d.\r\n", __func__, errno);
+        err = TP_ERR_IO_ERROR;
+        goto DAEMON_QUERY_EXIT;
+    }
+
+    if(connect(fd, (struct sockaddr *)&address, sizeof(address)) < 0)
+    {
+        ERROR_PRINTF("%s: Fail to Connect to Daemon \"%s\"! errno=%d.\r\n", __func__, p_socket_path, errno);
+        err = TP_ERR_NOT_FOUND_DEVICE;
+        goto DAEMON_QUERY_EXIT;
+    }
+
+    err = send_line(fd, p_request);
+    if(err != TP_SUCCESS)
+    {
+        ERROR_PRINTF("%s: Fail to Send Request! err=0x%x.\r\n", __func__, err);
+        goto DAEMON_QUERY_EXIT;
+    }
+
+    err = recv_line(fd, p_response, response_size, DAEMON_QUERY_TIMEOUT_MSEC);
+    if(err != TP_SUCCESS)
+    {
+        ERROR_PRINTF("%s: Fail to Receive Response! err=0x%x.\r\n", __func__, err);
+        goto DAEMON_QUERY_EXIT;
+    }
+
+DAEMON_QUERY_EXIT:
+    if(fd >= 0)
+        close(fd);
+    return err;
+}
@@ -0,0 +1,45 @@
+/** @file
+
+  Implementation of Default (Built-in) FWID Mapping Utility for Elan I2C-HID Touchscreen.
+
+  Copyright (c) ELAN microelectronics corp. 2022, All Rights Reserved
+
+  Module Name:
+	ElanTsDefaultFwidMappingUtility.cpp
+
+  Environment:
+	All kinds of Linux-like Platform.
+
+**/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "ErrCode.h"
+#include "ElanTsDefaultFwidMappingUtility.h"
+#include "ElanTsDefaultFwidMappingTable.h"	/* Generated by Makefile */
+
+/***************************************************
+ * Function Implements
+ ***************************************************/
+
+size_t get_default_fwid_mapping_entry_count(void)
+{
+    return DEFAULT_FWID_MAPPING_ENTRY_COUNT;
+}
+
+uint32_t get_default_fwid_mapping_checksum(void)
+{
+    return DEFAULT_FWID_MAPPING_CHECKSUM;
+}
+
+const struct fwid_mapping_image_entry *find_default_fwid_mapping_entry(unsigned int panel_key)
+{
+    uint32_t bucket = get_default_fwid_mapping_hash(panel_key, 0) & (DEFAULT_FWID_MAPPING_BUCKET_COUNT - 1),
+             slot = get_default_fwid_mapping_hash(panel_key, g_default_fwid_mapping_seed[bucket]) & (DEFAULT_FWID_MAPPING_SLOT_COUNT - 1);
+
+    // Panel Key 0 Marks Empty Slot (Manufacturer Code 0 is Invalid)
+    if ((panel_key == 0) || (g_default_fwid_mapping_slot[slot].panel_key != panel_key))
+        return NULL;
+
+    return &g_default_fwid_mapping_slot[slot];
+}
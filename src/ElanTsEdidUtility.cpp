@@ -16,6 +16,9 @@
 #include <stdlib.h>
 #include <string.h>
 #include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>     	/* read, close */
+#include <dirent.h>         /* opendir, readdir, closedir */
 #include "ErrCode.h"
 #include "ElanTsEdidUtility.h"
 
@@ -23,12 +26,178 @@
  * Global Variable Declaration
  ***************************************************/
 
+// Known EDID Headers (Binary Form of STANDARD_EDID_HEADER / AUO_EDID_HEADER / BOE_EDID_HEADER)
+static const unsigned char g_known_edid_headers[][EDID_HEADER_SIZE] =
+{
+    {0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00},	// Standard
+    {0xb3, 0x6f, 0x02, 0x00, 0xb0, 0x04, 0xec, 0x04},	// AUO
+    {0xac, 0x70, 0x02, 0x00, 0xb0, 0x04, 0x00, 0x05},	// BOE
+};
+
 /***************************************************
  * Function Implements
  ***************************************************/
 
 // EDID
-int get_edid_manufacturer_product_code(unsigned short *p_manufacturer_code, unsigned short *p_product_code)
+int get_edid_manufacturer_product_code(const char *drm_sysfs_root, unsigned short *p_manufacturer_code, unsigned short *p_product_code)
+{
+    int err = TP_SUCCESS;
+
+    // Check if Parameter Invalid
+    if ((p_manufacturer_code == NULL) || (p_product_code == NULL))
+    {
+        ERROR_PRINTF("%s: Invalid Parameter! (p_manufacturer_code=0x%p, p_product_code=0x%p)\r\n", __func__, p_manufacturer_code, p_product_code);
+        err = TP_ERR_INVALID_PARAM;
+        goto GET_EDID_MANUFACTURER_PRODUCT_CODE_EXIT;
+    }
+
+    // Read EDID Blob from DRM sysfs
+    err = get_edid_manufacturer_product_code_from_sysfs(drm_sysfs_root, p_manufacturer_code, p_product_code);
+    if (err == TP_SUCCESS)
+        goto GET_EDID_MANUFACTURER_PRODUCT_CODE_EXIT;
+    DEBUG_PRINTF("%s: No EDID found in DRM sysfs (err=0x%x), fall back to \"%s\".\r\n", __func__, err, MODETEST_CMD);
+
+    // [Note] The modetest command forks a process and enumerates all DRM resources,
+    // so it is only used when EDID blobs are not exported by the kernel.
+    err = get_edid_manufacturer_product_code_from_modetest(p_manufacturer_code, p_product_code);
+
+GET_EDID_MANUFACTURER_PRODUCT_CODE_EXIT:
+    return err;
+}
+
+// Decode Manufacturer Code & Product Code from Binary EDID
+static int decode_edid_manufacturer_product_code(const unsigned char *p_edid, size_t edid_size, unsigned short *p_manufacturer_code, unsigned short *p_product_code)
+{
+    int err = TP_ERR_DATA_NOT_FOUND;
+    size_t header_index = 0;
+
+    // At Least Header, Manufacturer Code & Product Code Should Be Available
+    if (edid_size < (EDID_PRODUCT_CODE_OFFSET + 2))
+        goto DECODE_EDID_MANUFACTURER_PRODUCT_CODE_EXIT;
+
+    // Search for Known EDID Header
+    for (header_index = 0; header_index < (sizeof(g_known_edid_headers) / sizeof(g_known_edid_headers[0])); header_index++)
+    {
+        if (memcmp(p_edid, g_known_edid_headers[header_index], EDID_HEADER_SIZE) == 0)
+        {
+            DEBUG_PRINTF("%s: EDID header %d found!\r\n", __func__, (int)header_index);
+            err = TP_SUCCESS;
+            break;
+        }
+    }
+    if (err != TP_SUCCESS)
+        goto DECODE_EDID_MANUFACTURER_PRODUCT_CODE_EXIT;
+
+    // [Note] Keep the byte order printed by modetest (byte 8 first, byte 10 first),
+    // since panel keys of FWID mapping table are written in that order.
+    *p_manufacturer_code = (unsigned short)((p_edid[EDID_MANUFACTURER_CODE_OFFSET] << 8) | p_edid[EDID_MANUFACTURER_CODE_OFFSET + 1]);
+    *p_product_code = (unsigned short)((p_edid[EDID_PRODUCT_CODE_OFFSET] << 8) | p_edid[EDID_PRODUCT_CODE_OFFSET + 1]);
+    DEBUG_PRINTF("%s: manufacturer_code: %04x, product_code: %04x.\r\n", __func__, *p_manufacturer_code, *p_product_code);
+
+DECODE_EDID_MANUFACTURER_PRODUCT_CODE_EXIT:
+    return err;
+}
+
+// Check if DRM Connector is Internal Panel (eDP / LVDS / DSI)
+static bool is_internal_drm_connector(const char *connector_name)
+{
+    return ((strstr(connector_name, "-eDP-") != NULL) ||
+            (strstr(connector_name, "-LVDS-") != NULL) ||
+            (strstr(connector_name, "-DSI-") != NULL));
+}
+
+int get_edid_manufacturer_product_code_from_sysfs(const char *drm_sysfs_root, unsigned short *p_manufacturer_code, unsigned short *p_product_code)
+{
+    int err = TP_ERR_DATA_NOT_FOUND,
+        fd = -1;
+    ssize_t edid_size = 0;
+    bool internal_connector = false,
+         external_edid_found = false;
+    DIR *p_directory = NULL;
+    struct dirent *p_dir_entry = NULL;
+    char edid_path[DRM_SYSFS_PATH_LENGTH_MAX] = {0};
+    unsigned char edid[EDID_BLOCK_SIZE] = {0};
+    unsigned short manufacturer_code = 0,
+                   product_code = 0,
+                   external_manufacturer_code = 0,
+                   external_product_code = 0;
+
+    // Check if Parameter Invalid
+    if ((p_manufacturer_code == NULL) || (p_product_code == NULL))
+    {
+        ERROR_PRINTF("%s: Invalid Parameter! (p_manufacturer_code=0x%p, p_product_code=0x%p)\r\n", __func__, p_manufacturer_code, p_product_code);
+        err = TP_ERR_INVALID_PARAM;
+        goto GET_EDID_MANUFACTURER_PRODUCT_CODE_FROM_SYSFS_EXIT;
+    }
+
+    // Use Default DRM sysfs Root if Not Configured
+    if ((drm_sysfs_root == NULL) || (strcmp(drm_sysfs_root, "") == 0))
+        drm_sysfs_root = DRM_SYSFS_ROOT;
+
+    // Open Directory
+    p_directory = opendir(drm_sysfs_root);
+    if (p_directory == NULL)
+    {
+        DEBUG_PRINTF("%s: Fail to Open Directory \"%s\"! errno=%d.\r\n", __func__, drm_sysfs_root, errno);
+        err = TP_ERR_FILE_NOT_FOUND;
+        goto GET_EDID_MANUFACTURER_PRODUCT_CODE_FROM_SYSFS_EXIT;
+    }
+
+    // Traverse Connectors (card*-*)
+    while ((p_dir_entry = readdir(p_directory)) != NULL)
+    {
+        if ((strncmp(p_dir_entry->d_name, "card", 4) != 0) || (strchr(p_dir_entry->d_name, '-') == NULL))
+            continue;
+
+        snprintf(edid_path, sizeof(edid_path), "%s/%s/edid", drm_sysfs_root, p_dir_entry->d_name);
+
+        fd = open(edid_path, O_RDONLY);
+        if (fd < 0)
+            continue;
+
+        // Disconnected connectors export an empty EDID blob.
+        memset(edid, 0, sizeof(edid));
+        edid_size = read(fd, edid, sizeof(edid));
+        close(fd);
+        if (edid_size <= 0)
+            continue;
+        DEBUG_PRINTF("%s: \"%s\": %d bytes.\r\n", __func__, edid_path, (int)edid_size);
+
+        if (decode_edid_manufacturer_product_code(edid, (size_t)edid_size, &manufacturer_code, &product_code) != TP_SUCCESS)
+            continue;
+
+        // Prefer internal panel, keep the first external panel as candidate.
+        internal_connector = is_internal_drm_connector(p_dir_entry->d_name);
+        if (internal_connector == true)
+        {
+            *p_manufacturer_code = manufacturer_code;
+            *p_product_code = product_code;
+            err = TP_SUCCESS;
+            break;
+        }
+        else if (external_edid_found == false)
+        {
+            external_manufacturer_code = manufacturer_code;
+            external_product_code = product_code;
+            external_edid_found = true;
+        }
+    }
+
+    // Close Directory
+    closedir(p_directory);
+
+    if ((err != TP_SUCCESS) && (external_edid_found == true))
+    {
+        *p_manufacturer_code = external_manufacturer_code;
+        *p_product_code = external_product_code;
+        err = TP_SUCCESS;
+    }
+
+GET_EDID_MANUFACTURER_PRODUCT_CODE_FROM_SYSFS_EXIT:
+    return err;
+}
+
+int get_edid_manufacturer_product_code_from_modetest(unsigned short *p_manufacturer_code, unsigned short *p_product_code)
 {
     int err = TP_SUCCESS;
     char buf[1024] = {0};
@@ -45,7 +214,7 @@ int get_edid_manufacturer_product_code(unsigned short *p_manufacturer_code, unsi
     {
         ERROR_PRINTF("%s: Invalid Parameter! (p_manufacturer_code=0x%p, p_product_code=0x%p)\r\n", __func__, p_manufacturer_code, p_product_code);
         err = TP_ERR_INVALID_PARAM;
-        goto GET_EDID_MANUFACTURER_PRODUCT_CODE_EXIT;
+        goto GET_EDID_MANUFACTURER_PRODUCT_CODE_FROM_MODETEST_EXIT;
     }
 
     /* Open the command for reading. */
@@ -54,7 +223,7 @@ int get_edid_manufacturer_product_code(unsigned short *p_manufacturer_code, unsi
     {
         ERROR_PRINTF("%s: Command \"%s\" failed! errno=%d.\r\n", __func__, MODETEST_CMD, errno);
         err = ERR_SYSTEM_COMMAND_FAIL;
-        goto GET_EDID_MANUFACTURER_PRODUCT_CODE_EXIT;
+        goto GET_EDID_MANUFACTURER_PRODUCT_CODE_FROM_MODETEST_EXIT;
     }
 
     /* Read the output line by line */
@@ -104,7 +273,7 @@ int get_edid_manufacturer_product_code(unsigned short *p_manufacturer_code, unsi
     {
         // Terminate the process and return error code
         err = TP_ERR_DATA_NOT_FOUND;
-        goto GET_EDID_MANUFACTURER_PRODUCT_CODE_EXIT;
+        goto GET_EDID_MANUFACTURER_PRODUCT_CODE_FROM_MODETEST_EXIT;
     }
 
     /* Parse found EDID information */
@@ -127,7 +296,7 @@ int get_edid_manufacturer_product_code(unsigned short *p_manufacturer_code, unsi
     // Success
     err = TP_SUCCESS;
 
-GET_EDID_MANUFACTURER_PRODUCT_CODE_EXIT:
+GET_EDID_MANUFACTURER_PRODUCT_CODE_FROM_MODETEST_EXIT:
     return err;
 }
 
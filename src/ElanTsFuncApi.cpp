@@ -15,16 +15,153 @@
 #include <time.h>       		/* time_t, struct tm, time, localtime, asctime */
 #include "InterfaceGet.h"
 #include "ElanTsI2chidUtility.h"
+#include "ElanTsRetryUtility.h"
+#include "ElanTsTimeUtility.h"
 #include "ElanTsFuncApi.h"
 
+/***************************************************
+ * Data Structure Declaration
+ ***************************************************/
+
+// Arguments of Operations Run by Retry Engine
+struct hello_packet_retry_context
+{
+    unsigned char *p_hello_packet;
+    unsigned short *p_bc_version;
+};
+
+struct info_page_retry_context
+{
+    unsigned char *info_page_buf;
+    size_t info_page_buf_size;
+};
+
+// Device Information Cached for Opened Device Handle (Invalid after Mode Switch)
+struct session_context
+{
+    bool solution_id_valid;
+    unsigned char solution_id;
+    bool hello_packet_valid;
+    unsigned char hello_packet;
+    unsigned short bc_bc_version;	// BC Version from Hello Packet (Recovery Mode)
+    bool fw_bc_version_valid;
+    unsigned short fw_bc_version;	// BC Version from Boot Code Version Command (Normal Mode)
+};
+
 /***************************************************
  * Global Variable Declaration
  ***************************************************/
 
+// Typical Time from Show Bulk ROM Data Command to First Page Frame (0: Not Learned Yet)
+// (Per Thread, Learned from Device of Handle Owned by This Thread)
+static __thread unsigned int g_page_ready_time_us = 0;
+
+// Sleep Fixed Delay before Reading Page Data instead of Waiting on fd (Benchmark Only)
+static bool g_page_read_fixed_delay = false;
+
+// Session Context of Opened Device Handle (Per Thread, Each Worker of Multi-Device Mode Owns a Handle)
+static __thread struct session_context g_session_context = {false, 0, false, 0, 0, false, 0};
+
 /***************************************************
  * Function Implements
  ***************************************************/
 
+// Session Context
+void reset_session_context(void)
+{
+    memset(&g_session_context, 0, sizeof(g_session_context));
+    DEBUG_PRINTF("%s: Session context invalidated.\r\n", __func__);
+
+    return;
+}
+
+static int get_session_solution_id(unsigned char *p_solution_id)
+{
+    int err = TP_SUCCESS;
+
+    if(g_session_context.solution_id_valid == false)
+    {
+        // Query Once per Session (get_solution_id() Updates Session Context)
+        err = get_solution_id(&g_session_context.solution_id);
+        if(err != TP_SUCCESS)
+            goto GET_SESSION_SOLUTION_ID_EXIT;
+    }
+
+    *p_solution_id = g_session_context.solution_id;
+    err = TP_SUCCESS;
+
+GET_SESSION_SOLUTION_ID_EXIT:
+    return err;
+}
+
+static int get_session_bc_bc_version(unsigned short *p_bc_version)
+{
+    int err = TP_SUCCESS;
+    unsigned char hello_packet = 0;
+    unsigned short bc_version = 0;
+
+    if(g_session_context.hello_packet_valid == false)
+    {
+        // Query Once per Session (get_hello_packet_bc_version() Updates Session Context)
+        err = get_hello_packet_bc_version(&hello_packet, &bc_version);
+        if(err != TP_SUCCESS)
+            goto GET_SESSION_BC_BC_VERSION_EXIT;
+    }
+
+    *p_bc_version = g_session_context.bc_bc_version;
+    err = TP_SUCCESS;
+
+GET_SESSION_BC_BC_VERSION_EXIT:
+    return err;
+}
+
+int get_session_hello_packet_bc_version(unsigned char *p_hello_packet, unsigned short *p_bc_version, int retry_count)
+{
+    int err = TP_SUCCESS;
+    unsigned char hello_packet = 0;
+    unsigned short bc_version = 0;
+
+    if(g_session_context.hello_packet_valid == false)
+    {
+        // Query Once per Session (get_hello_packet_bc_version() Updates Session Context)
+        err = get_hello_packet_bc_version_with_error_retry(&hello_packet, &bc_version, retry_count);
+        if(err != TP_SUCCESS)
+            goto GET_SESSION_HELLO_PACKET_BC_VERSION_EXIT;
+    }
+    else
+        DEBUG_PRINTF("%s: Hello packet 0x%02x (BC version 0x%04x) cached in session.\r\n", __func__, \
+                     g_session_context.hello_packet, g_session_context.bc_bc_version);
+
+    *p_hello_packet = g_session_context.hello_packet;
+    *p_bc_version = g_session_context.bc_bc_version;
+    err = TP_SUCCESS;
+
+GET_SESSION_HELLO_PACKET_BC_VERSION_EXIT:
+    return err;
+}
+
+int get_session_boot_code_version(unsigned short *p_bc_version)
+{
+    int err = TP_SUCCESS;
+    unsigned short bc_version = 0;
+
+    if(g_session_context.fw_bc_version_valid == false)
+    {
+        // Query Once per Session (get_boot_code_version() Updates Session Context)
+        err = get_boot_code_version(&bc_version);
+        if(err != TP_SUCCESS)
+            goto GET_SESSION_BOOT_CODE_VERSION_EXIT;
+    }
+    else
+        DEBUG_PRINTF("%s: BC version 0x%04x cached in session.\r\n", __func__, g_session_context.fw_bc_version);
+
+    *p_bc_version = g_session_context.fw_bc_version;
+    err = TP_SUCCESS;
+
+GET_SESSION_BOOT_CODE_VERSION_EXIT:
+    return err;
+}
+
 int get_firmware_id(unsigned short *p_fw_id)
 {
     int err = TP_SUCCESS;
@@ -114,6 +251,11 @@ int get_solution_id(unsigned char *p_solution_id)
     DEBUG_PRINTF("Solution ID: 0x%02x.\r\n", solution_id);
 
     *p_solution_id = solution_id;
+
+    // Update Session Context
+    g_session_context.solution_id = solution_id;
+    g_session_context.solution_id_valid = true;
+
     err = TP_SUCCESS;
 
 GET_SOLUTION_ID_EXIT:
@@ -134,6 +276,11 @@ int get_boot_code_version(unsigned short *p_bc_version)
         goto GET_BOOT_CODE_VERSION_EXIT;
 
     *p_bc_version = bc_version;
+
+    // Update Session Context
+    g_session_context.fw_bc_version = bc_version;
+    g_session_context.fw_bc_version_valid = true;
+
     err = TP_SUCCESS;
 
 GET_BOOT_CODE_VERSION_EXIT:
@@ -160,42 +307,19 @@ CALIBRATE_TOUCH_EXIT:
     return err;
 }
 
-int calibrate_touch_with_error_retry(int retry_count)
+static int calibrate_touch_operation(void *p_context)
 {
-    int err = TP_SUCCESS,
-        retry_index = 0;
+    return calibrate_touch();
+}
 
-    // Make Sure Retry Count Positive
-    if(retry_count <= 0)
-        retry_count = 1;
+int calibrate_touch_with_error_retry(int retry_count)
+{
+    struct retry_policy policy;
 
-    for(retry_index = 0; retry_index < retry_count; retry_index++)
-    {
-        err = calibrate_touch();
-        if(err == TP_SUCCESS)
-        {
-            // Without any error => Break retry loop and continue.
-            break;
-        }
+    // Default: Retry every 10ms
+    init_retry_policy(&policy, retry_count, RETRY_BACKOFF_FIXED, 10);
 
-        // With Error => Retry at most 3 times
-        DEBUG_PRINTF("%s: [%d/3] Fail to Calibrate Touch! err=0x%x.\r\n", __func__, retry_index+1, err);
-        if(retry_index == 2)
-        {
-            // Have retried for 3 times and can't fix it => Stop this function
-            ERROR_PRINTF("%s: Fail to Get Information Page! err=0x%x.\r\n", __func__, err);
-            goto CALIBRATE_TOUCH_WITH_ERROR_RETRY_EXIT;
-        }
-        else // retry_index = 0, 1
-        {
-            // wait 10ms
-            usleep(10*1000);
-            continue;
-        }
-    }
-
-CALIBRATE_TOUCH_WITH_ERROR_RETRY_EXIT:
-    return err;
+    return run_with_retry("Calibrate Touch", &policy, calibrate_touch_operation, NULL);
 }
 
 // Hello Packet & BC Version
@@ -244,6 +368,11 @@ int get_hello_packet_bc_version(unsigned char *p_hello_packet, unsigned short *p
     DEBUG_PRINTF("BC Version: %04x.\r\n", bc_version);
     *p_bc_version = bc_version;
 
+    // Update Session Context
+    g_session_context.hello_packet = hello_packet[0];
+    g_session_context.bc_bc_version = bc_version;
+    g_session_context.hello_packet_valid = true;
+
     // Success
     err = TP_SUCCESS;
 
@@ -251,111 +380,214 @@ GET_HELLO_PACKET_BC_VERSION_EXIT:
     return err;
 }
 
+static int get_hello_packet_bc_version_operation(void *p_context)
+{
+    struct hello_packet_retry_context *p_hello_packet_context = (struct hello_packet_retry_context *)p_context;
+
+    return get_hello_packet_bc_version(p_hello_packet_context->p_hello_packet, p_hello_packet_context->p_bc_version);
+}
+
 int get_hello_packet_bc_version_with_error_retry(unsigned char *p_hello_packet, unsigned short *p_bc_version, int retry_count)
 {
-    int err = TP_SUCCESS,
-        retry_index = 0;
+    struct retry_policy policy;
+    struct hello_packet_retry_context context;
 
     // Make Sure Page Data Buffer Valid
     if(p_hello_packet == NULL)
     {
         ERROR_PRINTF("%s: NULL Page Data Buffer!\r\n", __func__);
-        err = TP_ERR_INVALID_PARAM;
-        goto GET_HELLO_PACKET_BC_VERSION_WITH_ERROR_RETRY_EXIT;
+        return TP_ERR_INVALID_PARAM;
     }
 
-    // Make Sure Retry Count Positive
-    if(retry_count <= 0)
-        retry_count = 1;
-
-    for(retry_index = 0; retry_index < retry_count; retry_index++)
-    {
-        err = get_hello_packet_bc_version(p_hello_packet, p_bc_version);
-        if(err == TP_SUCCESS)
-        {
-            // Without any error => Break retry loop and continue.
-            break;
-        }
-
-        // With Error => Retry at most 3 times
-        DEBUG_PRINTF("%s: [%d/3] Fail to Get Hello Packet (& BC Version)! err=0x%x.\r\n", __func__, retry_index+1, err);
-        if(retry_index == 2)
-        {
-            // Have retried for 3 times and can't fix it => Stop this function
-            ERROR_PRINTF("%s: Fail to Get Hello Packet (& BC Version)! err=0x%x.\r\n", __func__, err);
-            goto GET_HELLO_PACKET_BC_VERSION_WITH_ERROR_RETRY_EXIT;
-        }
-        else // retry_index = 0, 1
-        {
-            // wait 50ms
-            usleep(50*1000);
-
-            continue;
-        }
-    }
+    // Default: Retry every 50ms
+    init_retry_policy(&policy, retry_count, RETRY_BACKOFF_FIXED, 50);
+    context.p_hello_packet = p_hello_packet;
+    context.p_bc_version = p_bc_version;
 
-GET_HELLO_PACKET_BC_VERSION_WITH_ERROR_RETRY_EXIT:
-    return err;
+    return run_with_retry("Get Hello Packet (& BC Version)", &policy, get_hello_packet_bc_version_operation, &context);
 }
 
 int get_hello_packet_with_error_retry(unsigned char *p_hello_packet, int retry_count)
 {
-    int err = TP_SUCCESS,
-        retry_index = 0;
+    struct retry_policy policy;
+    struct hello_packet_retry_context context;
     unsigned short bc_bc_version = 0;
 
     // Make Sure Page Data Buffer Valid
     if(p_hello_packet == NULL)
     {
         ERROR_PRINTF("%s: NULL Page Data Buffer!\r\n", __func__);
+        return TP_ERR_INVALID_PARAM;
+    }
+
+    // Default: Retry every 50ms
+    init_retry_policy(&policy, retry_count, RETRY_BACKOFF_FIXED, 50);
+    context.p_hello_packet = p_hello_packet;
+    context.p_bc_version = &bc_bc_version;
+
+    return run_with_retry("Get Hello Packet", &policy, get_hello_packet_bc_version_operation, &context);
+}
+
+void set_page_ready_time(unsigned int ready_time_us)
+{
+    g_page_ready_time_us = ready_time_us;
+    return;
+}
+
+void set_page_read_fixed_delay(bool fixed_delay)
+{
+    g_page_read_fixed_delay = fixed_delay;
+    return;
+}
+
+// ROM Range: Stream Bulk ROM Data Frames of Whole Span into Caller Buffer
+// addr: ROM address (in word), len: data length (in byte, even)
+int read_rom_range(unsigned short addr, unsigned int len, unsigned char *p_buf, size_t buf_size)
+{
+    int err = TP_SUCCESS,
+        read_timeout_ms = 0;
+    unsigned int chunk_addr = 0,
+                 chunk_len = 0,
+                 chunk_offset = 0,
+                 frame_index = 0,
+                 frame_count = 0,
+                 frame_data_len = 0,
+                 data_len = 0;
+    const unsigned char *p_data = NULL;
+    unsigned long long read_latency_us = 0,
+                       command_time_us = 0,
+                       ready_time_us = 0;
+
+    // Make Sure Buffer Valid
+    if(p_buf == NULL)
+    {
+        ERROR_PRINTF("%s: NULL Buffer!\r\n", __func__);
         err = TP_ERR_INVALID_PARAM;
-        goto GET_HELLO_PACKET_WITH_ERROR_RETRY_EXIT;
+        goto READ_ROM_RANGE_EXIT;
     }
 
-    // Make Sure Retry Count Positive
-    if(retry_count <= 0)
-        retry_count = 1;
+    // Make Sure Length Valid (Whole Words, within Buffer & 16-bit Address Space)
+    if((len == 0) || ((len % 2) != 0) || (len > buf_size) || (((unsigned int)addr + (len / 2)) > 0x10000))
+    {
+        ERROR_PRINTF("%s: Invalid Range! (addr=0x%04x, len=%u, buf_size=%zu)\r\n", __func__, addr, len, buf_size);
+        err = TP_ERR_INVALID_PARAM;
+        goto READ_ROM_RANGE_EXIT;
+    }
 
-    for(retry_index = 0; retry_index < retry_count; retry_index++)
+    for(chunk_offset = 0; chunk_offset < len; chunk_offset += chunk_len)
     {
-        err = get_hello_packet_bc_version(p_hello_packet, &bc_bc_version);
-        if(err == TP_SUCCESS)
+        // One Show Bulk ROM Data Command per Chunk
+        chunk_addr = addr + (chunk_offset / 2);
+        chunk_len = len - chunk_offset;
+        if(chunk_len > (ELAN_READ_ROM_RANGE_MAX_WORDS * 2))
+            chunk_len = ELAN_READ_ROM_RANGE_MAX_WORDS * 2;
+
+        // Send Show Bulk ROM Data Command
+        err = send_show_bulk_rom_data_command((unsigned short)chunk_addr, (unsigned short)(chunk_len / 2) /* unit: word */);
+        if(err != TP_SUCCESS)
         {
-            // Without any error => Break retry loop and continue.
-            break;
+            ERROR_PRINTF("%s: Fail to Send Show Bulk ROM Data Command! err=0x%x.\r\n", __func__, err);
+            goto READ_ROM_RANGE_EXIT;
         }
+        command_time_us = get_monotonic_time_us();
 
-        // With Error => Retry at most 3 times
-        DEBUG_PRINTF("%s: [%d/3] Fail to Get Hello Packet! err=0x%x.\r\n", __func__, retry_index+1, err);
-        if(retry_index == 2)
+        // Wait for First Frame on fd instead of Sleeping 20ms
+        if(g_page_read_fixed_delay == true)
+            usleep(ELAN_PAGE_READY_FIXED_DELAY_MSEC * 1000);
+
+        // All Frames of Chunk Share One Read Time Budget
+        frame_count = (chunk_len / ELAN_I2CHID_READ_PAGE_FRAME_SIZE) + \
+                      ((chunk_len % ELAN_I2CHID_READ_PAGE_FRAME_SIZE) != 0);
+        set_read_deadline(ELAN_READ_DATA_TIMEOUT_MSEC + (frame_count * ELAN_READ_ROM_RANGE_FRAME_BUDGET_MSEC));
+
+        // Receive Frames
+        for(frame_index = 0; frame_index < frame_count; frame_index++)
         {
-            // Have retried for 3 times and can't fix it => Stop this function
-            ERROR_PRINTF("%s: Fail to Get Hello Packet! err=0x%x.\r\n", __func__, err);
-            goto GET_HELLO_PACKET_WITH_ERROR_RETRY_EXIT;
+            // Data Length
+            if((frame_index == (frame_count - 1)) && ((chunk_len % ELAN_I2CHID_READ_PAGE_FRAME_SIZE) != 0)) // Last Frame
+                frame_data_len = chunk_len % ELAN_I2CHID_READ_PAGE_FRAME_SIZE;
+            else
+                frame_data_len = ELAN_I2CHID_READ_PAGE_FRAME_SIZE;
+            data_len = 3 /* 1(Packet Header 0x99) + 1(Packet Index) + 1(Data Length) */ + frame_data_len;
+
+            // First Frame: Once Ready Time is Learned, a Lost Command is Detected after a Few Times of It
+            read_timeout_ms = ELAN_READ_DATA_TIMEOUT_MSEC;
+            if((frame_index == 0) && (g_page_ready_time_us != 0))
+            {
+                read_timeout_ms = (int)((g_page_ready_time_us * ELAN_PAGE_READY_TIME_MARGIN) / 1000) + 1;
+                if(read_timeout_ms < ELAN_PAGE_READY_TIMEOUT_MIN_MSEC)
+                    read_timeout_ms = ELAN_PAGE_READY_TIMEOUT_MIN_MSEC;
+                if(read_timeout_ms > ELAN_READ_DATA_TIMEOUT_MSEC)
+                    read_timeout_ms = ELAN_READ_DATA_TIMEOUT_MSEC;
+            }
+
+            // Read $(frame_index)-th Bulk ROM Data Frame (Frame Stays in Report Slot, No Copy)
+            err = read_data_view(&p_data, data_len, read_timeout_ms);
+            if(err != TP_SUCCESS) // Error or Timeout
+            {
+                ERROR_PRINTF("%s: [0x%04x:%d] Fail to Read %d-Byte Data! err=0x%x.\r\n", __func__, chunk_addr, frame_index, data_len, err);
+                goto READ_ROM_RANGE_EXIT;
+            }
+
+            // Validate Packet Header, Packet Index (0 at First Frame of Each Command) & Data Length,
+            // so a stale frame of a previous command is not taken as part of this chunk
+            if(p_data[0] != 0x99)
+            {
+                ERROR_PRINTF("%s: [0x%04x:%d] Invalid Packet Header 0x%02x!\r\n", __func__, chunk_addr, frame_index, p_data[0]);
+                err = TP_ERR_DATA_PATTERN;
+                goto READ_ROM_RANGE_EXIT;
+            }
+            if(p_data[1] != (unsigned char)frame_index)
+            {
+                ERROR_PRINTF("%s: [0x%04x:%d] Packet Index 0x%02x Out of Sequence (Expected 0x%02x)!\r\n", \
+                             __func__, chunk_addr, frame_index, p_data[1], (unsigned char)frame_index);
+                err = TP_ERR_DATA_MISMATCHED;
+                goto READ_ROM_RANGE_EXIT;
+            }
+            if(p_data[2] != frame_data_len)
+            {
+                ERROR_PRINTF("%s: [0x%04x:%d] Data Length %d Mismatched (Expected %d)!\r\n", \
+                             __func__, chunk_addr, frame_index, p_data[2], frame_data_len);
+                err = TP_ERR_DATA_MISMATCHED;
+                goto READ_ROM_RANGE_EXIT;
+            }
+
+            // Device Response Time of This Frame
+            if(get_last_read_latency(&read_latency_us) == TP_SUCCESS)
+                DEBUG_PRINTF("%s: [%d] Frame latency: %llu us.\r\n", __func__, frame_index, read_latency_us);
+
+            // Learn Ready Time from First Frame (Moving Average, 1/8 Weight of New Sample)
+            if((frame_index == 0) && (g_page_read_fixed_delay == false))
+            {
+                ready_time_us = get_elapsed_time_us(command_time_us);
+                if(g_page_ready_time_us == 0)
+                    g_page_ready_time_us = (unsigned int)ready_time_us;
+                else
+                    g_page_ready_time_us = (unsigned int)(((unsigned long long)g_page_ready_time_us * 7 + ready_time_us) / 8);
+                DEBUG_PRINTF("%s: Page ready time: %llu us (typical %u us).\r\n", __func__, ready_time_us, g_page_ready_time_us);
+            }
+
+            // Assemble Frame Data from Report Slot Directly into Caller Buffer
+            memcpy(&p_buf[chunk_offset + (frame_index * ELAN_I2CHID_READ_PAGE_FRAME_SIZE)], &p_data[3], frame_data_len);
+            release_data_view(p_data);
+            p_data = NULL;
         }
-        else // retry_index = 0, 1
-        {
-            // wait 50ms
-            usleep(50*1000);
 
-            continue;
-        }
+        clear_read_deadline();
     }
 
-GET_HELLO_PACKET_WITH_ERROR_RETRY_EXIT:
+    // Success
+    err = TP_SUCCESS;
+
+READ_ROM_RANGE_EXIT:
+    release_data_view(p_data);
+    clear_read_deadline();
     return err;
 }
 
 int read_page_data(unsigned short page_data_addr, unsigned short page_data_size, unsigned char *page_data_buf, size_t page_data_buf_size)
 {
     int err = TP_SUCCESS;
-    unsigned int page_frame_index = 0,
-                 page_frame_count = 0,
-                 page_frame_data_len = 0,
-                 data_len = 0,
-                 page_data_index = 0;
-    unsigned char temp_page_data_buf[ELAN_FIRMWARE_PAGE_DATA_SIZE] = {0},
-                  data_buf[ELAN_I2CHID_DATA_BUFFER_SIZE] = {0};
 
     // Make Sure Page Data Buffer Valid
     if(page_data_buf == NULL)
@@ -366,57 +598,15 @@ int read_page_data(unsigned short page_data_addr, unsigned short page_data_size,
     }
 
     // Make Sure Page Data Buffer Size Valid
-    if(page_data_buf_size == 0)
+    if((page_data_buf_size == 0) || (page_data_buf_size < page_data_size))
     {
-        ERROR_PRINTF("%s: Page Data Buffer Size is Zero!\r\n", __func__);
+        ERROR_PRINTF("%s: Page Data Buffer Size (%zu) Invalid!\r\n", __func__, page_data_buf_size);
         err = TP_ERR_INVALID_PARAM;
         goto READ_PAGE_DATA_EXIT;
     }
 
-    // Send Show Bulk ROM Data Command
-    err = send_show_bulk_rom_data_command(page_data_addr, (page_data_size / 2) /* unit: word */);
-    if(err != TP_SUCCESS)
-    {
-        ERROR_PRINTF("%s: Fail to Send Show Bulk ROM Data Command! err=0x%x.\r\n", __func__, err);
-        goto READ_PAGE_DATA_EXIT;
-    }
-
-    // wait 20ms
-    usleep(20*1000);
-
-    // Receive Page Data
-    page_frame_count = (page_data_size / ELAN_I2CHID_READ_PAGE_FRAME_SIZE) + \
-                       ((page_data_size % ELAN_I2CHID_READ_PAGE_FRAME_SIZE) != 0);
-    for(page_frame_index = 0; page_frame_index < page_frame_count; page_frame_index++)
-    {
-        // Clear Data Buffer
-        memset(data_buf, 0, sizeof(data_buf));
-
-        // Data Length
-        if((page_frame_index == (page_frame_count - 1)) && ((page_data_size % ELAN_I2CHID_READ_PAGE_FRAME_SIZE) != 0)) // Last Frame
-            page_frame_data_len = page_data_size % ELAN_I2CHID_READ_PAGE_FRAME_SIZE;
-        else // (page_frame_index != (page_frame_count -1)) || ((ELAN_FIRMWARE_PAGE_DATA_SIZE % ELAN_I2CHID_READ_PAGE_FRAME_SIZE) == 0)
-            page_frame_data_len = ELAN_I2CHID_READ_PAGE_FRAME_SIZE;
-        data_len = 3 /* 1(Packet Header 0x99) + 1(Packet Index) + 1(Data Length) */ + page_frame_data_len;
-
-        // Read $(page_frame_index)-th Bulk Page Data to Buffer
-        err = read_data(data_buf, data_len, ELAN_READ_DATA_TIMEOUT_MSEC);
-        if(err != TP_SUCCESS) // Error or Timeout
-        {
-            ERROR_PRINTF("%s: [%d] Fail to Read %d-Byte Data! err=0x%x.\r\n", __func__, page_frame_index, data_len, err);
-            goto READ_PAGE_DATA_EXIT;
-        }
-
-        // Copy Read Data to Page Buffer
-        memcpy(&temp_page_data_buf[page_data_index], &data_buf[3], page_frame_data_len);
-        page_data_index += page_frame_data_len;
-    }
-
-    // Copy Page Data to Input Buffer
-    memcpy(page_data_buf, temp_page_data_buf, page_data_size);
-
-    // Success
-    err = TP_SUCCESS;
+    // Stream Page Frames into Page Buffer
+    err = read_rom_range(page_data_addr, page_data_size, page_data_buf, page_data_buf_size);
 
 READ_PAGE_DATA_EXIT:
     return err;
@@ -480,43 +670,24 @@ GET_INFO_PAGE_EXIT_1:
     return err;
 }
 
-int get_info_page_with_error_retry(unsigned char *info_page_buf, size_t info_page_buf_size, int retry_count)
+static int get_info_page_operation(void *p_context)
 {
-    int err = TP_SUCCESS,
-        retry_index = 0;
+    struct info_page_retry_context *p_info_page_context = (struct info_page_retry_context *)p_context;
 
-    // Make Sure Retry Count Positive
-    if(retry_count <= 0)
-        retry_count = 1;
-
-    for(retry_index = 0; retry_index < retry_count; retry_index++)
-    {
-        err = get_info_page(info_page_buf, info_page_buf_size);
-        if(err == TP_SUCCESS)
-        {
-            // Without any error => Break retry loop and continue.
-            break;
-        }
+    return get_info_page(p_info_page_context->info_page_buf, p_info_page_context->info_page_buf_size);
+}
 
-        // With Error => Retry at most 3 times
-        DEBUG_PRINTF("%s: [%d/3] Fail to Get Information Page! err=0x%x.\r\n", __func__, retry_index+1, err);
-        if(retry_index == 2)
-        {
-            // Have retried for 3 times and can't fix it => Stop this function
-            ERROR_PRINTF("%s: Fail to Get Information Page! err=0x%x.\r\n", __func__, err);
-            goto GET_INFO_PAGE_WITH_ERROR_RETRY_EXIT;
-        }
-        else // retry_index = 0, 1
-        {
-            // wait 50ms
-            usleep(50*1000);
+int get_info_page_with_error_retry(unsigned char *info_page_buf, size_t info_page_buf_size, int retry_count)
+{
+    struct retry_policy policy;
+    struct info_page_retry_context context;
 
-            continue;
-        }
-    }
+    // Default: Retry every 50ms
+    init_retry_policy(&policy, retry_count, RETRY_BACKOFF_FIXED, 50);
+    context.info_page_buf = info_page_buf;
+    context.info_page_buf_size = info_page_buf_size;
 
-GET_INFO_PAGE_WITH_ERROR_RETRY_EXIT:
-    return err;
+    return run_with_retry("Get Information Page", &policy, get_info_page_operation, &context);
 }
 
 int get_and_update_info_page(unsigned char solution_id, unsigned char *info_page_buf, size_t info_page_buf_size)
@@ -703,6 +874,9 @@ int switch_to_boot_code(bool recovery)
 {
     int err = TP_SUCCESS;
 
+    // Device Information of Previous Mode No Longer Valid
+    reset_session_context();
+
     // Enter IAP Mode
     if(recovery == false) // Normal IAP
     {
@@ -845,8 +1019,7 @@ int get_rom_data(unsigned short addr, bool recovery, unsigned short *p_data)
     int err = TP_SUCCESS;
     unsigned short bc_bc_version = 0,
                    word_data = 0;
-    unsigned char  hello_packet = 0,
-                   solution_id = 0,
+    unsigned char  solution_id = 0,
                    bc_version_high_byte = 0;
 
     // Check if Parameter Invalid
@@ -859,8 +1032,8 @@ int get_rom_data(unsigned short addr, bool recovery, unsigned short *p_data)
 
     if(!recovery) // Normal Mode
     {
-        // Solution ID
-        err = get_solution_id(&solution_id);
+        // Solution ID (Cached in Session)
+        err = get_session_solution_id(&solution_id);
         if(err != TP_SUCCESS)
         {
             ERROR_PRINTF("%s: Fail to Get Solution ID! err=0x%x.\r\n", __func__, err);
@@ -870,14 +1043,15 @@ int get_rom_data(unsigned short addr, bool recovery, unsigned short *p_data)
     }
     else // Recovery Mode
     {
-        // BC Version (Recovery Mode)
-        err = get_hello_packet_bc_version(&hello_packet, &bc_bc_version);
+        // BC Version (Recovery Mode, Cached in Session)
+        err = get_session_bc_bc_version(&bc_bc_version);
         if(err != TP_SUCCESS)
         {
             ERROR_PRINTF("%s: Fail to Get BC Version (Recovery Mode)! err=0x%x.\r\n", __func__, err);
             goto GET_ROM_DATA_EXIT;
         }
         DEBUG_PRINTF("%s: [Recovery Mode] BC Version: 0x%04x.\r\n", __func__, bc_bc_version);
+        bc_version_high_byte = HIGH_BYTE(bc_bc_version);
     }
 
     /* Read Data from ROM */
@@ -1006,3 +1180,56 @@ READ_INFO_FWID_EXIT:
     return err;
 }
 
+
+// Benchmark
+int benchmark_page_read(int page_count)
+{
+    int err = TP_SUCCESS,
+        mode = 0,
+        page_index = 0;
+    unsigned char page_data_buf[ELAN_FIRMWARE_PAGE_DATA_SIZE] = {0};
+    unsigned long long start_time_us = 0,
+                       elapsed_us = 0,
+                       total_bytes = 0;
+    const char *mode_name[2] = { "Fixed 20ms Delay", "Wait on fd" };
+
+    if(page_count <= 0)
+    {
+        ERROR_PRINTF("%s: Invalid Page Count: %d.\r\n", __func__, page_count);
+        err = TP_ERR_INVALID_PARAM;
+        goto BENCHMARK_PAGE_READ_EXIT;
+    }
+
+    printf("--------------------------------------\r\n");
+    printf("Benchmark: Page Read (%d pages of %d bytes).\r\n", page_count, ELAN_FIRMWARE_PAGE_DATA_SIZE);
+
+    // Mode 0: Fixed Delay (Before), Mode 1: Wait on fd (After)
+    for(mode = 0; mode < 2; mode++)
+    {
+        set_page_read_fixed_delay(mode == 0);
+
+        start_time_us = get_monotonic_time_us();
+        for(page_index = 0; page_index < page_count; page_index++)
+        {
+            err = read_page_data(ELAN_INFO_PAGE_MEMORY_ADDR, ELAN_FIRMWARE_PAGE_DATA_SIZE, page_data_buf, sizeof(page_data_buf));
+            if(err != TP_SUCCESS)
+            {
+                ERROR_PRINTF("%s: [%s] Fail to Read Page %d! err=0x%x.\r\n", __func__, mode_name[mode], page_index, err);
+                goto BENCHMARK_PAGE_READ_EXIT;
+            }
+        }
+        elapsed_us = get_elapsed_time_us(start_time_us);
+        total_bytes = (unsigned long long)page_count * ELAN_FIRMWARE_PAGE_DATA_SIZE;
+
+        printf("%s: %llu us (%llu bytes/s).\r\n", mode_name[mode], elapsed_us, \
+               (elapsed_us != 0) ? ((total_bytes * 1000000ULL) / elapsed_us) : 0ULL);
+    }
+    printf("Typical Page Ready Time: %u us.\r\n", g_page_ready_time_us);
+
+    // Success
+    err = TP_SUCCESS;
+
+BENCHMARK_PAGE_READ_EXIT:
+    set_page_read_fixed_delay(false);
+    return err;
+}
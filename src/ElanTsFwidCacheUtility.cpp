@@ -0,0 +1,272 @@
+/** @file
+
+  Implementation of FWID Resolution Cache Utility for Elan I2C-HID Touchscreen.
+
+  Copyright (c) ELAN microelectronics corp. 2022, All Rights Reserved
+
+  Module Name:
+	ElanTsFwidCacheUtility.cpp
+
+  Environment:
+	All kinds of Linux-like Platform.
+
+**/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>         /* offsetof */
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>     	/* read, write, close, fsync */
+#include <sys/stat.h>       /* stat */
+#include "ErrCode.h"
+#include "ElanTsLcmDevUtility.h"
+#include "ElanTsDefaultFwidMappingUtility.h"
+#include "ElanTsFwidCacheUtility.h"
+
+/***************************************************
+ * Function Prototype
+ ***************************************************/
+
+static uint32_t get_fwid_cache_checksum(const struct fwid_cache_file *p_cache_file);
+
+/***************************************************
+ * Function Implements
+ ***************************************************/
+
+// FNV-1a over Cache File Content (Excluding Checksum Field)
+static uint32_t get_fwid_cache_checksum(const struct fwid_cache_file *p_cache_file)
+{
+    const unsigned char *p_data = (const unsigned char *)p_cache_file;
+    size_t data_size = offsetof(struct fwid_cache_file, checksum),
+           index = 0;
+    uint32_t checksum = 0x811C9DC5;
+
+    for(index = 0; index < data_size; index++)
+    {
+        checksum ^= p_data[index];
+        checksum *= 0x01000193;
+    }
+
+    return checksum;
+}
+
+int get_fwid_cache_key(unsigned short hid_vid, unsigned short hid_pid, unsigned char hello_packet, unsigned short fw_version, \
+                       bool edid_info_found, unsigned short edid_manufacturer_code, unsigned short edid_product_code, \
+                       const char *p_fwid_mapping_file_path, struct fwid_cache_key *p_cache_key)
+{
+    int err = TP_SUCCESS;
+    struct stat mapping_file_stat;
+    char image_file_path[FILE_NAME_LENGTH_MAX + sizeof(FWID_MAPPING_IMAGE_SUFFIX)] = {0};
+
+    // Validate Input Parameter
+    if(p_cache_key == NULL)
+    {
+        ERROR_PRINTF("%s: NULL Pointer!\r\n", __func__);
+        err = TP_ERR_INVALID_PARAM;
+        goto GET_FWID_CACHE_KEY_EXIT;
+    }
+
+    // Zero Padding Bytes, since Key is Compared in Binary Form
+    memset(p_cache_key, 0, sizeof(struct fwid_cache_key));
+
+    // Touch Device Identity
+    p_cache_key->hid_vid = hid_vid;
+    p_cache_key->hid_pid = hid_pid;
+
+    // Firmware Identity (FW Update or Entering Recovery Mode Changes Information FWID)
+    p_cache_key->hello_packet = hello_packet;
+    p_cache_key->fw_version = fw_version;
+
+    // Panel Identity
+    p_cache_key->edid_info_found = (edid_info_found) ? 1 : 0;
+    if(edid_info_found == true)
+    {
+        p_cache_key->edid_manufacturer_code = edid_manufacturer_code;
+        p_cache_key->edid_product_code = edid_product_code;
+    }
+
+    // Built-in Mapping Table Identity (Changes when Binary is Rebuilt with Another Table)
+    p_cache_key->default_mapping_checksum = get_default_fwid_mapping_checksum();
+
+    // FWID Mapping File Identity (Any Edit Changes mtime / size / inode)
+    if((p_fwid_mapping_file_path != NULL) && (strcmp(p_fwid_mapping_file_path, "") != 0))
+    {
+        if(stat(p_fwid_mapping_file_path, &mapping_file_stat) != 0)
+        {
+            ERROR_PRINTF("%s: Fail to stat FWID mapping file \"%s\"! errno=%d.\r\n", __func__, p_fwid_mapping_file_path, errno);
+            err = TP_ERR_FILE_NOT_FOUND;
+            goto GET_FWID_CACHE_KEY_EXIT;
+        }
+
+        p_cache_key->mapping_file_size = (uint32_t)mapping_file_stat.st_size;
+        p_cache_key->mapping_file_mtime_sec = (int64_t)mapping_file_stat.st_mtim.tv_sec;
+        p_cache_key->mapping_file_mtime_nsec = (int64_t)mapping_file_stat.st_mtim.tv_nsec;
+        p_cache_key->mapping_file_inode = (uint64_t)mapping_file_stat.st_ino;
+
+        // Compiled Image is Loaded instead of Text File, Rebuilt or Replaced on Its Own
+        snprintf(image_file_path, sizeof(image_file_path), "%s%s", p_fwid_mapping_file_path, FWID_MAPPING_IMAGE_SUFFIX);
+        if(stat(image_file_path, &mapping_file_stat) == 0)
+        {
+            p_cache_key->mapping_image_size = (uint32_t)mapping_file_stat.st_size;
+            p_cache_key->mapping_image_mtime_sec = (int64_t)mapping_file_stat.st_mtim.tv_sec;
+            p_cache_key->mapping_image_mtime_nsec = (int64_t)mapping_file_stat.st_mtim.tv_nsec;
+            p_cache_key->mapping_image_inode = (uint64_t)mapping_file_stat.st_ino;
+        }
+    }
+
+    DEBUG_PRINTF("%s: VID=0x%04x, PID=0x%04x, hello=0x%02x, fw_version=0x%04x, EDID=%s(%04x:%04x), mapping: size=%u, mtime=%lld.%09lld, inode=%llu, image: size=%u, mtime=%lld.%09lld, inode=%llu.\r\n", \
+                 __func__, p_cache_key->hid_vid, p_cache_key->hid_pid, p_cache_key->hello_packet, p_cache_key->fw_version, \
+                 (p_cache_key->edid_info_found) ? "found" : "not found", \
+                 p_cache_key->edid_manufacturer_code, p_cache_key->edid_product_code, \
+                 p_cache_key->mapping_file_size, \
+                 (long long)p_cache_key->mapping_file_mtime_sec, (long long)p_cache_key->mapping_file_mtime_nsec, \
+                 (unsigned long long)p_cache_key->mapping_file_inode, p_cache_key->mapping_image_size, \
+                 (long long)p_cache_key->mapping_image_mtime_sec, (long long)p_cache_key->mapping_image_mtime_nsec, \
+                 (unsigned long long)p_cache_key->mapping_image_inode);
+
+    // Success
+    err = TP_SUCCESS;
+
+GET_FWID_CACHE_KEY_EXIT:
+    return err;
+}
+
+int load_fwid_cache(const char *p_cache_file_path, struct fwid_cache_key *p_cache_key, struct fwid_cache_data *p_cache_data)
+{
+    int err = TP_SUCCESS,
+        fd = -1;
+    ssize_t read_size = 0;
+    struct fwid_cache_file cache_file;
+
+    // Validate Input Parameter
+    if((p_cache_file_path == NULL) || (p_cache_key == NULL) || (p_cache_data == NULL))
+    {
+        ERROR_PRINTF("%s: NULL Pointer! (p_cache_file_path=%p, p_cache_key=%p, p_cache_data=%p)\r\n", \
+                     __func__, p_cache_file_path, p_cache_key, p_cache_data);
+        err = TP_ERR_INVALID_PARAM;
+        goto LOAD_FWID_CACHE_EXIT;
+    }
+
+    // Open Cache File
+    fd = open(p_cache_file_path, O_RDONLY);
+    if(fd < 0)
+    {
+        DEBUG_PRINTF("%s: No cache file \"%s\". errno=%d.\r\n", __func__, p_cache_file_path, errno);
+        err = TP_ERR_FILE_NOT_FOUND;
+        goto LOAD_FWID_CACHE_EXIT;
+    }
+
+    // Read Whole Record
+    memset(&cache_file, 0, sizeof(cache_file));
+    read_size = read(fd, &cache_file, sizeof(cache_file));
+    if(read_size != (ssize_t)sizeof(cache_file))
+    {
+        DEBUG_PRINTF("%s: Cache file truncated! (read_size=%ld, expected=%ld)\r\n", __func__, (long)read_size, (long)sizeof(cache_file));
+        err = TP_ERR_DATA_MISMATCHED;
+        goto LOAD_FWID_CACHE_EXIT;
+    }
+
+    // Validate Header & Checksum
+    if((cache_file.magic != FWID_CACHE_MAGIC) || (cache_file.version != FWID_CACHE_VERSION))
+    {
+        DEBUG_PRINTF("%s: Invalid cache header! (magic=0x%08x, version=%u)\r\n", __func__, cache_file.magic, cache_file.version);
+        err = TP_ERR_DATA_MISMATCHED;
+        goto LOAD_FWID_CACHE_EXIT;
+    }
+    if(cache_file.checksum != get_fwid_cache_checksum(&cache_file))
+    {
+        DEBUG_PRINTF("%s: Cache checksum mismatched! (checksum=0x%08x)\r\n", __func__, cache_file.checksum);
+        err = TP_ERR_DATA_MISMATCHED;
+        goto LOAD_FWID_CACHE_EXIT;
+    }
+
+    // Compare Key: Device / Firmware / Panel / Mapping File Changed => Miss
+    if(memcmp(&cache_file.key, p_cache_key, sizeof(struct fwid_cache_key)) != 0)
+    {
+        DEBUG_PRINTF("%s: Cache key mismatched.\r\n", __func__);
+        err = TP_ERR_DATA_NOT_FOUND;
+        goto LOAD_FWID_CACHE_EXIT;
+    }
+
+    // Hit
+    memcpy(p_cache_data, &cache_file.data, sizeof(struct fwid_cache_data));
+    DEBUG_PRINTF("%s: Cache hit. (info_fwid=0x%04x, chrome_fwid=0x%04x, windows_fwid=0x%04x)\r\n", \
+                 __func__, p_cache_data->info_fwid, p_cache_data->chrome_fwid, p_cache_data->windows_fwid);
+
+    // Success
+    err = TP_SUCCESS;
+
+LOAD_FWID_CACHE_EXIT:
+    if(fd >= 0)
+        close(fd);
+
+    return err;
+}
+
+int save_fwid_cache(const char *p_cache_file_path, struct fwid_cache_key *p_cache_key, struct fwid_cache_data *p_cache_data)
+{
+    int err = TP_SUCCESS,
+        fd = -1;
+    ssize_t write_size = 0;
+    char temp_file_path[FILE_NAME_LENGTH_MAX + 16] = {0};
+    struct fwid_cache_file cache_file;
+
+    // Validate Input Parameter
+    if((p_cache_file_path == NULL) || (p_cache_key == NULL) || (p_cache_data == NULL))
+    {
+        ERROR_PRINTF("%s: NULL Pointer! (p_cache_file_path=%p, p_cache_key=%p, p_cache_data=%p)\r\n", \
+                     __func__, p_cache_file_path, p_cache_key, p_cache_data);
+        err = TP_ERR_INVALID_PARAM;
+        goto SAVE_FWID_CACHE_EXIT;
+    }
+
+    // Build Record
+    memset(&cache_file, 0, sizeof(cache_file));
+    cache_file.magic = FWID_CACHE_MAGIC;
+    cache_file.version = FWID_CACHE_VERSION;
+    memcpy(&cache_file.key, p_cache_key, sizeof(struct fwid_cache_key));
+    memcpy(&cache_file.data, p_cache_data, sizeof(struct fwid_cache_data));
+    cache_file.checksum = get_fwid_cache_checksum(&cache_file);
+
+    // Write to Temporary File, then Rename, so Readers Never See a Partial Record
+    snprintf(temp_file_path, sizeof(temp_file_path), "%s.%d", p_cache_file_path, (int)getpid());
+    fd = open(temp_file_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if(fd < 0)
+    {
+        ERROR_PRINTF("%s: Fail to create \"%s\"! errno=%d.\r\n", __func__, temp_file_path, errno);
+        err = TP_ERR_FILE_IO_ERROR;
+        goto SAVE_FWID_CACHE_EXIT;
+    }
+
+    write_size = write(fd, &cache_file, sizeof(cache_file));
+    if((write_size != (ssize_t)sizeof(cache_file)) || (fsync(fd) != 0))
+    {
+        ERROR_PRINTF("%s: Fail to write \"%s\"! (write_size=%ld, errno=%d)\r\n", __func__, temp_file_path, (long)write_size, errno);
+        err = TP_ERR_FILE_IO_ERROR;
+        goto SAVE_FWID_CACHE_EXIT;
+    }
+
+    close(fd);
+    fd = -1;
+
+    if(rename(temp_file_path, p_cache_file_path) != 0)
+    {
+        ERROR_PRINTF("%s: Fail to rename \"%s\" to \"%s\"! errno=%d.\r\n", __func__, temp_file_path, p_cache_file_path, errno);
+        err = TP_ERR_FILE_IO_ERROR;
+        goto SAVE_FWID_CACHE_EXIT;
+    }
+    DEBUG_PRINTF("%s: Cache saved to \"%s\".\r\n", __func__, p_cache_file_path);
+
+    // Success
+    err = TP_SUCCESS;
+
+SAVE_FWID_CACHE_EXIT:
+    if(fd >= 0)
+        close(fd);
+    if((err != TP_SUCCESS) && (strcmp(temp_file_path, "") != 0))
+        unlink(temp_file_path);
+
+    return err;
+}
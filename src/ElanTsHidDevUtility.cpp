@@ -20,6 +20,7 @@
 #include <dirent.h>         /* opendir, readdir, closedir */
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <sys/ioctl.h>		/* ioctl */
 #include <linux/input.h>	/* BUS_TYPE */
 #include "ErrCode.h"
 #include "ElanTsHidDevUtility.h"
@@ -28,6 +29,19 @@
  * Global Variable Declaration
  ***************************************************/
 
+// HID Device Inventory
+static struct hid_dev_entry g_hid_dev_inventory[DEV_INFO_SET_MAX];
+static int g_hid_dev_count = 0;
+static bool g_hid_dev_inventory_built = false;
+static pthread_mutex_t g_hid_dev_inventory_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/***************************************************
+ * Function Prototype
+ ***************************************************/
+
+static int read_hid_dev_uevent(const char *p_dev_name, struct hid_dev_entry *p_entry);
+static int read_hid_dev_ioctl(struct hid_dev_entry *p_entry);
+
 /***************************************************
  * Function Implements
  ***************************************************/
@@ -58,77 +72,235 @@ const char* bus_str(int bus)
     }
 }
 
-int get_hid_dev_info(struct hidraw_devinfo *p_hid_dev_info, size_t dev_info_size)
+// Identity from /sys/class/hidraw/<dev>/device/uevent (No Device Open)
+static int read_hid_dev_uevent(const char *p_dev_name, struct hid_dev_entry *p_entry)
+{
+    int err = TP_SUCCESS;
+    unsigned int bus = 0,
+                 vid = 0,
+                 pid = 0;
+    bool id_found = false;
+    FILE *p_file = NULL;
+    char uevent_path[128] = {0},
+         line[256] = {0};
+    size_t line_len = 0;
+
+    snprintf(uevent_path, sizeof(uevent_path), "%s/%s/device/uevent", HIDRAW_SYSFS_ROOT, p_dev_name);
+    p_file = fopen(uevent_path, "r");
+    if(p_file == NULL)
+    {
+        err = TP_ERR_FILE_NOT_FOUND;
+        goto READ_HID_DEV_UEVENT_EXIT;
+    }
+
+    while(fgets(line, sizeof(line), p_file) != NULL)
+    {
+        // Remove Line Break
+        line_len = strlen(line);
+        if((line_len > 0) && (line[line_len - 1] == '\n'))
+            line[line_len - 1] = '\0';
+
+        // ex: HID_ID=0018:000004F3:00002A1C
+        if(strncmp(line, "HID_ID=", 7) == 0)
+        {
+            if(sscanf(&line[7], "%x:%x:%x", &bus, &vid, &pid) == 3)
+                id_found = true;
+        }
+        else if(strncmp(line, "HID_NAME=", 9) == 0)
+            snprintf(p_entry->name, sizeof(p_entry->name), "%s", &line[9]);
+        else if(strncmp(line, "HID_PHYS=", 9) == 0)
+            snprintf(p_entry->phys, sizeof(p_entry->phys), "%s", &line[9]);
+    }
+    fclose(p_file);
+
+    if(id_found == false)
+    {
+        err = TP_ERR_DATA_NOT_FOUND;
+        goto READ_HID_DEV_UEVENT_EXIT;
+    }
+
+    p_entry->info.bustype = bus;
+    p_entry->info.vendor = (short)vid;
+    p_entry->info.product = (short)pid;
+
+    // Success
+    err = TP_SUCCESS;
+
+READ_HID_DEV_UEVENT_EXIT:
+    return err;
+}
+
+// Identity from HIDIOCGRAWINFO (Fallback if sysfs Not Available)
+static int read_hid_dev_ioctl(struct hid_dev_entry *p_entry)
 {
     int err = TP_SUCCESS,
-        ret = 0,
-        index = 0,
         fd = 0;
-    DIR *pDirectory = NULL;
-    struct dirent *pDirEntry = NULL;
-    const char *pszPath = "/dev";
-    char szFile[64] = {0};
-    struct hidraw_devinfo dev_info;
 
-    // Check if Parameter Invalid
-    if ((p_hid_dev_info == NULL) || (dev_info_size == 0))
+    /* Open the Device with non-blocking reads */
+    fd = open(p_entry->path, O_RDWR | O_NONBLOCK);
+    if (fd < 0)
     {
-        ERROR_PRINTF("%s: Invalid Parameter! (p_hid_dev_info=0x%p, dev_info_size=%zd)\r\n", __func__, p_hid_dev_info, dev_info_size);
-        err = TP_ERR_INVALID_PARAM;
-        goto GET_HID_DEV_INFO_EXIT;
+        DEBUG_PRINTF("%s: Fail to Open Device %s! errno=%d.\r\n", __func__, p_entry->path, fd);
+        err = TP_ERR_NOT_FOUND_DEVICE;
+        goto READ_HID_DEV_IOCTL_EXIT;
+    }
+
+    /* Get Raw Info */
+    if (ioctl(fd, HIDIOCGRAWINFO, &p_entry->info) < 0)
+    {
+        err = TP_ERR_IO_ERROR;
+        goto READ_HID_DEV_IOCTL_CLOSE;
     }
+    ioctl(fd, HIDIOCGRAWNAME(sizeof(p_entry->name) - 1), p_entry->name);
+    ioctl(fd, HIDIOCGRAWPHYS(sizeof(p_entry->phys) - 1), p_entry->phys);
+
+    // Success
+    err = TP_SUCCESS;
+
+READ_HID_DEV_IOCTL_CLOSE:
+    // Close Device
+    close(fd);
+
+READ_HID_DEV_IOCTL_EXIT:
+    return err;
+}
+
+int build_hid_dev_inventory(bool rescan)
+{
+    int err = TP_SUCCESS;
+    DIR *pDirectory = NULL;
+    struct dirent *pDirEntry = NULL;
+    const char *pszPath = HIDRAW_SYSFS_ROOT;
+    bool sysfs = true;
+    struct hid_dev_entry *p_entry = NULL;
+
+    pthread_mutex_lock(&g_hid_dev_inventory_mutex);
 
-    // Open Directory
+    // Already Enumerated in This Run
+    if((g_hid_dev_inventory_built == true) && (rescan == false))
+        goto BUILD_HID_DEV_INVENTORY_UNLOCK;
+
+    memset(g_hid_dev_inventory, 0, sizeof(g_hid_dev_inventory));
+    g_hid_dev_count = 0;
+    g_hid_dev_inventory_built = false;
+
+    // Open Directory (Fall back to Device Nodes if sysfs Not Mounted)
     pDirectory = opendir(pszPath);
     if (pDirectory == NULL)
+    {
+        DEBUG_PRINTF("%s: Fail to Open Directory %s, fall back to %s.\r\n", __func__, pszPath, HIDRAW_DEV_ROOT);
+        sysfs = false;
+        pszPath = HIDRAW_DEV_ROOT;
+        pDirectory = opendir(pszPath);
+    }
+    if (pDirectory == NULL)
     {
         ERROR_PRINTF("%s: Fail to Open Directory %s.\r\n", __func__, pszPath);
         err = TP_ERR_NOT_FOUND_DEVICE;
-        goto GET_HID_DEV_INFO_EXIT;
+        goto BUILD_HID_DEV_INVENTORY_UNLOCK;
     }
 
     // Traverse Directory Elements
-    while ((pDirEntry = readdir(pDirectory)) != NULL)
+    while (((pDirEntry = readdir(pDirectory)) != NULL) && (g_hid_dev_count < DEV_INFO_SET_MAX))
     {
         // Only reserve hidraw devices
         if (strncmp(pDirEntry->d_name, "hidraw", 6))
             continue;
 
-        memset(szFile, 0, sizeof(szFile));
-        sprintf(szFile, "%s/%s", pszPath, pDirEntry->d_name);
-        DEBUG_PRINTF("%s: file=\"%s\".\r\n", __func__, szFile);
+        p_entry = &g_hid_dev_inventory[g_hid_dev_count];
+        memset(p_entry, 0, sizeof(struct hid_dev_entry));
+        snprintf(p_entry->path, sizeof(p_entry->path), "%s/%s", HIDRAW_DEV_ROOT, pDirEntry->d_name);
+        DEBUG_PRINTF("%s: file=\"%s\".\r\n", __func__, p_entry->path);
 
-        /* Open the Device with non-blocking reads */
-        fd = open(szFile, O_RDWR | O_NONBLOCK);
-        if (fd < 0)
+        // Open Device Node only if uevent is Not Available
+        if ((sysfs == false) || (read_hid_dev_uevent(pDirEntry->d_name, p_entry) != TP_SUCCESS))
         {
-            DEBUG_PRINTF("%s: Fail to Open Device %s! errno=%d.\r\n", __func__, pDirEntry->d_name, fd);
-            continue;
+            if (read_hid_dev_ioctl(p_entry) != TP_SUCCESS)
+                continue;
         }
 
-        /* Get Raw Info */
-        ret = ioctl(fd, HIDIOCGRAWINFO, &dev_info);
-        if (ret >= 0)
-        {
-            DEBUG_PRINTF("--------------------------------\r\n");
-            DEBUG_PRINTF("\tbustype: 0x%02x (%s)\r\n", dev_info.bustype, bus_str(dev_info.bustype));
-            DEBUG_PRINTF("\tvendor: 0x%04hx\r\n", dev_info.vendor);
-            DEBUG_PRINTF("\tproduct: 0x%04hx\r\n", dev_info.product);
-
-            if(index < DEV_INFO_SET_MAX)
-            {
-                memcpy(&p_hid_dev_info[index], &dev_info, sizeof(struct hidraw_devinfo));
-                index++;
-            }
-        }
+        DEBUG_PRINTF("--------------------------------\r\n");
+        DEBUG_PRINTF("\tbustype: 0x%02x (%s)\r\n", p_entry->info.bustype, bus_str(p_entry->info.bustype));
+        DEBUG_PRINTF("\tvendor: 0x%04hx\r\n", p_entry->info.vendor);
+        DEBUG_PRINTF("\tproduct: 0x%04hx\r\n", p_entry->info.product);
+        DEBUG_PRINTF("\tname: \"%s\", phys: \"%s\"\r\n", p_entry->name, p_entry->phys);
 
-        // Close Device
-        close(fd);
+        g_hid_dev_count++;
     }
 
     // Close Directory
     closedir(pDirectory);
 
+    g_hid_dev_inventory_built = true;
+    err = TP_SUCCESS;
+
+BUILD_HID_DEV_INVENTORY_UNLOCK:
+    pthread_mutex_unlock(&g_hid_dev_inventory_mutex);
+    return err;
+}
+
+int get_hid_dev_count(void)
+{
+    int count = 0;
+
+    pthread_mutex_lock(&g_hid_dev_inventory_mutex);
+    count = g_hid_dev_count;
+    pthread_mutex_unlock(&g_hid_dev_inventory_mutex);
+
+    return count;
+}
+
+int get_hid_dev_entry(int index, struct hid_dev_entry *p_entry)
+{
+    int err = TP_SUCCESS;
+
+    // Check if Parameter Invalid
+    if (p_entry == NULL)
+    {
+        ERROR_PRINTF("%s: Invalid Parameter! (p_entry=0x%p)\r\n", __func__, p_entry);
+        err = TP_ERR_INVALID_PARAM;
+        goto GET_HID_DEV_ENTRY_EXIT;
+    }
+
+    pthread_mutex_lock(&g_hid_dev_inventory_mutex);
+    if ((index < 0) || (index >= g_hid_dev_count))
+        err = TP_ERR_DATA_NOT_FOUND;
+    else
+        memcpy(p_entry, &g_hid_dev_inventory[index], sizeof(struct hid_dev_entry));
+    pthread_mutex_unlock(&g_hid_dev_inventory_mutex);
+
+GET_HID_DEV_ENTRY_EXIT:
+    return err;
+}
+
+int get_hid_dev_info(struct hidraw_devinfo *p_hid_dev_info, size_t dev_info_size)
+{
+    int err = TP_SUCCESS,
+        index = 0,
+        dev_count = 0;
+    struct hid_dev_entry entry;
+
+    // Check if Parameter Invalid
+    if ((p_hid_dev_info == NULL) || (dev_info_size == 0))
+    {
+        ERROR_PRINTF("%s: Invalid Parameter! (p_hid_dev_info=0x%p, dev_info_size=%zu)\r\n", __func__, p_hid_dev_info, dev_info_size);
+        err = TP_ERR_INVALID_PARAM;
+        goto GET_HID_DEV_INFO_EXIT;
+    }
+
+    // Enumerate Once (Reuse Inventory Built by Device Open)
+    err = build_hid_dev_inventory(false);
+    if (err != TP_SUCCESS)
+        goto GET_HID_DEV_INFO_EXIT;
+
+    dev_count = get_hid_dev_count();
+    for (index = 0; (index < dev_count) && ((size_t)index < (dev_info_size / sizeof(struct hidraw_devinfo))); index++)
+    {
+        if (get_hid_dev_entry(index, &entry) != TP_SUCCESS)
+            break;
+        memcpy(&p_hid_dev_info[index], &entry.info, sizeof(struct hidraw_devinfo));
+    }
+
 GET_HID_DEV_INFO_EXIT:
     return err;
 }
@@ -141,7 +313,7 @@ int show_hid_dev_info(struct hidraw_devinfo *p_hid_dev_info, size_t dev_info_siz
     // Check if Parameter Invalid
     if ((p_hid_dev_info == NULL) || (dev_info_size == 0))
     {
-        ERROR_PRINTF("%s: Invalid Parameter! (hid_dev_info=0x%p, dev_info_size=%zd)\r\n", __func__, p_hid_dev_info, dev_info_size);
+        ERROR_PRINTF("%s: Invalid Parameter! (hid_dev_info=0x%p, dev_info_size=%zu)\r\n", __func__, p_hid_dev_info, dev_info_size);
         err = TP_ERR_INVALID_PARAM;
         goto SHOW_HID_DEV_INFO_EXIT;
     }
@@ -171,7 +343,7 @@ int validate_elan_hid_device(struct hidraw_devinfo *p_hid_dev_info, size_t dev_i
     // Check if Parameter Invalid
     if ((p_hid_dev_info == NULL) || (dev_info_size == 0))
     {
-        ERROR_PRINTF("%s: Invalid Parameter! (p_hid_dev_info=0x%p, dev_info_size=%zd)\r\n", __func__, p_hid_dev_info, dev_info_size);
+        ERROR_PRINTF("%s: Invalid Parameter! (p_hid_dev_info=0x%p, dev_info_size=%zu)\r\n", __func__, p_hid_dev_info, dev_info_size);
         err = TP_ERR_INVALID_PARAM;
         goto VALIDATE_ELAN_HID_DEVICE_EXIT;
     }
@@ -28,7 +28,7 @@ int send_set_power_status_command(int mode)
     set_pwr_status_cmd[1] |= mode;
 
     /* Send Set Pwr Status Command */
-    DEBUG_PRINTF("cmd: 0x%02x, 0x%02x, 0x%02x, 0x%02x.\r\n", set_pwr_status_cmd[0], set_pwr_status_cmd[1], \
+    TRACE_PRINTF("cmd: 0x%02x, 0x%02x, 0x%02x, 0x%02x.\r\n", set_pwr_status_cmd[0], set_pwr_status_cmd[1], \
                  set_pwr_status_cmd[2], set_pwr_status_cmd[3]);
     err = write_cmd(set_pwr_status_cmd, 4, ELAN_WRITE_DATA_TIMEOUT_MSEC);
     if (err != TP_SUCCESS)
@@ -45,7 +45,7 @@ int send_fw_id_command(void)
 
 
     /* Send FW ID Command to touch */
-    DEBUG_PRINTF("cmd: 0x%x, 0x%x, 0x%x, 0x%x.\r\n", fw_id_cmd[0], fw_id_cmd[1], fw_id_cmd[2], fw_id_cmd[3]);
+    TRACE_PRINTF("cmd: 0x%x, 0x%x, 0x%x, 0x%x.\r\n", fw_id_cmd[0], fw_id_cmd[1], fw_id_cmd[2], fw_id_cmd[3]);
     err = write_cmd(fw_id_cmd, sizeof(fw_id_cmd), ELAN_WRITE_DATA_TIMEOUT_MSEC);
     if (err != TP_SUCCESS)
         ERROR_PRINTF("Fail to send FW ID command! err=0x%x.\r\n", err);
@@ -66,7 +66,7 @@ int read_fw_id_data(void)
         ERROR_PRINTF("Fail to read FW ID data, err=0x%x.\n", err);
         goto READ_FW_ID_DATA_EXIT;
     }
-    DEBUG_PRINTF("cmd_data: 0x%x, 0x%x, 0x%x, 0x%x.\r\n", cmd_data[0], cmd_data[1], cmd_data[2], cmd_data[3]);
+    TRACE_PRINTF("cmd_data: 0x%x, 0x%x, 0x%x, 0x%x.\r\n", cmd_data[0], cmd_data[1], cmd_data[2], cmd_data[3]);
 
     /* Check if Data is Firmware ID */
     if ((cmd_data[0] == 0x52) && (((cmd_data[1] & 0xf0) >> 4) == 0xf))
@@ -96,7 +96,7 @@ int get_fw_id_data(unsigned short *p_fw_id)
         ERROR_PRINTF("Fail to read FW ID data, err=0x%x.\n", err);
         goto GET_FW_ID_DATA_EXIT;
     }
-    DEBUG_PRINTF("cmd_data: 0x%x, 0x%x, 0x%x, 0x%x.\r\n", cmd_data[0], cmd_data[1], cmd_data[2], cmd_data[3]);
+    TRACE_PRINTF("cmd_data: 0x%x, 0x%x, 0x%x, 0x%x.\r\n", cmd_data[0], cmd_data[1], cmd_data[2], cmd_data[3]);
 
     /* Check if Data is Firmware ID */
     if ((cmd_data[0] != 0x52) || (((cmd_data[1] & 0xf0) >> 4) != 0xf))
@@ -125,7 +125,7 @@ int send_fw_version_command(void)
     unsigned char fw_ver_cmd[4] = {0x53, 0x00, 0x00, 0x01};
 
     /* Send FW ID Command to touch */
-    DEBUG_PRINTF("cmd: 0x%02x, 0x%02x, 0x%02x, 0x%02x.\r\n", fw_ver_cmd[0], fw_ver_cmd[1], fw_ver_cmd[2], fw_ver_cmd[3]);
+    TRACE_PRINTF("cmd: 0x%02x, 0x%02x, 0x%02x, 0x%02x.\r\n", fw_ver_cmd[0], fw_ver_cmd[1], fw_ver_cmd[2], fw_ver_cmd[3]);
     err = write_cmd(fw_ver_cmd, sizeof(fw_ver_cmd), ELAN_WRITE_DATA_TIMEOUT_MSEC);
     if (err != TP_SUCCESS)
         ERROR_PRINTF("Fail to send FW Version command! err=0x%x.\r\n", err);
@@ -147,7 +147,7 @@ int read_fw_version_data(bool quiet /* Silent Mode */)
         ERROR_PRINTF("Fail to read FW Version data, err=0x%x.\r\n", err);
         goto READ_FW_VERSION_DATA_EXIT;
     }
-    DEBUG_PRINTF("cmd_data: 0x%02x, 0x%02x, 0x%02x, 0x%02x.\r\n", cmd_data[0], cmd_data[1], cmd_data[2], cmd_data[3]);
+    TRACE_PRINTF("cmd_data: 0x%02x, 0x%02x, 0x%02x, 0x%02x.\r\n", cmd_data[0], cmd_data[1], cmd_data[2], cmd_data[3]);
 
     /* Check if Data is Firmware Version */
     if ((cmd_data[0] == 0x52) && (((cmd_data[1] & 0xf0) >> 4) == 0))
@@ -189,7 +189,7 @@ int get_fw_version_data(unsigned short *p_fw_version)
         ERROR_PRINTF("Fail to read FW Version data, err=0x%x.\r\n", err);
         goto GET_FW_VERSION_DATA_EXIT;
     }
-    DEBUG_PRINTF("cmd_data: 0x%02x, 0x%02x, 0x%02x, 0x%02x.\r\n", cmd_data[0], cmd_data[1], cmd_data[2], cmd_data[3]);
+    TRACE_PRINTF("cmd_data: 0x%02x, 0x%02x, 0x%02x, 0x%02x.\r\n", cmd_data[0], cmd_data[1], cmd_data[2], cmd_data[3]);
 
     /* Check if Data is Firmware Version */
     if ((cmd_data[0] != 0x52) || (((cmd_data[1] & 0xf0) >> 4) != 0))
@@ -217,7 +217,7 @@ int send_test_version_command(void)
     unsigned char test_ver_cmd[4] = {0x53, 0xe0, 0x00, 0x01};
 
     /* Send Test Version Command to touch */
-    DEBUG_PRINTF("cmd: 0x%x, 0x%x, 0x%x, 0x%x.\r\n", test_ver_cmd[0], test_ver_cmd[1], test_ver_cmd[2], test_ver_cmd[3]);
+    TRACE_PRINTF("cmd: 0x%x, 0x%x, 0x%x, 0x%x.\r\n", test_ver_cmd[0], test_ver_cmd[1], test_ver_cmd[2], test_ver_cmd[3]);
     err = write_cmd(test_ver_cmd, sizeof(test_ver_cmd), ELAN_WRITE_DATA_TIMEOUT_MSEC);
     if (err != TP_SUCCESS)
         ERROR_PRINTF("Fail to send Test Version command! err=0x%x.\r\n", err);
@@ -239,7 +239,7 @@ int read_test_version_data(void)
         ERROR_PRINTF("Fail to receive Test Version data, err=0x%x.\r\n", err);
         goto READ_TEST_VERSION_DATA_EXIT;
     }
-    DEBUG_PRINTF("cmd_data: 0x%x, 0x%x, 0x%x, 0x%x.\r\n", cmd_data[0], cmd_data[1], cmd_data[2], cmd_data[3]);
+    TRACE_PRINTF("cmd_data: 0x%x, 0x%x, 0x%x, 0x%x.\r\n", cmd_data[0], cmd_data[1], cmd_data[2], cmd_data[3]);
 
     /* Check if Data is for Test Version */
     if ((cmd_data[0] == 0x52) && (((cmd_data[1] & 0xf0) >> 4) == 0xe))
@@ -269,7 +269,7 @@ int get_test_version_data(unsigned short *p_test_version)
         ERROR_PRINTF("Fail to receive Test Version data, err=0x%x.\r\n", err);
         goto GET_TEST_VERSION_DATA_EXIT;
     }
-    DEBUG_PRINTF("cmd_data: 0x%x, 0x%x, 0x%x, 0x%x.\r\n", cmd_data[0], cmd_data[1], cmd_data[2], cmd_data[3]);
+    TRACE_PRINTF("cmd_data: 0x%x, 0x%x, 0x%x, 0x%x.\r\n", cmd_data[0], cmd_data[1], cmd_data[2], cmd_data[3]);
 
     /* Check if Data is for Test Version */
     if ((cmd_data[0] != 0x52) || (((cmd_data[1] & 0xf0) >> 4) != 0xe))
@@ -298,7 +298,7 @@ int send_boot_code_version_command(void)
     unsigned char bc_ver_cmd[4] = {0x53, 0x10, 0x00, 0x01};
 
     /* Send Boot Code Version Command to touch */
-    DEBUG_PRINTF("cmd: 0x%x, 0x%x, 0x%x, 0x%x.\r\n", bc_ver_cmd[0], bc_ver_cmd[1], bc_ver_cmd[2], bc_ver_cmd[3]);
+    TRACE_PRINTF("cmd: 0x%x, 0x%x, 0x%x, 0x%x.\r\n", bc_ver_cmd[0], bc_ver_cmd[1], bc_ver_cmd[2], bc_ver_cmd[3]);
     err = write_cmd(bc_ver_cmd, sizeof(bc_ver_cmd), ELAN_WRITE_DATA_TIMEOUT_MSEC);
     if (err != TP_SUCCESS)
         ERROR_PRINTF("Fail to send Boot Code Version command! err=0x%x.\r\n", err);
@@ -319,7 +319,7 @@ int read_boot_code_version_data(void)
         ERROR_PRINTF("Fail to read Boot Code Version data, err=0x%x.\r\n", err);
         goto READ_BOOT_CODE_VERSION_DATA_EXIT;
     }
-    DEBUG_PRINTF("cmd_data: 0x%x, 0x%x, 0x%x, 0x%x.\r\n", cmd_data[0], cmd_data[1], cmd_data[2], cmd_data[3]);
+    TRACE_PRINTF("cmd_data: 0x%x, 0x%x, 0x%x, 0x%x.\r\n", cmd_data[0], cmd_data[1], cmd_data[2], cmd_data[3]);
 
     /* Check if Data is Boot Code Version */
     if ((cmd_data[0] == 0x52) && (((cmd_data[1] & 0xf0) >> 4) == 0x1))
@@ -357,7 +357,7 @@ int get_boot_code_version_data(unsigned short *p_bc_version)
         ERROR_PRINTF("Fail to read Boot Code Version data, err=0x%x.\r\n", err);
         goto GET_BOOT_CODE_VERSION_DATA_EXIT;
     }
-    DEBUG_PRINTF("cmd_data: 0x%x, 0x%x, 0x%x, 0x%x.\r\n", cmd_data[0], cmd_data[1], cmd_data[2], cmd_data[3]);
+    TRACE_PRINTF("cmd_data: 0x%x, 0x%x, 0x%x, 0x%x.\r\n", cmd_data[0], cmd_data[1], cmd_data[2], cmd_data[3]);
 
     /* Check if Data is Boot Code Version */
     if ((cmd_data[0] != 0x52) || (((cmd_data[1] & 0xf0) >> 4) != 0x1))
@@ -388,7 +388,7 @@ int send_rek_command(void)
             rek_cmd[4]				= {0x54, 0x29, 0x00, 0x01};
 
     /* Send Write Flash Key Command */
-    DEBUG_PRINTF("cmd: 0x%x, 0x%x, 0x%x, 0x%x.\r\n", write_flash_key_cmd[0], write_flash_key_cmd[1], write_flash_key_cmd[2], write_flash_key_cmd[3]);
+    TRACE_PRINTF("cmd: 0x%x, 0x%x, 0x%x, 0x%x.\r\n", write_flash_key_cmd[0], write_flash_key_cmd[1], write_flash_key_cmd[2], write_flash_key_cmd[3]);
     err = write_cmd(write_flash_key_cmd, sizeof(write_flash_key_cmd), ELAN_WRITE_DATA_TIMEOUT_MSEC);
     if (err != TP_SUCCESS)
     {
@@ -397,7 +397,7 @@ int send_rek_command(void)
     }
 
     /* Send Re-Calibration Command */
-    DEBUG_PRINTF("cmd: 0x%x, 0x%x, 0x%x, 0x%x.\r\n", rek_cmd[0], rek_cmd[1], rek_cmd[2], rek_cmd[3]);
+    TRACE_PRINTF("cmd: 0x%x, 0x%x, 0x%x, 0x%x.\r\n", rek_cmd[0], rek_cmd[1], rek_cmd[2], rek_cmd[3]);
     err = write_cmd(rek_cmd, sizeof(rek_cmd), ELAN_WRITE_DATA_TIMEOUT_MSEC);
     if (err != TP_SUCCESS)
     {
@@ -422,7 +422,7 @@ int receive_rek_response(void)
         ERROR_PRINTF("Re-Calibration failed! err=0x%x.\r\n", err);
         goto RECEIVE_REK_RESPONSE_EXIT;
     }
-    DEBUG_PRINTF("cmd_data: 0x%x, 0x%x, 0x%x, 0x%x.\r\n", cmd_data[0], cmd_data[1], cmd_data[2], cmd_data[3]);
+    TRACE_PRINTF("cmd_data: 0x%x, 0x%x, 0x%x, 0x%x.\r\n", cmd_data[0], cmd_data[1], cmd_data[2], cmd_data[3]);
 
     /* Check if Correct Response */
     if((cmd_data[0]==0x66) && (cmd_data[1]==0x66) && (cmd_data[2]==0x66) && (cmd_data[3]==0x66)) // Calibrated
@@ -443,7 +443,7 @@ int send_enter_test_mode_command(void)
     unsigned char enter_test_mode_cmd[4] = {0x55, 0x55, 0x55, 0x55};
 
     /* Send Enter Test Mode Command */
-    DEBUG_PRINTF("cmd: 0x%02x, 0x%02x, 0x%02x, 0x%02x.\r\n", enter_test_mode_cmd[0], enter_test_mode_cmd[1], \
+    TRACE_PRINTF("cmd: 0x%02x, 0x%02x, 0x%02x, 0x%02x.\r\n", enter_test_mode_cmd[0], enter_test_mode_cmd[1], \
                  enter_test_mode_cmd[2], enter_test_mode_cmd[3]);
     err = write_cmd(enter_test_mode_cmd, 4, ELAN_WRITE_DATA_TIMEOUT_MSEC);
     if (err != TP_SUCCESS)
@@ -458,7 +458,7 @@ int send_exit_test_mode_command(void)
     unsigned char exit_test_mode_cmd[4] = {(unsigned char)0xa5, (unsigned char)0xa5, (unsigned char)0xa5, (unsigned char)0xa5};
 
     /* Send Exit Test Mode Command */
-    DEBUG_PRINTF("cmd: 0x%02x, 0x%02x, 0x%02x, 0x%02x.\r\n", exit_test_mode_cmd[0], exit_test_mode_cmd[1], \
+    TRACE_PRINTF("cmd: 0x%02x, 0x%02x, 0x%02x, 0x%02x.\r\n", exit_test_mode_cmd[0], exit_test_mode_cmd[1], \
                  exit_test_mode_cmd[2], exit_test_mode_cmd[3]);
     err = write_cmd(exit_test_mode_cmd, 4, ELAN_WRITE_DATA_TIMEOUT_MSEC);
     if (err != TP_SUCCESS)
@@ -523,7 +523,7 @@ int send_read_rom_data_command(unsigned short addr, bool recovery, unsigned char
     }
 
     /* Send Show Bulk ROM Data Command */
-    DEBUG_PRINTF("cmd: 0x%02x, 0x%02x, 0x%02x, 0x%02x, 0x%02x, 0x%02x.\r\n", \
+    TRACE_PRINTF("cmd: 0x%02x, 0x%02x, 0x%02x, 0x%02x, 0x%02x, 0x%02x.\r\n", \
                  read_rom_data_cmd[0], read_rom_data_cmd[1], read_rom_data_cmd[2], \
                  read_rom_data_cmd[3], read_rom_data_cmd[4], read_rom_data_cmd[5]);
     err = write_cmd(read_rom_data_cmd, 6, ELAN_WRITE_DATA_TIMEOUT_MSEC);
@@ -545,7 +545,7 @@ int receive_rom_data(unsigned short *p_rom_data)
         ERROR_PRINTF("Fail to receive ROM data! err=0x%x.\r\n", err);
         goto RECEIVE_ROM_DATA_EXIT;
     }
-    DEBUG_PRINTF("cmd_data: 0x%x, 0x%x, 0x%x, 0x%x, 0x%x, 0x%x.\r\n", cmd_data[0], cmd_data[1], cmd_data[2], cmd_data[3], cmd_data[4], cmd_data[5]);
+    TRACE_PRINTF("cmd_data: 0x%x, 0x%x, 0x%x, 0x%x, 0x%x, 0x%x.\r\n", cmd_data[0], cmd_data[1], cmd_data[2], cmd_data[3], cmd_data[4], cmd_data[5]);
 
     /* Check if data invalid */
     if (cmd_data[0] != 0x95)
@@ -557,7 +557,7 @@ int receive_rom_data(unsigned short *p_rom_data)
 
     // Load ROM Data to Input Buffer
     rom_data = (unsigned short)((cmd_data[3] << 8) | cmd_data[4]);
-    DEBUG_PRINTF("ROM Data: 0x%04x.\r\n", rom_data);
+    TRACE_PRINTF("ROM Data: 0x%04x.\r\n", rom_data);
 
     *p_rom_data = rom_data;
     err = TP_SUCCESS;
@@ -579,7 +579,7 @@ int send_show_bulk_rom_data_command(unsigned short addr, unsigned short len)
     show_bulk_rom_data_cmd[5] =  len  & 0x00FF;			//LEN_L
 
     /* Send Show Bulk ROM Data Command */
-    DEBUG_PRINTF("cmd: 0x%02x, 0x%02x, 0x%02x, 0x%02x, 0x%02x, 0x%02x.\r\n", \
+    TRACE_PRINTF("cmd: 0x%02x, 0x%02x, 0x%02x, 0x%02x, 0x%02x, 0x%02x.\r\n", \
                  show_bulk_rom_data_cmd[0], show_bulk_rom_data_cmd[1], show_bulk_rom_data_cmd[2], \
                  show_bulk_rom_data_cmd[3], show_bulk_rom_data_cmd[4], show_bulk_rom_data_cmd[5]);
     err = write_cmd(show_bulk_rom_data_cmd, 6, ELAN_WRITE_DATA_TIMEOUT_MSEC);
@@ -600,7 +600,7 @@ int send_show_bulk_rom_data_command(unsigned short addr)
     show_bulk_rom_data_cmd[3] =  addr & 0x00FF; 		//ADDR_L
 
     /* Send Show Bulk ROM Data Command */
-    DEBUG_PRINTF("cmd: 0x%02x, 0x%02x, 0x%02x, 0x%02x, 0x%02x, 0x%02x.\r\n", \
+    TRACE_PRINTF("cmd: 0x%02x, 0x%02x, 0x%02x, 0x%02x, 0x%02x, 0x%02x.\r\n", \
                  show_bulk_rom_data_cmd[0], show_bulk_rom_data_cmd[1], show_bulk_rom_data_cmd[2], \
                  show_bulk_rom_data_cmd[3], show_bulk_rom_data_cmd[4], show_bulk_rom_data_cmd[5]);
     err = write_cmd(show_bulk_rom_data_cmd, 6, ELAN_WRITE_DATA_TIMEOUT_MSEC);
@@ -622,7 +622,7 @@ int receive_bulk_rom_data(unsigned short *p_rom_data)
         ERROR_PRINTF("Fail to receive Bulk ROM data! err=0x%x.\r\n", err);
         goto RECEIVE_BULK_ROM_DATA_EXIT;
     }
-    DEBUG_PRINTF("cmd_data: 0x%x, 0x%x, 0x%x, 0x%x, 0x%x.\r\n", cmd_data[0], cmd_data[1], cmd_data[2], cmd_data[3], cmd_data[4]);
+    TRACE_PRINTF("cmd_data: 0x%x, 0x%x, 0x%x, 0x%x, 0x%x.\r\n", cmd_data[0], cmd_data[1], cmd_data[2], cmd_data[3], cmd_data[4]);
 
     /* Check if data invalid */
     if (cmd_data[0] != 0x99)
@@ -634,7 +634,7 @@ int receive_bulk_rom_data(unsigned short *p_rom_data)
 
     // Load ROM Data to Input Buffer
     rom_data = (unsigned short)((cmd_data[3] << 8) | cmd_data[4]);
-    DEBUG_PRINTF("Bulk ROM Data: 0x%04x.\r\n", rom_data);
+    TRACE_PRINTF("Bulk ROM Data: 0x%04x.\r\n", rom_data);
 
     *p_rom_data = rom_data;
     err = TP_SUCCESS;
@@ -650,7 +650,7 @@ int send_write_flash_key_command(void)
     unsigned char write_flash_key_cmd[4] = {0x54, 0xc0, 0xe1, 0x5a};
 
     /* Send Write Flash Key Command */
-    DEBUG_PRINTF("cmd: 0x%x, 0x%x, 0x%x, 0x%x.\r\n", write_flash_key_cmd[0], write_flash_key_cmd[1], write_flash_key_cmd[2], write_flash_key_cmd[3]);
+    TRACE_PRINTF("cmd: 0x%x, 0x%x, 0x%x, 0x%x.\r\n", write_flash_key_cmd[0], write_flash_key_cmd[1], write_flash_key_cmd[2], write_flash_key_cmd[3]);
     err = write_cmd(write_flash_key_cmd, sizeof(write_flash_key_cmd), ELAN_WRITE_DATA_TIMEOUT_MSEC);
     if (err != TP_SUCCESS)
     {
@@ -666,7 +666,7 @@ int send_enter_iap_command(void)
     unsigned char enter_iap_cmd[4] = {0x54, 0x00, 0x12, 0x34};
 
     /* Send Enter IAP Command */
-    DEBUG_PRINTF("cmd: 0x%x, 0x%x, 0x%x, 0x%x.\r\n", enter_iap_cmd[0], enter_iap_cmd[1], enter_iap_cmd[2], enter_iap_cmd[3]);
+    TRACE_PRINTF("cmd: 0x%x, 0x%x, 0x%x, 0x%x.\r\n", enter_iap_cmd[0], enter_iap_cmd[1], enter_iap_cmd[2], enter_iap_cmd[3]);
     err = write_cmd(enter_iap_cmd, sizeof(enter_iap_cmd), ELAN_WRITE_DATA_TIMEOUT_MSEC);
     if (err != TP_SUCCESS)
     {
@@ -682,7 +682,7 @@ int send_slave_address(void)
     unsigned char slave_addr =(unsigned char)(ELAN_I2C_SLAVE_ADDR >> 1); // 7-Bit I2C Slave Address
 
     /* Send Show Bulk ROM Data Command */
-    DEBUG_PRINTF("cmd: 0x%02x.\r\n", slave_addr);
+    TRACE_PRINTF("cmd: 0x%02x.\r\n", slave_addr);
     err = write_cmd(&slave_addr, 1, ELAN_WRITE_DATA_TIMEOUT_MSEC);
     if (err != TP_SUCCESS)
         ERROR_PRINTF("Fail to send Elan TS I2C Slave Address! err=0x%x.\r\n", err);
@@ -744,7 +744,7 @@ int send_flash_write_command(void)
     unsigned char write_to_flash_cmd = 0x22; // Vendor Command
 
     /* Send Write to Flash Command (Vendor Command) */
-    DEBUG_PRINTF("vendor_cmd: 0x%02x.\r\n", write_to_flash_cmd);
+    TRACE_PRINTF("vendor_cmd: 0x%02x.\r\n", write_to_flash_cmd);
     err = write_vendor_cmd(&write_to_flash_cmd, 1, ELAN_WRITE_DATA_TIMEOUT_MSEC);
     if(err != TP_SUCCESS)
         ERROR_PRINTF("Failed to write vendor command 0x%x, err=0x%x.\r\n", write_to_flash_cmd, err);
@@ -764,7 +764,7 @@ int receive_flash_write_response(void)
         ERROR_PRINTF("Fail to receive Flash Write Response data! err=0x%x.\r\n", err);
         goto READ_FLASH_WRITE_RESPONSE_EXIT;
     }
-    DEBUG_PRINTF("flash_write_response: 0x%02x, 0x%02x.\r\n", flash_write_response_data[0], flash_write_response_data[1]);
+    TRACE_PRINTF("flash_write_response: 0x%02x, 0x%02x.\r\n", flash_write_response_data[0], flash_write_response_data[1]);
 
     /* Check if Correct Response */
     if((flash_write_response_data[0] != 0xAA) || (flash_write_response_data[1] != 0xAA))
@@ -789,7 +789,7 @@ int send_request_hello_packet_command(void)
     unsigned char request_iap_recovery_hello_packet_cmd = 0x18; // Vendor Command
 
     /* Send Request IAP Hello Packet Command (Vendor Command) */
-    DEBUG_PRINTF("vendor_cmd: 0x%02x.\r\n", request_iap_recovery_hello_packet_cmd);
+    TRACE_PRINTF("vendor_cmd: 0x%02x.\r\n", request_iap_recovery_hello_packet_cmd);
     err = write_vendor_cmd(&request_iap_recovery_hello_packet_cmd, 1, ELAN_WRITE_DATA_TIMEOUT_MSEC);
     if(err != TP_SUCCESS)
         ERROR_PRINTF("Failed to write vendor command 0x%x, err=0x%x.\r\n", request_iap_recovery_hello_packet_cmd, err);
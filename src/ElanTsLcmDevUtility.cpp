@@ -15,27 +15,241 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdint.h>
+#include <stddef.h>         /* offsetof */
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>     	/* write, close, fsync */
+#include <sys/stat.h>       /* stat */
+#include <sys/mman.h>       /* mmap, munmap */
 #include "ErrCode.h"
 #include "ElanTsLcmDevUtility.h"
+#include "ElanTsTimeUtility.h"
+#include "ElanTsDefaultFwidMappingUtility.h"
 
 /***************************************************
  * Global Variable Declaration
  ***************************************************/
 
+/***************************************************
+ * Function Prototype
+ ***************************************************/
+
+static size_t get_lcm_panel_hash_slot(unsigned int panel_key, size_t hash_slot_count);
+static int resize_lcm_dev_hash(struct lcm_dev_table *p_dev_table, size_t hash_slot_count);
+static int parse_lcm_panel_key(const char *panel_info, unsigned int *p_panel_key);
+static uint32_t get_fwid_mapping_image_checksum(const void *p_image_data, size_t data_size);
+static int compare_fwid_mapping_image_entry(const void *p_entry1, const void *p_entry2);
+static const struct fwid_mapping_image_entry *find_fwid_mapping_image_entry(struct lcm_dev_table *p_dev_table, unsigned int panel_key);
+
 /***************************************************
  * Function Implements
  ***************************************************/
 
-int parse_fwid_mapping_file(FILE *fd_mapping_file, struct lcm_dev_info *p_dev_info, size_t dev_info_size)
+// Integer Mixing of Panel Key, then Mask to Slot (hash_slot_count: Power of 2)
+static size_t get_lcm_panel_hash_slot(unsigned int panel_key, size_t hash_slot_count)
+{
+    uint32_t hash = (uint32_t)panel_key;
+
+    hash ^= hash >> 16;
+    hash *= 0x7FEB352D;
+    hash ^= hash >> 15;
+    hash *= 0x846CA68B;
+    hash ^= hash >> 16;
+
+    return (size_t)hash & (hash_slot_count - 1);
+}
+
+static int resize_lcm_dev_hash(struct lcm_dev_table *p_dev_table, size_t hash_slot_count)
+{
+    int err = TP_SUCCESS;
+    unsigned int *p_hash_slot = NULL;
+    size_t index = 0,
+           slot = 0;
+
+    p_hash_slot = (unsigned int *)calloc(hash_slot_count, sizeof(unsigned int));
+    if(p_hash_slot == NULL)
+    {
+        ERROR_PRINTF("%s: Fail to allocate %zu hash slots!\r\n", __func__, hash_slot_count);
+        err = TP_ERR_NO_INTERFACE_CREATE;
+        goto RESIZE_LCM_DEV_HASH_EXIT;
+    }
+
+    // Rehash All Entries (Keys are Unique)
+    for(index = 0; index < p_dev_table->dev_info_count; index++)
+    {
+        slot = get_lcm_panel_hash_slot(p_dev_table->p_dev_info[index].panel_key, hash_slot_count);
+        while(p_hash_slot[slot] != 0)
+            slot = (slot + 1) & (hash_slot_count - 1);
+        p_hash_slot[slot] = (unsigned int)(index + 1);
+    }
+
+    free(p_dev_table->p_hash_slot);
+    p_dev_table->p_hash_slot = p_hash_slot;
+    p_dev_table->hash_slot_count = hash_slot_count;
+
+RESIZE_LCM_DEV_HASH_EXIT:
+    return err;
+}
+
+// Parse "mmmm.pppp" (Hex) into Panel Key
+static int parse_lcm_panel_key(const char *panel_info, unsigned int *p_panel_key)
+{
+    int err = TP_SUCCESS;
+    char *p_end = NULL;
+    unsigned long manufacturer_code = 0,
+                  product_code = 0;
+
+    manufacturer_code = strtoul(panel_info, &p_end, 16);
+    if((p_end == panel_info) || (*p_end != '.') || (manufacturer_code > 0xFFFF))
+    {
+        err = TP_ERR_DATA_PATTERN;
+        goto PARSE_LCM_PANEL_KEY_EXIT;
+    }
+
+    panel_info = p_end + 1;
+    product_code = strtoul(panel_info, &p_end, 16);
+    if((p_end == panel_info) || ((*p_end != '\0') && (*p_end != '\r') && (*p_end != '\n')) || (product_code > 0xFFFF))
+    {
+        err = TP_ERR_DATA_PATTERN;
+        goto PARSE_LCM_PANEL_KEY_EXIT;
+    }
+
+    *p_panel_key = LCM_PANEL_KEY(manufacturer_code, product_code);
+
+PARSE_LCM_PANEL_KEY_EXIT:
+    return err;
+}
+
+int init_lcm_dev_table(struct lcm_dev_table *p_dev_table)
+{
+    int err = TP_SUCCESS;
+
+    if (p_dev_table == NULL)
+    {
+        ERROR_PRINTF("%s: NULL LCM device table!\r\n", __func__);
+        err = TP_ERR_INVALID_PARAM;
+        goto INIT_LCM_DEV_TABLE_EXIT;
+    }
+
+    memset(p_dev_table, 0, sizeof(struct lcm_dev_table));
+
+INIT_LCM_DEV_TABLE_EXIT:
+    return err;
+}
+
+void free_lcm_dev_table(struct lcm_dev_table *p_dev_table)
+{
+    if (p_dev_table == NULL)
+        return;
+
+    free(p_dev_table->p_dev_info);
+    free(p_dev_table->p_hash_slot);
+    if (p_dev_table->p_image_map != NULL)
+        munmap(p_dev_table->p_image_map, p_dev_table->image_map_size);
+    memset(p_dev_table, 0, sizeof(struct lcm_dev_table));
+
+    return;
+}
+
+int add_lcm_dev_info(struct lcm_dev_table *p_dev_table, unsigned int panel_key, unsigned short chrome_fwid, unsigned short windows_fwid)
+{
+    int err = TP_SUCCESS;
+    struct lcm_dev_info *p_dev_info = NULL;
+    size_t capacity = 0,
+           slot = 0;
+
+    if (p_dev_table == NULL)
+    {
+        ERROR_PRINTF("%s: NULL LCM device table!\r\n", __func__);
+        err = TP_ERR_INVALID_PARAM;
+        goto ADD_LCM_DEV_INFO_EXIT;
+    }
+
+    // Keep First Row of Duplicated Panel (Same as Former Linear Search)
+    if (find_lcm_dev_info(p_dev_table, panel_key) != NULL)
+    {
+        DEBUG_PRINTF("%s: Duplicated panel %04x.%04x ignored.\r\n", __func__, (panel_key >> 16), (panel_key & 0xFFFF));
+        goto ADD_LCM_DEV_INFO_EXIT;
+    }
+
+    // Grow Entry Array
+    if (p_dev_table->dev_info_count == p_dev_table->dev_info_capacity)
+    {
+        capacity = (p_dev_table->dev_info_capacity == 0) ? LCM_DEV_TABLE_INIT_CAPACITY : (p_dev_table->dev_info_capacity * 2);
+        p_dev_info = (struct lcm_dev_info *)realloc(p_dev_table->p_dev_info, capacity * sizeof(struct lcm_dev_info));
+        if (p_dev_info == NULL)
+        {
+            ERROR_PRINTF("%s: Fail to grow LCM device table to %zu entries!\r\n", __func__, capacity);
+            err = TP_ERR_NO_INTERFACE_CREATE;
+            goto ADD_LCM_DEV_INFO_EXIT;
+        }
+        p_dev_table->p_dev_info = p_dev_info;
+        p_dev_table->dev_info_capacity = capacity;
+    }
+
+    // Keep Hash Load Factor <= 1/2
+    if (((p_dev_table->dev_info_count + 1) * 2) > p_dev_table->hash_slot_count)
+    {
+        err = resize_lcm_dev_hash(p_dev_table, (p_dev_table->hash_slot_count == 0) ? (LCM_DEV_TABLE_INIT_CAPACITY * 2) : (p_dev_table->hash_slot_count * 2));
+        if (err != TP_SUCCESS)
+            goto ADD_LCM_DEV_INFO_EXIT;
+    }
+
+    // Append Entry
+    p_dev_info = &p_dev_table->p_dev_info[p_dev_table->dev_info_count];
+    memset(p_dev_info, 0, sizeof(struct lcm_dev_info));
+    p_dev_info->panel_key = panel_key;
+    snprintf(p_dev_info->panel_info, sizeof(p_dev_info->panel_info), "%04x.%04x", (panel_key >> 16), (panel_key & 0xFFFF));
+    p_dev_info->chrome_fwid = chrome_fwid;
+    p_dev_info->windows_fwid = windows_fwid;
+
+    // Index Entry
+    slot = get_lcm_panel_hash_slot(panel_key, p_dev_table->hash_slot_count);
+    while (p_dev_table->p_hash_slot[slot] != 0)
+        slot = (slot + 1) & (p_dev_table->hash_slot_count - 1);
+    p_dev_table->p_hash_slot[slot] = (unsigned int)(p_dev_table->dev_info_count + 1);
+    p_dev_table->dev_info_count++;
+
+ADD_LCM_DEV_INFO_EXIT:
+    return err;
+}
+
+struct lcm_dev_info *find_lcm_dev_info(struct lcm_dev_table *p_dev_table, unsigned int panel_key)
+{
+    struct lcm_dev_info *p_dev_info = NULL;
+    size_t slot = 0;
+
+    if ((p_dev_table == NULL) || (p_dev_table->hash_slot_count == 0))
+        goto FIND_LCM_DEV_INFO_EXIT;
+
+    slot = get_lcm_panel_hash_slot(panel_key, p_dev_table->hash_slot_count);
+    while (p_dev_table->p_hash_slot[slot] != 0)
+    {
+        if (p_dev_table->p_dev_info[p_dev_table->p_hash_slot[slot] - 1].panel_key == panel_key)
+        {
+            p_dev_info = &p_dev_table->p_dev_info[p_dev_table->p_hash_slot[slot] - 1];
+            break;
+        }
+        slot = (slot + 1) & (p_dev_table->hash_slot_count - 1);
+    }
+
+FIND_LCM_DEV_INFO_EXIT:
+    return p_dev_info;
+}
+
+int parse_fwid_mapping_file(FILE *fd_mapping_file, struct lcm_dev_table *p_dev_table)
 {
     int err = 0,
         line_index = 0,
-        token_index = 0,
-        dev_info_index = 0;
+        token_index = 0;
+    bool panel_key_valid = false;
+    unsigned int panel_key = 0;
+    unsigned short chrome_fwid = 0,
+                   windows_fwid = 0;
     char line[1024] = {0},
          *token = NULL,
-         chrome_fwid[FWID_LENGTH_MAX] = {0},
-         windows_fwid[FWID_LENGTH_MAX] = {0};
+         *p_next_token = NULL;
 
     if (fd_mapping_file == NULL)
     {
@@ -44,9 +258,9 @@ int parse_fwid_mapping_file(FILE *fd_mapping_file, struct lcm_dev_info *p_dev_in
         goto PARSE_FWID_MAPPING_FILE_EXIT;
     }
 
-    if ((p_dev_info == NULL) || (dev_info_size == 0))
+    if (p_dev_table == NULL)
     {
-        ERROR_PRINTF("%s: Invalid Parameter! (p_dev_info=0x%p, dev_info_size=%zd)\r\n", __func__, p_dev_info, dev_info_size);
+        ERROR_PRINTF("%s: Invalid Parameter! (p_dev_table=0x%p)\r\n", __func__, p_dev_table);
         err = TP_ERR_INVALID_PARAM;
         goto PARSE_FWID_MAPPING_FILE_EXIT;
     }
@@ -55,30 +269,32 @@ int parse_fwid_mapping_file(FILE *fd_mapping_file, struct lcm_dev_info *p_dev_in
     while (fgets(line, sizeof(line), fd_mapping_file) != NULL)
     {
         token_index = 0;
-        token = strtok(line, ",");
+        panel_key_valid = false;
+        chrome_fwid = 0;
+        windows_fwid = 0;
+
+        // Split by ',' (Empty Fields Kept, so Column Index Stays Aligned)
+        token = line;
         while (token != NULL)
         {
-            if ((strcmp(token, "\n") != 0) && (strcmp(token, "") != 0))
+            p_next_token = strchr(token, ',');
+            if (p_next_token != NULL)
+                *p_next_token++ = '\0';
+
+            if ((strcmp(token, "\n") != 0) && (strcmp(token, "\r\n") != 0) && (strcmp(token, "") != 0))
             {
                 switch (token_index)
                 {
-                    case 0: // panel_info[PANEL_INFO_LENGTH_MAX]
-                        if((strcmp(token, "") != 0) && (strlen(token) < sizeof(p_dev_info[dev_info_index].panel_info)))
-                            strncpy(p_dev_info[dev_info_index].panel_info, token, strlen(token));
+                    case 0: // panel_info ("manufacturer.product")
+                        panel_key_valid = (parse_lcm_panel_key(token, &panel_key) == TP_SUCCESS);
                         break;
-                    case 1: // chrome_fwid[FWID_LENGTH_MAX]
-                        if((strcmp(token, "") != 0) && (strlen(token) < sizeof(chrome_fwid)))
-                        {
-                            strncpy(chrome_fwid, token, strlen(token));
-                            p_dev_info[dev_info_index].chrome_fwid = strtol(chrome_fwid, NULL, 16);
-                        }
+                    case 1: // chrome_fwid
+                        if(strlen(token) < FWID_LENGTH_MAX)
+                            chrome_fwid = strtol(token, NULL, 16);
                         break;
-                    case 2: // windows_fwid[FWID_LENGTH_MAX]
-                        if((strcmp(token, "") != 0) && (strlen(token) < sizeof(windows_fwid)))
-                        {
-                            strncpy(windows_fwid, token, strlen(token));
-                            p_dev_info[dev_info_index].windows_fwid = strtol(windows_fwid, NULL, 16);
-                        }
+                    case 2: // windows_fwid
+                        if(strlen(token) < FWID_LENGTH_MAX)
+                            windows_fwid = strtol(token, NULL, 16);
                         break;
                     default: // Unknown
                         DEBUG_PRINTF("%s: [%d] Known token \"%s\"\r\n", __func__, token_index, token);
@@ -86,115 +302,139 @@ int parse_fwid_mapping_file(FILE *fd_mapping_file, struct lcm_dev_info *p_dev_in
                 }
             }
 
-            token = strtok(NULL, ",");
+            token = p_next_token;
             token_index++;
         }
 
-        /* Debug */
-        if(strcmp(p_dev_info[dev_info_index].panel_info, "") != 0)
+        // Skip Header & Malformed Lines
+        if (panel_key_valid == false)
+        {
+            DEBUG_PRINTF("%s: Line %d skipped.\r\n", __func__, line_index);
+            line_index++;
+            continue;
+        }
+
+        err = add_lcm_dev_info(p_dev_table, panel_key, chrome_fwid, windows_fwid);
+        if (err != TP_SUCCESS)
         {
-            DEBUG_PRINTF("%s: Device %d - panel_info: \"%s\", chrome_fwid: 0x%04x, windows_fwid: 0x%04x.\r\n", __func__, dev_info_index, \
-                         p_dev_info[dev_info_index].panel_info, p_dev_info[dev_info_index].chrome_fwid, p_dev_info[dev_info_index].windows_fwid);
+            ERROR_PRINTF("%s: Fail to add line %d! err=0x%x.\r\n", __func__, line_index, err);
+            goto PARSE_FWID_MAPPING_FILE_EXIT;
         }
 
-        memset(line, 0, sizeof(line));
         line_index++;
-        dev_info_index++;
     }
+    DEBUG_PRINTF("%s: %zu LCM devices parsed from %d lines.\r\n", __func__, p_dev_table->dev_info_count, line_index);
 
 PARSE_FWID_MAPPING_FILE_EXIT:
     return err;
 }
 
-int show_lcm_dev_info(struct lcm_dev_info *p_dev_info, size_t dev_info_size)
+int show_lcm_dev_info(struct lcm_dev_table *p_dev_table)
 {
-    int err = TP_SUCCESS,
-        index = 0;
+    int err = TP_SUCCESS;
+    size_t index = 0;
 
     // Check if Parameter Invalid
-    if ((p_dev_info == NULL) || (dev_info_size == 0))
+    if (p_dev_table == NULL)
     {
-        ERROR_PRINTF("%s: Invalid Parameter! (p_dev_info=0x%p, dev_info_size=%zd)\r\n", __func__, p_dev_info, dev_info_size);
+        ERROR_PRINTF("%s: Invalid Parameter! (p_dev_table=0x%p)\r\n", __func__, p_dev_table);
         err = TP_ERR_INVALID_PARAM;
         goto SHOW_LCM_DEV_INFO_EXIT;
     }
 
     printf("--------------------------------------\r\n");
-    printf("LCM Devices:\r\n");
+    printf("LCM Devices: (%zu built-in)\r\n", get_default_fwid_mapping_entry_count());
 
-    for(index = 0; index < DEV_INFO_SET_MAX; index++)
+    for(index = 0; index < p_dev_table->dev_info_count; index++)
     {
-        // Check for Device Data Valid
-        if(strcmp(p_dev_info[index].panel_info, "") == 0)
-            continue;
+        printf("Device %zu: panel_info \"%s\", chrome_fwid %04x, windows_fwid %04x.\r\n", index, p_dev_table->p_dev_info[index].panel_info, \
+               p_dev_table->p_dev_info[index].chrome_fwid, p_dev_table->p_dev_info[index].windows_fwid);
+    }
 
-        printf("Device %d: panel_info \"%s\", chrome_fwid %04x, windows_fwid %04x.\r\n", index, p_dev_info[index].panel_info, p_dev_info[index].chrome_fwid, p_dev_info[index].windows_fwid);
+    for(index = 0; index < p_dev_table->image_entry_count; index++)
+    {
+        printf("Device %zu: panel_info \"%04x.%04x\", chrome_fwid %04x, windows_fwid %04x.\r\n", index, \
+               (p_dev_table->p_image_entry[index].panel_key >> 16), (p_dev_table->p_image_entry[index].panel_key & 0xFFFF), \
+               p_dev_table->p_image_entry[index].chrome_fwid, p_dev_table->p_image_entry[index].windows_fwid);
     }
 
 SHOW_LCM_DEV_INFO_EXIT:
     return err;
 }
 
-int get_fwid_from_edid(struct lcm_dev_info *p_dev_info, size_t dev_info_size, unsigned short manufacturer_code, unsigned short product_code, system_type system, unsigned short *p_fwid)
+int get_fwid_from_edid(struct lcm_dev_table *p_dev_table, unsigned short manufacturer_code, unsigned short product_code, system_type system, unsigned short *p_fwid)
 {
-    int err = TP_ERR_DATA_NOT_FOUND,
-        index = 0;
-    char target_panel_info[PANEL_INFO_LENGTH_MAX] = {0};
+    int err = TP_ERR_DATA_NOT_FOUND;
+    struct lcm_dev_info *p_dev_info = NULL,
+                        image_dev_info;
+    const struct fwid_mapping_image_entry *p_image_entry = NULL;
 
     // Check if Parameter Invalid
-    if ((p_dev_info == NULL) || (dev_info_size == 0) || (manufacturer_code == 0) || (product_code == 0) || (system == UNKNOWN) || (p_fwid == NULL))
+    if ((p_dev_table == NULL) || (manufacturer_code == 0) || (product_code == 0) || (system == UNKNOWN) || (p_fwid == NULL))
     {
-        ERROR_PRINTF("%s: Invalid Parameter! (p_dev_info=0x%p, dev_info_size=%zd, manufacturer_code=0x%x, product_code=0x%x, system=%d, p_fwid=0x%p)\r\n", \
-                     __func__, p_dev_info, dev_info_size, manufacturer_code, product_code, system, p_fwid);
+        ERROR_PRINTF("%s: Invalid Parameter! (p_dev_table=0x%p, manufacturer_code=0x%x, product_code=0x%x, system=%d, p_fwid=0x%p)\r\n", \
+                     __func__, p_dev_table, manufacturer_code, product_code, system, p_fwid);
         err = TP_ERR_INVALID_PARAM;
         goto GET_FWID_FROM_EDID_EXIT;
     }
 
-    // Set Target Panel Info.
-    sprintf(target_panel_info, "%04x.%04x", manufacturer_code, product_code);
-    DEBUG_PRINTF("%s: target_panel_info: \"%s\".\r\n", __func__, target_panel_info);
+    // Look for Device Info. with Matched Panel Key (Mapping File Overrides Built-in Table)
+    if(p_dev_table->p_image_entry != NULL) // Binary Image
+        p_image_entry = find_fwid_mapping_image_entry(p_dev_table, LCM_PANEL_KEY(manufacturer_code, product_code));
+    else // Text File
+        p_dev_info = find_lcm_dev_info(p_dev_table, LCM_PANEL_KEY(manufacturer_code, product_code));
 
-    // Look for Device Info. with Matched Panel Info.
-    for(index = 0; index < DEV_INFO_SET_MAX; index++)
+    if((p_dev_info == NULL) && (p_image_entry == NULL)) // Built-in Table
     {
-        // Check for Device Data Valid
-        if(strcmp(p_dev_info[index].panel_info, "") == 0)
-            continue;
+        p_image_entry = find_default_fwid_mapping_entry(LCM_PANEL_KEY(manufacturer_code, product_code));
+        if(p_image_entry != NULL)
+            DEBUG_PRINTF("%s: Panel %04x.%04x found in built-in table.\r\n", __func__, manufacturer_code, product_code);
+    }
 
-        DEBUG_PRINTF("%s: [%d] panel_info: \"%s\", chrome_fwid: %04x, windows_fwid: %04x.\r\n", \
-                     __func__, index, p_dev_info[index].panel_info, p_dev_info[index].chrome_fwid, p_dev_info[index].windows_fwid);
-        if(strcmp(p_dev_info[index].panel_info, target_panel_info) == 0)
+    if(p_image_entry != NULL)
+    {
+        memset(&image_dev_info, 0, sizeof(image_dev_info));
+        image_dev_info.panel_key = p_image_entry->panel_key;
+        snprintf(image_dev_info.panel_info, sizeof(image_dev_info.panel_info), "%04x.%04x", manufacturer_code, product_code);
+        image_dev_info.chrome_fwid = p_image_entry->chrome_fwid;
+        image_dev_info.windows_fwid = p_image_entry->windows_fwid;
+        p_dev_info = &image_dev_info;
+    }
+    if(p_dev_info == NULL)
+    {
+        DEBUG_PRINTF("%s: Panel %04x.%04x not found.\r\n", __func__, manufacturer_code, product_code);
+        err = TP_ERR_DATA_NOT_FOUND;
+        goto GET_FWID_FROM_EDID_EXIT;
+    }
+    DEBUG_PRINTF("%s: panel_info: \"%s\", chrome_fwid: %04x, windows_fwid: %04x.\r\n", \
+                 __func__, p_dev_info->panel_info, p_dev_info->chrome_fwid, p_dev_info->windows_fwid);
+
+    if(system == CHROME)
+    {
+        DEBUG_PRINTF("%s: [Chrome] FWID: %04x.\r\n", __func__, p_dev_info->chrome_fwid);
+        if(p_dev_info->chrome_fwid == 0x0) // NULL FWID
         {
-            if(system == CHROME)
-            {
-                DEBUG_PRINTF("%s: [Chrome] FWID: %04x.\r\n", __func__, p_dev_info[index].chrome_fwid);
-                if(p_dev_info[index].chrome_fwid == 0x0) // NULL FWID
-                {
-                    DEBUG_PRINTF("%s: NULL FWID.\r\n", __func__);
-                    err = TP_ERR_DATA_NOT_FOUND; // Not Found
-                }
-                else // Valid FWID
-                {
-                    *p_fwid = p_dev_info[index].chrome_fwid;
-                    err = TP_SUCCESS; // Found
-                }
-                break;
-            }
-            else if (system == WINDOWS)
-            {
-                DEBUG_PRINTF("%s: [Windows] FWID: %04x.\r\n", __func__, p_dev_info[index].windows_fwid);
-                if(p_dev_info[index].windows_fwid == 0x0) // NULL FWID
-                {
-                    DEBUG_PRINTF("%s: NULL FWID.\r\n", __func__);
-                    err = TP_ERR_DATA_NOT_FOUND; // Not Found
-                }
-                else // Valid FWID
-                {
-                    *p_fwid = p_dev_info[index].windows_fwid;
-                    err = TP_SUCCESS; // Found
-                }
-                break;
-            }
+            DEBUG_PRINTF("%s: NULL FWID.\r\n", __func__);
+            err = TP_ERR_DATA_NOT_FOUND; // Not Found
+        }
+        else // Valid FWID
+        {
+            *p_fwid = p_dev_info->chrome_fwid;
+            err = TP_SUCCESS; // Found
+        }
+    }
+    else if (system == WINDOWS)
+    {
+        DEBUG_PRINTF("%s: [Windows] FWID: %04x.\r\n", __func__, p_dev_info->windows_fwid);
+        if(p_dev_info->windows_fwid == 0x0) // NULL FWID
+        {
+            DEBUG_PRINTF("%s: NULL FWID.\r\n", __func__);
+            err = TP_ERR_DATA_NOT_FOUND; // Not Found
+        }
+        else // Valid FWID
+        {
+            *p_fwid = p_dev_info->windows_fwid;
+            err = TP_SUCCESS; // Found
         }
     }
 
@@ -202,3 +442,382 @@ GET_FWID_FROM_EDID_EXIT:
     return err;
 }
 
+int load_fwid_mapping_file(const char *p_mapping_file_path, struct lcm_dev_table *p_dev_table)
+{
+    int err = TP_SUCCESS;
+    char image_file_path[FILE_NAME_LENGTH_MAX + sizeof(FWID_MAPPING_IMAGE_SUFFIX)] = {0};
+    struct stat text_file_stat,
+               image_file_stat;
+    FILE *p_fd_mapping_file = NULL;
+
+    if ((p_mapping_file_path == NULL) || (p_dev_table == NULL))
+    {
+        ERROR_PRINTF("%s: Invalid Parameter! (p_mapping_file_path=0x%p, p_dev_table=0x%p)\r\n", __func__, p_mapping_file_path, p_dev_table);
+        err = TP_ERR_INVALID_PARAM;
+        goto LOAD_FWID_MAPPING_FILE_EXIT;
+    }
+
+    if (stat(p_mapping_file_path, &text_file_stat) != 0)
+    {
+        ERROR_PRINTF("%s: Fail to open FWID mapping table file \"%s\"!\r\n", __func__, p_mapping_file_path);
+        err = TP_ERR_FILE_NOT_FOUND;
+        goto LOAD_FWID_MAPPING_FILE_EXIT;
+    }
+
+    // Use Binary Image if Not Older than Text File
+    snprintf(image_file_path, sizeof(image_file_path), "%s%s", p_mapping_file_path, FWID_MAPPING_IMAGE_SUFFIX);
+    if (stat(image_file_path, &image_file_stat) == 0)
+    {
+        if ((image_file_stat.st_mtim.tv_sec > text_file_stat.st_mtim.tv_sec) ||
+            ((image_file_stat.st_mtim.tv_sec == text_file_stat.st_mtim.tv_sec) && (image_file_stat.st_mtim.tv_nsec >= text_file_stat.st_mtim.tv_nsec)))
+        {
+            err = map_fwid_mapping_image(image_file_path, p_dev_table, false);
+            if (err == TP_SUCCESS)
+                goto LOAD_FWID_MAPPING_FILE_EXIT;
+            DEBUG_PRINTF("%s: Invalid image \"%s\" (err=0x%x), fall back to text file.\r\n", __func__, image_file_path, err);
+        }
+        else
+        {
+            DEBUG_PRINTF("%s: Image \"%s\" is older than text file, fall back to text file.\r\n", __func__, image_file_path);
+        }
+    }
+
+    // Open FWID Mapping File
+    p_fd_mapping_file = fopen(p_mapping_file_path, "r");
+    DEBUG_PRINTF("%s: p_fd_mapping_file=0x%p.\r\n", __func__, p_fd_mapping_file);
+    if (p_fd_mapping_file == NULL)
+    {
+        ERROR_PRINTF("%s: Fail to open FWID mapping table file \"%s\"!\r\n", __func__, p_mapping_file_path);
+        err = TP_ERR_FILE_NOT_FOUND;
+        goto LOAD_FWID_MAPPING_FILE_EXIT;
+    }
+
+    /* Parse FWID Mapping File */
+    err = parse_fwid_mapping_file(p_fd_mapping_file, p_dev_table);
+    if (err != TP_SUCCESS)
+        ERROR_PRINTF("%s: Fail to parse FWID mapping file, err=%d.", __func__, err);
+
+    // Close FWID Mapping File
+    fclose(p_fd_mapping_file);
+
+LOAD_FWID_MAPPING_FILE_EXIT:
+    return err;
+}
+
+/***************************************************
+ * Binary FWID Mapping Image
+ ***************************************************/
+
+// FNV-1a of Image Header / Entries
+static uint32_t get_fwid_mapping_image_checksum(const void *p_image_data, size_t data_size)
+{
+    const unsigned char *p_data = (const unsigned char *)p_image_data;
+    size_t index = 0;
+    uint32_t checksum = 0x811C9DC5;
+
+    for(index = 0; index < data_size; index++)
+    {
+        checksum ^= p_data[index];
+        checksum *= 0x01000193;
+    }
+
+    return checksum;
+}
+
+static int compare_fwid_mapping_image_entry(const void *p_entry1, const void *p_entry2)
+{
+    uint32_t panel_key1 = ((const struct fwid_mapping_image_entry *)p_entry1)->panel_key,
+             panel_key2 = ((const struct fwid_mapping_image_entry *)p_entry2)->panel_key;
+
+    return (panel_key1 > panel_key2) - (panel_key1 < panel_key2);
+}
+
+// Binary Search in Sorted Image Entries
+static const struct fwid_mapping_image_entry *find_fwid_mapping_image_entry(struct lcm_dev_table *p_dev_table, unsigned int panel_key)
+{
+    size_t low = 0,
+           high = p_dev_table->image_entry_count,
+           middle = 0;
+
+    while (low < high)
+    {
+        middle = low + ((high - low) / 2);
+        if (p_dev_table->p_image_entry[middle].panel_key == panel_key)
+            return &p_dev_table->p_image_entry[middle];
+        else if (p_dev_table->p_image_entry[middle].panel_key < panel_key)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+
+    return NULL;
+}
+
+int compile_fwid_mapping_image(const char *p_mapping_file_path)
+{
+    int err = TP_SUCCESS,
+        fd = -1;
+    size_t index = 0,
+           image_size = 0;
+    ssize_t write_size = 0;
+    char image_file_path[FILE_NAME_LENGTH_MAX + sizeof(FWID_MAPPING_IMAGE_SUFFIX)] = {0},
+         temp_file_path[FILE_NAME_LENGTH_MAX + sizeof(FWID_MAPPING_IMAGE_SUFFIX) + 16] = {0};
+    unsigned char *p_image = NULL;
+    struct fwid_mapping_image_header *p_image_header = NULL;
+    struct fwid_mapping_image_entry *p_image_entry = NULL;
+    struct lcm_dev_table dev_table,
+                         image_table;
+    FILE *p_fd_mapping_file = NULL;
+
+    init_lcm_dev_table(&dev_table);
+
+    if (p_mapping_file_path == NULL)
+    {
+        ERROR_PRINTF("%s: NULL FWID mapping file path!\r\n", __func__);
+        err = TP_ERR_INVALID_PARAM;
+        goto COMPILE_FWID_MAPPING_IMAGE_EXIT;
+    }
+
+    // Always Compile from Text File
+    p_fd_mapping_file = fopen(p_mapping_file_path, "r");
+    if (p_fd_mapping_file == NULL)
+    {
+        ERROR_PRINTF("%s: Fail to open FWID mapping table file \"%s\"!\r\n", __func__, p_mapping_file_path);
+        err = TP_ERR_FILE_NOT_FOUND;
+        goto COMPILE_FWID_MAPPING_IMAGE_EXIT;
+    }
+
+    err = parse_fwid_mapping_file(p_fd_mapping_file, &dev_table);
+    if (err != TP_SUCCESS)
+    {
+        ERROR_PRINTF("%s: Fail to parse FWID mapping file, err=%d.\r\n", __func__, err);
+        goto COMPILE_FWID_MAPPING_IMAGE_EXIT;
+    }
+
+    // Build Image
+    image_size = sizeof(struct fwid_mapping_image_header) + (dev_table.dev_info_count * sizeof(struct fwid_mapping_image_entry));
+    p_image = (unsigned char *)calloc(1, image_size);
+    if (p_image == NULL)
+    {
+        ERROR_PRINTF("%s: Fail to allocate %zu bytes for image!\r\n", __func__, image_size);
+        err = TP_ERR_NO_INTERFACE_CREATE;
+        goto COMPILE_FWID_MAPPING_IMAGE_EXIT;
+    }
+    p_image_header = (struct fwid_mapping_image_header *)p_image;
+    p_image_entry = (struct fwid_mapping_image_entry *)(p_image + sizeof(struct fwid_mapping_image_header));
+
+    for (index = 0; index < dev_table.dev_info_count; index++)
+    {
+        p_image_entry[index].panel_key = dev_table.p_dev_info[index].panel_key;
+        p_image_entry[index].chrome_fwid = dev_table.p_dev_info[index].chrome_fwid;
+        p_image_entry[index].windows_fwid = dev_table.p_dev_info[index].windows_fwid;
+    }
+    qsort(p_image_entry, dev_table.dev_info_count, sizeof(struct fwid_mapping_image_entry), compare_fwid_mapping_image_entry);
+
+    p_image_header->magic = FWID_MAPPING_IMAGE_MAGIC;
+    p_image_header->version = FWID_MAPPING_IMAGE_VERSION;
+    p_image_header->entry_count = (uint32_t)dev_table.dev_info_count;
+    p_image_header->checksum = get_fwid_mapping_image_checksum(p_image_entry, dev_table.dev_info_count * sizeof(struct fwid_mapping_image_entry));
+    p_image_header->header_checksum = get_fwid_mapping_image_checksum(p_image_header, offsetof(struct fwid_mapping_image_header, header_checksum));
+
+    // Write to Temporary File, then Rename
+    snprintf(image_file_path, sizeof(image_file_path), "%s%s", p_mapping_file_path, FWID_MAPPING_IMAGE_SUFFIX);
+    snprintf(temp_file_path, sizeof(temp_file_path), "%s.%d", image_file_path, (int)getpid());
+    fd = open(temp_file_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+    {
+        ERROR_PRINTF("%s: Fail to create \"%s\"! errno=%d.\r\n", __func__, temp_file_path, errno);
+        err = TP_ERR_FILE_IO_ERROR;
+        goto COMPILE_FWID_MAPPING_IMAGE_EXIT;
+    }
+
+    write_size = write(fd, p_image, image_size);
+    if ((write_size != (ssize_t)image_size) || (fsync(fd) != 0))
+    {
+        ERROR_PRINTF("%s: Fail to write \"%s\"! (write_size=%ld, errno=%d)\r\n", __func__, temp_file_path, (long)write_size, errno);
+        err = TP_ERR_FILE_IO_ERROR;
+        goto COMPILE_FWID_MAPPING_IMAGE_EXIT;
+    }
+
+    close(fd);
+    fd = -1;
+
+    if (rename(temp_file_path, image_file_path) != 0)
+    {
+        ERROR_PRINTF("%s: Fail to rename \"%s\" to \"%s\"! errno=%d.\r\n", __func__, temp_file_path, image_file_path, errno);
+        err = TP_ERR_FILE_IO_ERROR;
+        goto COMPILE_FWID_MAPPING_IMAGE_EXIT;
+    }
+
+    // Verify Written Image in Full (Loads Check Header Only)
+    init_lcm_dev_table(&image_table);
+    err = map_fwid_mapping_image(image_file_path, &image_table, true);
+    free_lcm_dev_table(&image_table);
+    if (err != TP_SUCCESS)
+    {
+        ERROR_PRINTF("%s: Image \"%s\" verification failed! err=0x%x.\r\n", __func__, image_file_path, err);
+        goto COMPILE_FWID_MAPPING_IMAGE_EXIT;
+    }
+
+    printf("Compiled %zu LCM devices into \"%s\" (%zu bytes).\r\n", dev_table.dev_info_count, image_file_path, image_size);
+
+    // Success
+    err = TP_SUCCESS;
+
+COMPILE_FWID_MAPPING_IMAGE_EXIT:
+    if (fd >= 0)
+        close(fd);
+    if ((err != TP_SUCCESS) && (strcmp(temp_file_path, "") != 0))
+        unlink(temp_file_path);
+    if (p_fd_mapping_file != NULL)
+        fclose(p_fd_mapping_file);
+    free(p_image);
+    free_lcm_dev_table(&dev_table);
+
+    return err;
+}
+
+// verify_entries: Also Verify Checksum of All Entries (Compile Only, Every Load Checks Header & Size)
+int map_fwid_mapping_image(const char *p_image_file_path, struct lcm_dev_table *p_dev_table, bool verify_entries)
+{
+    int err = TP_SUCCESS,
+        fd = -1;
+    void *p_image_map = MAP_FAILED;
+    struct stat image_file_stat;
+    const struct fwid_mapping_image_header *p_image_header = NULL;
+    const struct fwid_mapping_image_entry *p_image_entry = NULL;
+
+    if ((p_image_file_path == NULL) || (p_dev_table == NULL))
+    {
+        ERROR_PRINTF("%s: Invalid Parameter! (p_image_file_path=0x%p, p_dev_table=0x%p)\r\n", __func__, p_image_file_path, p_dev_table);
+        err = TP_ERR_INVALID_PARAM;
+        goto MAP_FWID_MAPPING_IMAGE_EXIT;
+    }
+
+    fd = open(p_image_file_path, O_RDONLY);
+    if ((fd < 0) || (fstat(fd, &image_file_stat) != 0))
+    {
+        err = TP_ERR_FILE_NOT_FOUND;
+        goto MAP_FWID_MAPPING_IMAGE_EXIT;
+    }
+
+    if ((size_t)image_file_stat.st_size < sizeof(struct fwid_mapping_image_header))
+    {
+        err = TP_ERR_DATA_MISMATCHED;
+        goto MAP_FWID_MAPPING_IMAGE_EXIT;
+    }
+
+    p_image_map = mmap(NULL, image_file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (p_image_map == MAP_FAILED)
+    {
+        ERROR_PRINTF("%s: Fail to mmap \"%s\"! errno=%d.\r\n", __func__, p_image_file_path, errno);
+        err = TP_ERR_FILE_IO_ERROR;
+        goto MAP_FWID_MAPPING_IMAGE_EXIT;
+    }
+
+    // Validate Header & Size (Entries are not Read beyond Binary Search Path)
+    p_image_header = (const struct fwid_mapping_image_header *)p_image_map;
+    p_image_entry = (const struct fwid_mapping_image_entry *)((const unsigned char *)p_image_map + sizeof(struct fwid_mapping_image_header));
+    if ((p_image_header->magic != FWID_MAPPING_IMAGE_MAGIC) || (p_image_header->version != FWID_MAPPING_IMAGE_VERSION) ||
+        (p_image_header->header_checksum != get_fwid_mapping_image_checksum(p_image_header, offsetof(struct fwid_mapping_image_header, header_checksum))) ||
+        ((size_t)image_file_stat.st_size != sizeof(struct fwid_mapping_image_header) + ((size_t)p_image_header->entry_count * sizeof(struct fwid_mapping_image_entry))))
+    {
+        DEBUG_PRINTF("%s: Invalid image header! (magic=0x%08x, version=%u, entry_count=%u, size=%ld)\r\n", __func__, \
+                     p_image_header->magic, p_image_header->version, p_image_header->entry_count, (long)image_file_stat.st_size);
+        err = TP_ERR_DATA_MISMATCHED;
+        goto MAP_FWID_MAPPING_IMAGE_EXIT;
+    }
+    if ((verify_entries == true) &&
+        (p_image_header->checksum != get_fwid_mapping_image_checksum(p_image_entry, (size_t)p_image_header->entry_count * sizeof(struct fwid_mapping_image_entry))))
+    {
+        DEBUG_PRINTF("%s: Image checksum mismatched! (checksum=0x%08x)\r\n", __func__, p_image_header->checksum);
+        err = TP_ERR_DATA_MISMATCHED;
+        goto MAP_FWID_MAPPING_IMAGE_EXIT;
+    }
+
+    // Attach Image to Table
+    p_dev_table->p_image_map = p_image_map;
+    p_dev_table->image_map_size = image_file_stat.st_size;
+    p_dev_table->p_image_entry = p_image_entry;
+    p_dev_table->image_entry_count = p_image_header->entry_count;
+    p_image_map = MAP_FAILED;
+    DEBUG_PRINTF("%s: %zu LCM devices mapped from \"%s\".\r\n", __func__, p_dev_table->image_entry_count, p_image_file_path);
+
+    // Success
+    err = TP_SUCCESS;
+
+MAP_FWID_MAPPING_IMAGE_EXIT:
+    if (p_image_map != MAP_FAILED)
+        munmap(p_image_map, image_file_stat.st_size);
+    if (fd >= 0)
+        close(fd);
+
+    return err;
+}
+
+/***************************************************
+ * Benchmark
+ ***************************************************/
+
+int benchmark_fwid_mapping_file(size_t row_count)
+{
+    int err = TP_SUCCESS;
+    FILE *p_fd_mapping_file = NULL;
+    struct lcm_dev_table dev_table;
+    size_t index = 0,
+           found_count = 0;
+    unsigned short fwid = 0;
+    unsigned long long start_time_us = 0,
+                       parse_time_us = 0,
+                       lookup_time_us = 0;
+
+    init_lcm_dev_table(&dev_table);
+
+    // Generate Synthetic Mapping Table (Distinct Non-Zero Manufacturer/Product Pairs)
+    p_fd_mapping_file = tmpfile();
+    if (p_fd_mapping_file == NULL)
+    {
+        ERROR_PRINTF("%s: Fail to create temporary mapping file!\r\n", __func__);
+        err = TP_ERR_FILE_IO_ERROR;
+        goto BENCHMARK_FWID_MAPPING_FILE_EXIT;
+    }
+    fprintf(p_fd_mapping_file, "manufacturer.product,chrome_fwid,windows_fwid,\n");
+    for (index = 0; index < row_count; index++)
+    {
+        fprintf(p_fd_mapping_file, "%04x.%04x,%04x,%04x,\n", (unsigned int)(0x0001 + (index >> 15)), (unsigned int)(0x0001 + (index & 0x7FFF)), \
+                (unsigned int)(index & 0xFFFF), (unsigned int)((index + 1) & 0xFFFF));
+    }
+    rewind(p_fd_mapping_file);
+
+    // Parse
+    start_time_us = get_monotonic_time_us();
+    err = parse_fwid_mapping_file(p_fd_mapping_file, &dev_table);
+    parse_time_us = get_elapsed_time_us(start_time_us);
+    if (err != TP_SUCCESS)
+    {
+        ERROR_PRINTF("%s: Fail to parse synthetic mapping file! err=0x%x.\r\n", __func__, err);
+        goto BENCHMARK_FWID_MAPPING_FILE_EXIT;
+    }
+
+    // Look up Every Row
+    start_time_us = get_monotonic_time_us();
+    for (index = 0; index < row_count; index++)
+    {
+        if (get_fwid_from_edid(&dev_table, (unsigned short)(0x0001 + (index >> 15)), (unsigned short)(0x0001 + (index & 0x7FFF)), WINDOWS, &fwid) == TP_SUCCESS)
+            found_count++;
+    }
+    lookup_time_us = get_elapsed_time_us(start_time_us);
+
+    printf("--------------------------------------\r\n");
+    printf("Benchmark: FWID Mapping Table (%zu rows).\r\n", row_count);
+    printf("Parse: %llu us (%zu entries).\r\n", parse_time_us, dev_table.dev_info_count);
+    printf("Lookup: %llu us (%zu found, %.1f ns/lookup).\r\n", lookup_time_us, found_count, \
+           (row_count == 0) ? 0.0 : ((double)lookup_time_us * 1000.0 / (double)row_count));
+
+BENCHMARK_FWID_MAPPING_FILE_EXIT:
+    if (p_fd_mapping_file != NULL)
+        fclose(p_fd_mapping_file);
+    free_lcm_dev_table(&dev_table);
+
+    return err;
+}
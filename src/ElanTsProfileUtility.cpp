@@ -0,0 +1,268 @@
+/** @file
+
+  Implementation of Profile Utility (Phase Timing & I/O Latency Histogram) for Elan I2C-HID Touchscreen.
+
+  Copyright (c) ELAN microelectronics corp. 2022, All Rights Reserved
+
+  Module Name:
+	ElanTsProfileUtility.cpp
+
+  Environment:
+	All kinds of Linux-like Platform.
+
+**/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ErrCode.h"
+#include "ElanTsRetryUtility.h"
+#include "ElanTsProfileUtility.h"
+
+/***************************************************
+ * Global Data Structure Declaration
+ ***************************************************/
+
+// Latency Histogram of One Kind of I/O
+typedef struct latency_histogram
+{
+    unsigned long count;
+    unsigned long timeouts;
+    unsigned long errors;
+    unsigned long retries;
+    unsigned long long sum_us;
+    unsigned long long max_us;
+    unsigned long buckets[PROFILE_HISTOGRAM_BUCKETS];
+} LATENCY_HISTOGRAM, *PLATENCY_HISTOGRAM;
+
+/***************************************************
+ * Global Variables Declaration
+ ***************************************************/
+
+// Histograms (Updated Atomically)
+static struct latency_histogram g_latency_histogram[PROFILE_IO_COUNT];
+
+#ifdef __ENABLE_PROFILE__
+// Names of I/O
+static const char *g_profile_io_name[PROFILE_IO_COUNT] = { "write", "read" };
+#endif //__ENABLE_PROFILE__
+
+/***************************************************
+ * Function Prototype
+ ***************************************************/
+
+static int latency_bucket_index(unsigned long long latency_us);
+static unsigned long long latency_bucket_upper_bound(int index);
+static unsigned long long latency_percentile(const struct latency_histogram *p_histogram, int percent);
+
+/***************************************************
+ * Function Implements
+ ***************************************************/
+
+static int latency_bucket_index(unsigned long long latency_us)
+{
+    int msb = 0,
+        index = 0;
+
+    if(latency_us < PROFILE_HISTOGRAM_SUB_BUCKETS)
+        return (int)latency_us;
+
+    msb = 63 - __builtin_clzll(latency_us);
+    if(msb > PROFILE_HISTOGRAM_MAX_EXP)
+        return PROFILE_HISTOGRAM_BUCKETS - 1;
+
+    // Top PROFILE_HISTOGRAM_SUB_BUCKET_BITS bits below MSB Select Sub-Bucket
+    index = ((msb - PROFILE_HISTOGRAM_SUB_BUCKET_BITS + 1) * PROFILE_HISTOGRAM_SUB_BUCKETS) + \
+            (int)((latency_us >> (msb - PROFILE_HISTOGRAM_SUB_BUCKET_BITS)) & (PROFILE_HISTOGRAM_SUB_BUCKETS - 1));
+    if(index >= PROFILE_HISTOGRAM_BUCKETS)
+        index = PROFILE_HISTOGRAM_BUCKETS - 1;
+
+    return index;
+}
+
+static unsigned long long latency_bucket_upper_bound(int index)
+{
+    int msb = 0,
+        sub_bucket = 0;
+    unsigned long long lower_bound = 0;
+
+    if(index < PROFILE_HISTOGRAM_SUB_BUCKETS)
+        return (unsigned long long)index;
+
+    msb = (index / PROFILE_HISTOGRAM_SUB_BUCKETS) + PROFILE_HISTOGRAM_SUB_BUCKET_BITS - 1;
+    sub_bucket = index % PROFILE_HISTOGRAM_SUB_BUCKETS;
+    lower_bound = (unsigned long long)(PROFILE_HISTOGRAM_SUB_BUCKETS + sub_bucket) << (msb - PROFILE_HISTOGRAM_SUB_BUCKET_BITS);
+
+    return lower_bound + (1ULL << (msb - PROFILE_HISTOGRAM_SUB_BUCKET_BITS)) - 1;
+}
+
+// Upper Bound of Bucket Holding the Percentile (Never Above Max.)
+static unsigned long long latency_percentile(const struct latency_histogram *p_histogram, int percent)
+{
+    int index = 0;
+    unsigned long target = 0,
+                  accumulated = 0;
+    unsigned long long bound = 0;
+
+    if(p_histogram->count == 0)
+        return 0;
+
+    // Rank of Percentile (Rounded up, at Least 1)
+    target = (unsigned long)(((unsigned long long)p_histogram->count * percent + 99) / 100);
+    if(target == 0)
+        target = 1;
+
+    for(index = 0; index < PROFILE_HISTOGRAM_BUCKETS; index++)
+    {
+        accumulated += p_histogram->buckets[index];
+        if(accumulated >= target)
+            break;
+    }
+
+    bound = latency_bucket_upper_bound((index < PROFILE_HISTOGRAM_BUCKETS) ? index : (PROFILE_HISTOGRAM_BUCKETS - 1));
+    return (bound < p_histogram->max_us) ? bound : p_histogram->max_us;
+}
+
+void profile_record_io(PROFILE_IO io, unsigned long long latency_us, int err, int retries)
+{
+    struct latency_histogram *p_histogram = NULL;
+    unsigned long long max_us = 0;
+
+    if((io < 0) || (io >= PROFILE_IO_COUNT))
+        return;
+    p_histogram = &g_latency_histogram[io];
+
+    __sync_fetch_and_add(&p_histogram->count, 1);
+    __sync_fetch_and_add(&p_histogram->sum_us, latency_us);
+    __sync_fetch_and_add(&p_histogram->buckets[latency_bucket_index(latency_us)], 1);
+    if(err == TP_ERR_TIMEOUT)
+        __sync_fetch_and_add(&p_histogram->timeouts, 1);
+    else if(err != TP_SUCCESS)
+        __sync_fetch_and_add(&p_histogram->errors, 1);
+    if(retries > 0)
+        __sync_fetch_and_add(&p_histogram->retries, (unsigned long)retries);
+
+    // Max. (Compare & Swap until Stored or Another Thread Stored a Larger One)
+    max_us = p_histogram->max_us;
+    while(latency_us > max_us)
+    {
+        if(__sync_bool_compare_and_swap(&p_histogram->max_us, max_us, latency_us))
+            break;
+        max_us = p_histogram->max_us;
+    }
+
+    return;
+}
+
+void get_latency_summary(PROFILE_IO io, struct latency_summary *p_summary)
+{
+    const struct latency_histogram *p_histogram = NULL;
+
+    if(p_summary == NULL)
+        return;
+    memset(p_summary, 0, sizeof(struct latency_summary));
+
+    if((io < 0) || (io >= PROFILE_IO_COUNT))
+        return;
+    p_histogram = &g_latency_histogram[io];
+
+    p_summary->count = p_histogram->count;
+    p_summary->timeouts = p_histogram->timeouts;
+    p_summary->errors = p_histogram->errors;
+    p_summary->retries = p_histogram->retries;
+    p_summary->mean_us = (p_histogram->count != 0) ? (p_histogram->sum_us / p_histogram->count) : 0;
+    p_summary->p50_us = latency_percentile(p_histogram, 50);
+    p_summary->p95_us = latency_percentile(p_histogram, 95);
+    p_summary->p99_us = latency_percentile(p_histogram, 99);
+    p_summary->max_us = p_histogram->max_us;
+
+    return;
+}
+
+int parse_profile_format(const char *p_format_str, PROFILE_FORMAT *p_format)
+{
+    if(p_format == NULL)
+        return TP_ERR_INVALID_PARAM;
+
+    if((p_format_str == NULL) || (strcmp(p_format_str, "table") == 0))
+        *p_format = PROFILE_FORMAT_TABLE;
+    else if(strcmp(p_format_str, "json") == 0)
+        *p_format = PROFILE_FORMAT_JSON;
+    else
+        return TP_ERR_INVALID_PARAM;
+
+    return TP_SUCCESS;
+}
+
+void show_profile(FILE *p_stream, PROFILE_FORMAT format, const char *p_mode, \
+                  const struct phase_timing *p_phases, int phase_count, unsigned long long total_us)
+{
+    int index = 0;
+    bool first = true;
+    struct retry_statistics retry_statistics;
+#ifdef __ENABLE_PROFILE__
+    int io = 0;
+    struct latency_summary summary;
+#endif //__ENABLE_PROFILE__
+
+    get_retry_statistics(&retry_statistics);
+
+    if(format == PROFILE_FORMAT_JSON)
+    {
+        fprintf(p_stream, "{\"mode\":\"%s\",\"total_us\":%llu,\"phases\":[", p_mode, total_us);
+        for(index = 0; index < phase_count; index++)
+        {
+            if(p_phases[index].end_us == 0) // Not Executed
+                continue;
+            fprintf(p_stream, "%s{\"name\":\"%s\",\"start_us\":%llu,\"end_us\":%llu,\"duration_us\":%llu}", (first) ? "" : ",", \
+                    p_phases[index].name, p_phases[index].start_us, p_phases[index].end_us, p_phases[index].end_us - p_phases[index].start_us);
+            first = false;
+        }
+        fprintf(p_stream, "],\"io\":");
+#ifdef __ENABLE_PROFILE__
+        for(io = 0; io < PROFILE_IO_COUNT; io++)
+        {
+            get_latency_summary((PROFILE_IO)io, &summary);
+            fprintf(p_stream, "%s\"%s\":{\"count\":%lu,\"timeouts\":%lu,\"errors\":%lu,\"retries\":%lu,\"mean_us\":%llu,\"p50_us\":%llu,\"p95_us\":%llu,\"p99_us\":%llu,\"max_us\":%llu}", \
+                    (io == 0) ? "{" : ",", g_profile_io_name[io], summary.count, summary.timeouts, summary.errors, summary.retries, \
+                    summary.mean_us, summary.p50_us, summary.p95_us, summary.p99_us, summary.max_us);
+        }
+        fprintf(p_stream, "}");
+#else
+        fprintf(p_stream, "null");
+#endif //__ENABLE_PROFILE__
+        fprintf(p_stream, ",\"retry\":{\"operations\":%lu,\"attempts\":%lu,\"failed\":%lu,\"sleep_us\":%llu}}\n", \
+                retry_statistics.operations, retry_statistics.attempts, retry_statistics.failed_operations, retry_statistics.sleep_us);
+        return;
+    }
+
+    fprintf(p_stream, "--------------------------------------\r\n");
+    fprintf(p_stream, "Profile (%s):\r\n", p_mode);
+    fprintf(p_stream, "%-26s %10s %10s %12s\r\n", "Phase", "Start(us)", "End(us)", "Duration(us)");
+    for(index = 0; index < phase_count; index++)
+    {
+        if(p_phases[index].end_us == 0) // Not Executed
+            continue;
+        fprintf(p_stream, "%-26s %10llu %10llu %12llu\r\n", p_phases[index].name, \
+                p_phases[index].start_us, p_phases[index].end_us, p_phases[index].end_us - p_phases[index].start_us);
+    }
+    fprintf(p_stream, "%-26s %10s %10s %12llu\r\n", "Total", "", "", total_us);
+
+    fprintf(p_stream, "\r\n");
+#ifdef __ENABLE_PROFILE__
+    fprintf(p_stream, "%-6s %7s %7s %6s %6s %8s %8s %8s %8s %8s (us)\r\n", "I/O", "Count", "Timeout", "Error", "Retry", "Mean", "p50", "p95", "p99", "Max");
+    for(io = 0; io < PROFILE_IO_COUNT; io++)
+    {
+        get_latency_summary((PROFILE_IO)io, &summary);
+        fprintf(p_stream, "%-6s %7lu %7lu %6lu %6lu %8llu %8llu %8llu %8llu %8llu\r\n", g_profile_io_name[io], \
+                summary.count, summary.timeouts, summary.errors, summary.retries, \
+                summary.mean_us, summary.p50_us, summary.p95_us, summary.p99_us, summary.max_us);
+    }
+#else
+    fprintf(p_stream, "I/O latency histogram not compiled in (build with \"make profile=1\").\r\n");
+#endif //__ENABLE_PROFILE__
+    fprintf(p_stream, "Retry: %lu operations, %lu attempts, %lu failed, %llu us in backoff.\r\n", \
+            retry_statistics.operations, retry_statistics.attempts, retry_statistics.failed_operations, retry_statistics.sleep_us);
+
+    return;
+}
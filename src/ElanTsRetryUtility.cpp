@@ -0,0 +1,314 @@
+/** @file
+
+  Implementation of Retry Policy Utility for Elan I2C-HID Touchscreen.
+
+  Copyright (c) ELAN microelectronics corp. 2022, All Rights Reserved
+
+  Module Name:
+	ElanTsRetryUtility.cpp
+
+  Environment:
+	All kinds of Linux-like Platform.
+
+**/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>     	/* usleep */
+#include "ErrCode.h"
+#include "ElanTsTimeUtility.h"
+#include "ElanTsRetryUtility.h"
+
+/***************************************************
+ * Global Variables Declaration
+ ***************************************************/
+
+// Policy Set by User (Overrides Default Policy of Each Operation)
+static bool g_retry_policy_override_set = false;
+static struct retry_policy g_retry_policy_override;
+
+// Statistics (Updated Atomically, Operations may Run on Several Device Threads)
+static struct retry_statistics g_retry_statistics = {0, 0, 0, 0};
+
+// Seed of Backoff Jitter (Per Thread)
+static __thread unsigned int g_retry_jitter_seed = 0;
+
+/***************************************************
+ * Function Prototype
+ ***************************************************/
+
+static unsigned int get_retry_delay_ms(const struct retry_policy *p_policy, int retry_index);
+
+/***************************************************
+ * Function Implements
+ ***************************************************/
+
+void init_retry_policy(struct retry_policy *p_policy, int max_attempts, RETRY_BACKOFF backoff, unsigned int base_delay_ms)
+{
+    if(p_policy == NULL)
+        return;
+
+    // Default Policy of Operation
+    p_policy->max_attempts = (max_attempts > 0) ? max_attempts : 1;
+    p_policy->backoff = backoff;
+    p_policy->base_delay_ms = base_delay_ms;
+    p_policy->max_delay_ms = RETRY_MAX_DELAY_MSEC;
+    p_policy->deadline_ms = 0;
+
+    // Apply Policy Set by User
+    if(g_retry_policy_override_set == true)
+    {
+        if(g_retry_policy_override.max_attempts > 0)
+            p_policy->max_attempts = g_retry_policy_override.max_attempts;
+        p_policy->backoff = g_retry_policy_override.backoff;
+        p_policy->base_delay_ms = g_retry_policy_override.base_delay_ms;
+        p_policy->max_delay_ms = g_retry_policy_override.max_delay_ms;
+        p_policy->deadline_ms = g_retry_policy_override.deadline_ms;
+    }
+
+    return;
+}
+
+// Format: <backoff>[,<base_delay_ms>[,<max_delay_ms>[,<deadline_ms>[,<max_attempts>]]]]
+// backoff: immediate / fixed / linear / exp
+int parse_retry_policy(const char *p_policy_str, struct retry_policy *p_policy)
+{
+    int err = TP_SUCCESS,
+        field_index = 0;
+    long value = 0;
+    char policy_str[128] = {0},
+         *p_field = NULL,
+         *p_next = NULL,
+         *p_end = NULL;
+
+    if((p_policy_str == NULL) || (p_policy == NULL))
+    {
+        ERROR_PRINTF("%s: NULL Pointer!\r\n", __func__);
+        err = TP_ERR_INVALID_PARAM;
+        goto PARSE_RETRY_POLICY_EXIT;
+    }
+
+    if(strlen(p_policy_str) >= sizeof(policy_str))
+    {
+        ERROR_PRINTF("%s: Retry Policy \"%s\" Too Long!\r\n", __func__, p_policy_str);
+        err = TP_ERR_INVALID_PARAM;
+        goto PARSE_RETRY_POLICY_EXIT;
+    }
+    strncpy(policy_str, p_policy_str, sizeof(policy_str) - 1);
+
+    // Default Values of Optional Fields
+    p_policy->max_attempts = 0; // Keep max. attempts of operation
+    p_policy->base_delay_ms = 10;
+    p_policy->max_delay_ms = RETRY_MAX_DELAY_MSEC;
+    p_policy->deadline_ms = 0;
+
+    for(p_field = policy_str, field_index = 0; p_field != NULL; p_field = p_next, field_index++)
+    {
+        p_next = strchr(p_field, ',');
+        if(p_next != NULL)
+            *p_next++ = '\0';
+
+        if(field_index == 0) // Backoff
+        {
+            if(strcmp(p_field, "immediate") == 0)
+                p_policy->backoff = RETRY_BACKOFF_IMMEDIATE;
+            else if(strcmp(p_field, "fixed") == 0)
+                p_policy->backoff = RETRY_BACKOFF_FIXED;
+            else if(strcmp(p_field, "linear") == 0)
+                p_policy->backoff = RETRY_BACKOFF_LINEAR;
+            else if(strcmp(p_field, "exp") == 0)
+                p_policy->backoff = RETRY_BACKOFF_EXPONENTIAL;
+            else
+            {
+                ERROR_PRINTF("%s: Unknown Backoff \"%s\"!\r\n", __func__, p_field);
+                err = TP_ERR_INVALID_PARAM;
+                goto PARSE_RETRY_POLICY_EXIT;
+            }
+            continue;
+        }
+
+        value = strtol(p_field, &p_end, 10);
+        if((*p_field == '\0') || (*p_end != '\0') || (value < 0) || (value > 60000))
+        {
+            ERROR_PRINTF("%s: Invalid Value \"%s\" in Retry Policy!\r\n", __func__, p_field);
+            err = TP_ERR_INVALID_PARAM;
+            goto PARSE_RETRY_POLICY_EXIT;
+        }
+
+        switch(field_index)
+        {
+            case 1:
+                p_policy->base_delay_ms = (unsigned int)value;
+                break;
+            case 2:
+                p_policy->max_delay_ms = (unsigned int)value;
+                break;
+            case 3:
+                p_policy->deadline_ms = (unsigned int)value;
+                break;
+            case 4:
+                p_policy->max_attempts = (int)value;
+                break;
+            default:
+                ERROR_PRINTF("%s: Too Many Fields in Retry Policy \"%s\"!\r\n", __func__, p_policy_str);
+                err = TP_ERR_INVALID_PARAM;
+                goto PARSE_RETRY_POLICY_EXIT;
+        }
+    }
+
+    // Success
+    err = TP_SUCCESS;
+
+PARSE_RETRY_POLICY_EXIT:
+    return err;
+}
+
+void set_retry_policy_override(const struct retry_policy *p_policy)
+{
+    if(p_policy == NULL)
+    {
+        g_retry_policy_override_set = false;
+        return;
+    }
+
+    memcpy(&g_retry_policy_override, p_policy, sizeof(struct retry_policy));
+    g_retry_policy_override_set = true;
+
+    return;
+}
+
+// Errors Caused by Transient Condition (Touch Traffic, Slow Response, Bus Glitch, No Free Report Slot)
+bool is_retriable_error(int err)
+{
+    switch(err)
+    {
+        case TP_ERR_DEVICE_BUSY:
+        case TP_ERR_TIMEOUT:
+        case TP_ERR_DATA_PATTERN:
+        case TP_ERR_DATA_MISMATCHED:
+        case TP_ERR_IO_ERROR:
+            return true;
+        default:
+            return false;
+    }
+}
+
+static unsigned int get_retry_delay_ms(const struct retry_policy *p_policy, int retry_index /* 1: First Retry */)
+{
+    unsigned int delay_ms = 0;
+
+    switch(p_policy->backoff)
+    {
+        case RETRY_BACKOFF_FIXED:
+            delay_ms = p_policy->base_delay_ms;
+            break;
+
+        case RETRY_BACKOFF_LINEAR:
+            delay_ms = p_policy->base_delay_ms * retry_index;
+            break;
+
+        case RETRY_BACKOFF_EXPONENTIAL:
+            delay_ms = p_policy->base_delay_ms;
+            while((--retry_index > 0) && (delay_ms < p_policy->max_delay_ms))
+                delay_ms <<= 1;
+            if(delay_ms > p_policy->max_delay_ms)
+                delay_ms = p_policy->max_delay_ms;
+
+            // Jitter: Spread to [delay/2, delay] so devices on the same bus do not retry in lockstep
+            if(g_retry_jitter_seed == 0)
+                g_retry_jitter_seed = (unsigned int)get_monotonic_time_us() | 1;
+            if(delay_ms > 1)
+                delay_ms = (delay_ms / 2) + (rand_r(&g_retry_jitter_seed) % ((delay_ms / 2) + 1));
+            break;
+
+        case RETRY_BACKOFF_IMMEDIATE:
+        default:
+            delay_ms = 0;
+            break;
+    }
+
+    if(delay_ms > p_policy->max_delay_ms)
+        delay_ms = p_policy->max_delay_ms;
+
+    return delay_ms;
+}
+
+int run_with_retry(const char *p_operation_name, const struct retry_policy *p_policy, retry_operation operation, void *p_context)
+{
+    int err = TP_SUCCESS,
+        attempt = 0;
+    unsigned int delay_ms = 0;
+    unsigned long long start_time_us = 0,
+                       elapsed_us = 0;
+
+    if((p_operation_name == NULL) || (p_policy == NULL) || (operation == NULL))
+    {
+        ERROR_PRINTF("%s: NULL Pointer!\r\n", __func__);
+        err = TP_ERR_INVALID_PARAM;
+        goto RUN_WITH_RETRY_EXIT;
+    }
+
+    __sync_fetch_and_add(&g_retry_statistics.operations, 1);
+    start_time_us = get_monotonic_time_us();
+
+    for(attempt = 1; ; attempt++)
+    {
+        __sync_fetch_and_add(&g_retry_statistics.attempts, 1);
+
+        err = operation(p_context);
+        if(err == TP_SUCCESS)
+        {
+            // Without any error => Break retry loop and continue.
+            break;
+        }
+
+        DEBUG_PRINTF("%s: [%d/%d] Fail to %s! err=0x%x.\r\n", __func__, attempt, p_policy->max_attempts, p_operation_name, err);
+
+        // Error Not Fixed by Retrying (e.g. Invalid Parameter)
+        if(is_retriable_error(err) == false)
+        {
+            ERROR_PRINTF("%s: Fail to %s (Not Retriable)! err=0x%x.\r\n", __func__, p_operation_name, err);
+            __sync_fetch_and_add(&g_retry_statistics.failed_operations, 1);
+            break;
+        }
+
+        // Have retried for max. attempts and can't fix it => Stop
+        if(attempt >= p_policy->max_attempts)
+        {
+            ERROR_PRINTF("%s: Fail to %s! err=0x%x.\r\n", __func__, p_operation_name, err);
+            __sync_fetch_and_add(&g_retry_statistics.failed_operations, 1);
+            break;
+        }
+
+        // Stop if Next Attempt Cannot Start before Deadline
+        delay_ms = get_retry_delay_ms(p_policy, attempt);
+        elapsed_us = get_elapsed_time_us(start_time_us);
+        if((p_policy->deadline_ms != 0) && \
+           ((elapsed_us + ((unsigned long long)delay_ms * 1000ULL)) >= ((unsigned long long)p_policy->deadline_ms * 1000ULL)))
+        {
+            ERROR_PRINTF("%s: Fail to %s (Deadline %u ms Reached after %d Attempts)! err=0x%x.\r\n", __func__, p_operation_name, p_policy->deadline_ms, attempt, err);
+            __sync_fetch_and_add(&g_retry_statistics.failed_operations, 1);
+            break;
+        }
+
+        if(delay_ms > 0)
+        {
+            usleep(delay_ms * 1000);
+            __sync_fetch_and_add(&g_retry_statistics.sleep_us, (unsigned long long)delay_ms * 1000ULL);
+        }
+    }
+
+RUN_WITH_RETRY_EXIT:
+    return err;
+}
+
+void get_retry_statistics(struct retry_statistics *p_statistics)
+{
+    if(p_statistics == NULL)
+        return;
+
+    memcpy(p_statistics, &g_retry_statistics, sizeof(struct retry_statistics));
+
+    return;
+}
@@ -0,0 +1,34 @@
+/** @file
+
+  Implementation of Time Utility for Elan I2C-HID Touchscreen.
+
+  Copyright (c) ELAN microelectronics corp. 2022, All Rights Reserved
+
+  Module Name:
+	ElanTsTimeUtility.cpp
+
+  Environment:
+	All kinds of Linux-like Platform.
+
+**/
+
+#include <time.h>			/* clock_gettime */
+#include "ElanTsTimeUtility.h"
+
+/***************************************************
+ * Function Implements
+ ***************************************************/
+
+unsigned long long get_monotonic_time_us(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((unsigned long long)now.tv_sec * 1000000ULL) + ((unsigned long long)now.tv_nsec / 1000ULL);
+}
+
+unsigned long long get_elapsed_time_us(unsigned long long start_time_us)
+{
+    return get_monotonic_time_us() - start_time_us;
+}
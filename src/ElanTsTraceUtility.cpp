@@ -0,0 +1,281 @@
+/** @file
+
+  Implementation of HID Transaction Trace Utility (Binary Trace Record & Load) for Elan I2C-HID Touchscreen.
+
+  Copyright (c) ELAN microelectronics corp. 2022, All Rights Reserved
+
+  Module Name:
+	ElanTsTraceUtility.cpp
+
+  Environment:
+	All kinds of Linux-like Platform.
+
+**/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>			/* time */
+#include "ErrCode.h"
+#include "ElanTsTraceUtility.h"
+
+/***************************************************
+ * Definitions
+ ***************************************************/
+
+// Records Allocated at Once while Loading
+#define TRACE_LOAD_CHUNK_RECORDS		1024
+
+/***************************************************
+ * Function Prototype
+ ***************************************************/
+
+static void put_le16(unsigned char *p_buf, unsigned short value);
+static void put_le32(unsigned char *p_buf, unsigned int value);
+static void put_le64(unsigned char *p_buf, unsigned long long value);
+static unsigned short get_le16(const unsigned char *p_buf);
+static unsigned int get_le32(const unsigned char *p_buf);
+static unsigned long long get_le64(const unsigned char *p_buf);
+
+/***************************************************
+ * Function Implements
+ ***************************************************/
+
+static void put_le16(unsigned char *p_buf, unsigned short value)
+{
+    p_buf[0] = (unsigned char)(value & 0xFF);
+    p_buf[1] = (unsigned char)((value >> 8) & 0xFF);
+    return;
+}
+
+static void put_le32(unsigned char *p_buf, unsigned int value)
+{
+    put_le16(&p_buf[0], (unsigned short)(value & 0xFFFF));
+    put_le16(&p_buf[2], (unsigned short)((value >> 16) & 0xFFFF));
+    return;
+}
+
+static void put_le64(unsigned char *p_buf, unsigned long long value)
+{
+    put_le32(&p_buf[0], (unsigned int)(value & 0xFFFFFFFFULL));
+    put_le32(&p_buf[4], (unsigned int)((value >> 32) & 0xFFFFFFFFULL));
+    return;
+}
+
+static unsigned short get_le16(const unsigned char *p_buf)
+{
+    return (unsigned short)(p_buf[0] | (p_buf[1] << 8));
+}
+
+static unsigned int get_le32(const unsigned char *p_buf)
+{
+    return (unsigned int)get_le16(&p_buf[0]) | ((unsigned int)get_le16(&p_buf[2]) << 16);
+}
+
+static unsigned long long get_le64(const unsigned char *p_buf)
+{
+    return (unsigned long long)get_le32(&p_buf[0]) | ((unsigned long long)get_le32(&p_buf[4]) << 32);
+}
+
+int trace_writer_open(const char *p_file_path, unsigned short vid, unsigned short pid, struct trace_writer *p_writer)
+{
+    int err = TP_SUCCESS;
+    unsigned char header[TRACE_FILE_HEADER_SIZE] = {0};
+
+    if((p_file_path == NULL) || (p_writer == NULL))
+    {
+        ERROR_PRINTF("%s: NULL Pointer!\r\n", __func__);
+        err = TP_ERR_INVALID_PARAM;
+        goto TRACE_WRITER_OPEN_EXIT;
+    }
+    memset(p_writer, 0, sizeof(struct trace_writer));
+
+    p_writer->p_file = fopen(p_file_path, "wb");
+    if(p_writer->p_file == NULL)
+    {
+        ERROR_PRINTF("%s: Fail to Open Trace File \"%s\"!\r\n", __func__, p_file_path);
+        err = TP_ERR_FILE_NOT_FOUND;
+        goto TRACE_WRITER_OPEN_EXIT;
+    }
+
+    memcpy(&header[0], TRACE_FILE_MAGIC, 4);
+    put_le16(&header[4], TRACE_FILE_VERSION);
+    put_le16(&header[8], vid);
+    put_le16(&header[10], pid);
+    put_le64(&header[16], (unsigned long long)time(NULL));
+    if(fwrite(header, 1, sizeof(header), p_writer->p_file) != sizeof(header))
+    {
+        ERROR_PRINTF("%s: Fail to Write Trace Header!\r\n", __func__);
+        fclose(p_writer->p_file);
+        p_writer->p_file = NULL;
+        err = TP_ERR_FILE_IO_ERROR;
+        goto TRACE_WRITER_OPEN_EXIT;
+    }
+    DEBUG_PRINTF("%s: Record trace to \"%s\" (VID 0x%04x, PID 0x%04x).\r\n", __func__, p_file_path, vid, pid);
+
+    // Success
+    err = TP_SUCCESS;
+
+TRACE_WRITER_OPEN_EXIT:
+    return err;
+}
+
+int trace_writer_append(struct trace_writer *p_writer, TRACE_DIRECTION direction, unsigned long long time_us, const unsigned char *p_report, int report_size)
+{
+    unsigned char record_header[TRACE_RECORD_HEADER_SIZE] = {0};
+    unsigned long long delta_us = 0;
+    int data_len = 0;
+
+    if((p_writer == NULL) || (p_writer->p_file == NULL) || (p_report == NULL) || (report_size <= 0))
+        return TP_ERR_INVALID_PARAM;
+
+    if(report_size > TRACE_REPORT_SIZE_MAX)
+        report_size = TRACE_REPORT_SIZE_MAX;
+
+    // Trim Trailing Zero (Output Reports are Padded to 33 Bytes, Most Responses are Short)
+    data_len = report_size;
+    while((data_len > 1) && (p_report[data_len - 1] == 0))
+        data_len--;
+
+    // Time Delta (Saturated at ~71 Minutes)
+    if((p_writer->last_time_us != 0) && (time_us > p_writer->last_time_us))
+        delta_us = time_us - p_writer->last_time_us;
+    if(delta_us > 0xFFFFFFFFULL)
+        delta_us = 0xFFFFFFFFULL;
+    p_writer->last_time_us = time_us;
+
+    put_le32(&record_header[0], (unsigned int)delta_us);
+    record_header[4] = (unsigned char)direction;
+    record_header[5] = (unsigned char)report_size;
+    record_header[6] = (unsigned char)data_len;
+    if((fwrite(record_header, 1, sizeof(record_header), p_writer->p_file) != sizeof(record_header)) || \
+       (fwrite(p_report, 1, data_len, p_writer->p_file) != (size_t)data_len))
+        return TP_ERR_FILE_IO_ERROR;
+
+    p_writer->records++;
+
+    return TP_SUCCESS;
+}
+
+void trace_writer_close(struct trace_writer *p_writer)
+{
+    if((p_writer == NULL) || (p_writer->p_file == NULL))
+        return;
+
+    fclose(p_writer->p_file);
+    p_writer->p_file = NULL;
+    DEBUG_PRINTF("%s: %lu records traced.\r\n", __func__, p_writer->records);
+
+    return;
+}
+
+int trace_load(const char *p_file_path, struct trace_header *p_header, struct trace_record **pp_records, int *p_record_count)
+{
+    int err = TP_SUCCESS,
+        record_count = 0,
+        record_capacity = 0;
+    FILE *p_file = NULL;
+    unsigned char header[TRACE_FILE_HEADER_SIZE] = {0},
+                  record_header[TRACE_RECORD_HEADER_SIZE] = {0};
+    unsigned long long time_us = 0;
+    struct trace_record *p_records = NULL,
+                        *p_new_records = NULL,
+                        *p_record = NULL;
+    size_t read_len = 0;
+
+    if((p_file_path == NULL) || (p_header == NULL) || (pp_records == NULL) || (p_record_count == NULL))
+    {
+        ERROR_PRINTF("%s: NULL Pointer!\r\n", __func__);
+        err = TP_ERR_INVALID_PARAM;
+        goto TRACE_LOAD_EXIT;
+    }
+
+    p_file = fopen(p_file_path, "rb");
+    if(p_file == NULL)
+    {
+        ERROR_PRINTF("%s: Fail to Open Trace File \"%s\"!\r\n", __func__, p_file_path);
+        err = TP_ERR_FILE_NOT_FOUND;
+        goto TRACE_LOAD_EXIT;
+    }
+
+    // Header
+    if((fread(header, 1, sizeof(header), p_file) != sizeof(header)) || (memcmp(header, TRACE_FILE_MAGIC, 4) != 0) || \
+       (get_le16(&header[4]) != TRACE_FILE_VERSION))
+    {
+        ERROR_PRINTF("%s: \"%s\" is not a Trace File (Version %d)!\r\n", __func__, p_file_path, TRACE_FILE_VERSION);
+        err = TP_ERR_DATA_PATTERN;
+        goto TRACE_LOAD_CLOSE;
+    }
+    p_header->version = get_le16(&header[4]);
+    p_header->vid = get_le16(&header[8]);
+    p_header->pid = get_le16(&header[10]);
+    p_header->capture_time = get_le64(&header[16]);
+
+    // Records
+    while(true)
+    {
+        read_len = fread(record_header, 1, sizeof(record_header), p_file);
+        if(read_len == 0) // End of Trace
+            break;
+
+        if((read_len != sizeof(record_header)) || (record_header[4] > TRACE_DIRECTION_IN) || \
+           (record_header[5] > TRACE_REPORT_SIZE_MAX) || (record_header[6] > record_header[5]))
+        {
+            ERROR_PRINTF("%s: Broken Record #%d in \"%s\"!\r\n", __func__, record_count, p_file_path);
+            err = TP_ERR_DATA_PATTERN;
+            goto TRACE_LOAD_CLOSE;
+        }
+
+        if(record_count == record_capacity)
+        {
+            record_capacity += TRACE_LOAD_CHUNK_RECORDS;
+            p_new_records = (struct trace_record *)realloc(p_records, sizeof(struct trace_record) * record_capacity);
+            if(p_new_records == NULL)
+            {
+                ERROR_PRINTF("%s: Fail to Allocate %d Records!\r\n", __func__, record_capacity);
+                err = TP_ERR_NO_INTERFACE_CREATE;
+                goto TRACE_LOAD_CLOSE;
+            }
+            p_records = p_new_records;
+        }
+
+        p_record = &p_records[record_count];
+        memset(p_record, 0, sizeof(struct trace_record));
+        time_us += (record_count == 0) ? 0 : get_le32(&record_header[0]);
+        p_record->time_us = time_us;
+        p_record->direction = record_header[4];
+        p_record->report_size = record_header[5];
+        if(fread(p_record->data, 1, record_header[6], p_file) != record_header[6])
+        {
+            ERROR_PRINTF("%s: Truncated Record #%d in \"%s\"!\r\n", __func__, record_count, p_file_path);
+            err = TP_ERR_DATA_PATTERN;
+            goto TRACE_LOAD_CLOSE;
+        }
+        record_count++;
+    }
+    DEBUG_PRINTF("%s: %d records loaded from \"%s\" (VID 0x%04x, PID 0x%04x, %llu us).\r\n", __func__, \
+                 record_count, p_file_path, p_header->vid, p_header->pid, time_us);
+
+    *pp_records = p_records;
+    *p_record_count = record_count;
+    p_records = NULL;
+
+    // Success
+    err = TP_SUCCESS;
+
+TRACE_LOAD_CLOSE:
+    fclose(p_file);
+    if(p_records != NULL)
+        free(p_records);
+
+TRACE_LOAD_EXIT:
+    return err;
+}
+
+void trace_free(struct trace_record *p_records)
+{
+    if(p_records != NULL)
+        free(p_records);
+
+    return;
+}
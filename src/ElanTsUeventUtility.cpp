@@ -0,0 +1,264 @@
+/** @file
+
+  Implementation of Kernel Uevent Utility for Elan I2C-HID Touchscreen.
+
+  Copyright (c) ELAN microelectronics corp. 2022, All Rights Reserved
+
+  Module Name:
+	ElanTsUeventUtility.cpp
+
+  Environment:
+	All kinds of Linux-like Platform.
+
+**/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>				/* errno */
+#include <unistd.h>     		/* close, getpid */
+#include <poll.h>				/* poll */
+#include <sys/socket.h>			/* socket */
+#include <linux/netlink.h>		/* NETLINK_KOBJECT_UEVENT */
+#include "ErrCode.h"
+#include "ElanTsUeventUtility.h"
+
+/***************************************************
+ * Global Variables Declaration
+ ***************************************************/
+
+/***************************************************
+ * Function Implements
+ ***************************************************/
+
+int uevent_open(int *p_fd)
+{
+    int err = TP_SUCCESS,
+        fd = -1;
+    struct sockaddr_nl address;
+
+    if(p_fd == NULL)
+    {
+        ERROR_PRINTF("%s: NULL Pointer!\r\n", __func__);
+        err = TP_ERR_INVALID_PARAM;
+        goto UEVENT_OPEN_EXIT;
+    }
+
+    fd = socket(AF_NETLINK, SOCK_DGRAM | SOCK_CLOEXEC, NETLINK_KOBJECT_UEVENT);
+    if(fd < 0)
+    {
+        ERROR_PRINTF("%s: Fail to Create Uevent Socket! errno=%d.\r\n", __func__, errno);
+        err = TP_ERR_IO_ERROR;
+        goto UEVENT_OPEN_EXIT;
+    }
+
+    // Kernel Uevent Multicast Group
+    memset(&address, 0, sizeof(address));
+    address.nl_family = AF_NETLINK;
+    address.nl_pid = 0; // Assigned by kernel
+    address.nl_groups = 1;
+    if(bind(fd, (struct sockaddr *)&address, sizeof(address)) < 0)
+    {
+        ERROR_PRINTF("%s: Fail to Bind Uevent Socket! errno=%d.\r\n", __func__, errno);
+        close(fd);
+        err = TP_ERR_IO_ERROR;
+        goto UEVENT_OPEN_EXIT;
+    }
+
+    *p_fd = fd;
+    err = TP_SUCCESS;
+
+UEVENT_OPEN_EXIT:
+    return err;
+}
+
+int uevent_receive(int fd, struct uevent_message *p_message, int timeout_ms)
+{
+    int err = TP_SUCCESS,
+        ret = 0;
+    char buf[UEVENT_BUFFER_SIZE] = {0};
+    struct pollfd pfd;
+
+    if(p_message == NULL)
+    {
+        ERROR_PRINTF("%s: NULL Pointer!\r\n", __func__);
+        err = TP_ERR_INVALID_PARAM;
+        goto UEVENT_RECEIVE_EXIT;
+    }
+
+    pfd.fd = fd;
+    pfd.events = POLLIN;
+    pfd.revents = 0;
+    ret = poll(&pfd, 1, timeout_ms);
+    if((ret == 0) || ((ret < 0) && (errno == EINTR)))
+    {
+        err = TP_ERR_TIMEOUT;
+        goto UEVENT_RECEIVE_EXIT;
+    }
+    if(ret < 0)
+    {
+        err = TP_ERR_IO_ERROR;
+        goto UEVENT_RECEIVE_EXIT;
+    }
+
+    ret = recv(fd, buf, sizeof(buf) - 1, 0);
+    if(ret <= 0)
+    {
+        err = ((ret < 0) && (errno == EINTR)) ? TP_ERR_TIMEOUT : TP_ERR_IO_ERROR;
+        goto UEVENT_RECEIVE_EXIT;
+    }
+
+    err = uevent_parse(buf, (size_t)ret, p_message);
+
+UEVENT_RECEIVE_EXIT:
+    return err;
+}
+
+void uevent_close(int fd)
+{
+    if(fd >= 0)
+        close(fd);
+
+    return;
+}
+
+int uevent_parse_property(const char *p_property, struct uevent_message *p_message)
+{
+    if(strncmp(p_property, "ACTION=", 7) == 0)
+        strncpy(p_message->action, &p_property[7], sizeof(p_message->action) - 1);
+    else if(strncmp(p_property, "SUBSYSTEM=", 10) == 0)
+        strncpy(p_message->subsystem, &p_property[10], sizeof(p_message->subsystem) - 1);
+    else if(strncmp(p_property, "DEVNAME=", 8) == 0)
+        strncpy(p_message->devname, &p_property[8], sizeof(p_message->devname) - 1);
+    else if(strncmp(p_property, "DEVPATH=", 8) == 0)
+        strncpy(p_message->devpath, &p_property[8], sizeof(p_message->devpath) - 1);
+    else if(strncmp(p_property, "EDID=", 5) == 0)
+        strncpy(p_message->edid, &p_property[5], sizeof(p_message->edid) - 1);
+
+    return TP_SUCCESS;
+}
+
+int uevent_get_hid_id(const struct uevent_message *p_message, unsigned int *p_bus, unsigned short *p_vid, unsigned short *p_pid)
+{
+    int err = TP_ERR_DATA_NOT_FOUND,
+        name_len = 0;
+    unsigned int bus = 0,
+                 vid = 0,
+                 pid = 0,
+                 instance = 0;
+    const char *p_name = NULL;
+
+    if((p_message == NULL) || (p_bus == NULL) || (p_vid == NULL) || (p_pid == NULL))
+    {
+        ERROR_PRINTF("%s: NULL Pointer!\r\n", __func__);
+        err = TP_ERR_INVALID_PARAM;
+        goto UEVENT_GET_HID_ID_EXIT;
+    }
+
+    // HID Device Name "BBBB:VVVV:PPPP.NNNN" is One Component of DEVPATH
+    // (Exactly 4 Hex Digits per Field, so PCI Address like "0000:00:15.1" Does Not Match)
+    for(p_name = strchr(p_message->devpath, '/'); p_name != NULL; p_name = strchr(p_name, '/'))
+    {
+        p_name++;
+        name_len = 0;
+        if((sscanf(p_name, "%4x:%4x:%4x.%4x%n", &bus, &vid, &pid, &instance, &name_len) == 4) && \
+           (name_len == UEVENT_HID_NAME_LENGTH) && ((p_name[name_len] == '/') || (p_name[name_len] == '\0')))
+        {
+            *p_bus = bus;
+            *p_vid = (unsigned short)vid;
+            *p_pid = (unsigned short)pid;
+            err = TP_SUCCESS;
+            break;
+        }
+    }
+
+UEVENT_GET_HID_ID_EXIT:
+    return err;
+}
+
+int uevent_parse(const char *p_buf, size_t len, struct uevent_message *p_message)
+{
+    int err = TP_SUCCESS;
+    size_t offset = 0;
+
+    if((p_buf == NULL) || (p_message == NULL))
+    {
+        ERROR_PRINTF("%s: NULL Pointer!\r\n", __func__);
+        err = TP_ERR_INVALID_PARAM;
+        goto UEVENT_PARSE_EXIT;
+    }
+
+    memset(p_message, 0, sizeof(struct uevent_message));
+
+    // Header "action@devpath" Skipped, Same Data Follows as Properties (ACTION / DEVPATH)
+    for(offset = 0; offset < len; offset += strnlen(&p_buf[offset], len - offset) + 1)
+        uevent_parse_property(&p_buf[offset], p_message);
+
+    if((p_message->action[0] == '\0') || (p_message->subsystem[0] == '\0'))
+    {
+        err = TP_ERR_DATA_PATTERN;
+        goto UEVENT_PARSE_EXIT;
+    }
+
+    err = TP_SUCCESS;
+
+UEVENT_PARSE_EXIT:
+    return err;
+}
+
+int uevent_replay_next(FILE *p_file, struct uevent_message *p_message)
+{
+    int err = TP_ERR_DATA_NOT_FOUND;
+    char line[512] = {0};
+    size_t line_len = 0;
+    bool property_found = false;
+
+    if((p_file == NULL) || (p_message == NULL))
+    {
+        ERROR_PRINTF("%s: NULL Pointer!\r\n", __func__);
+        err = TP_ERR_INVALID_PARAM;
+        goto UEVENT_REPLAY_NEXT_EXIT;
+    }
+
+    memset(p_message, 0, sizeof(struct uevent_message));
+
+    while(fgets(line, sizeof(line), p_file) != NULL)
+    {
+        // Remove Line Break
+        line_len = strlen(line);
+        while((line_len > 0) && ((line[line_len - 1] == '\n') || (line[line_len - 1] == '\r')))
+            line[--line_len] = '\0';
+
+        // Blank Line Ends a Message
+        if(line_len == 0)
+        {
+            if(property_found == true)
+                break;
+            continue;
+        }
+
+        // Header Line (ex: "KERNEL[123.456] add /devices/... (hidraw)") or Comment
+        if((strchr(line, '=') == NULL) || (line[0] == '#'))
+            continue;
+
+        uevent_parse_property(line, p_message);
+        property_found = true;
+    }
+
+    if(property_found == false) // End of File
+    {
+        err = TP_ERR_DATA_NOT_FOUND;
+        goto UEVENT_REPLAY_NEXT_EXIT;
+    }
+
+    if((p_message->action[0] == '\0') || (p_message->subsystem[0] == '\0'))
+    {
+        err = TP_ERR_DATA_PATTERN;
+        goto UEVENT_REPLAY_NEXT_EXIT;
+    }
+
+    err = TP_SUCCESS;
+
+UEVENT_REPLAY_NEXT_EXIT:
+    return err;
+}
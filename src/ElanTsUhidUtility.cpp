@@ -0,0 +1,394 @@
+/** @file
+
+  Implementation of uhid Utility (Virtual Elan I2C-HID Touchscreen behind Kernel hidraw).
+
+  Copyright (c) ELAN microelectronics corp. 2022, All Rights Reserved
+
+  Module Name:
+	ElanTsUhidUtility.cpp
+
+  Environment:
+	All kinds of Linux-like Platform.
+
+**/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>			/* errno */
+#include <fcntl.h>			/* open */
+#include <unistd.h>     	/* read, write, close, usleep */
+#include <poll.h>			/* ppoll */
+#include <linux/input.h>	/* BUS_TYPE */
+#include <linux/uhid.h>		/* uhid_event */
+#include "ErrCode.h"
+#include "ElanTsTimeUtility.h"
+#include "ElanTsHidDevUtility.h"
+#include "I2CHIDSimulatorGet.h"
+#include "ElanTsUhidUtility.h"
+
+/***************************************************
+ * Definitions
+ ***************************************************/
+
+// Interval of Checking for hidraw Node while Virtual Device Starts
+#define UHID_START_CHECK_INTERVAL_USEC	10000
+
+/***************************************************
+ * Global Variables Declaration
+ ***************************************************/
+
+/*
+ * Report Descriptor of Virtual Device (Vendor-defined, so hid-generic Binds & Creates hidraw)
+ * Report ID 0x01: Finger Report, Input, 64 Bytes
+ * Report ID 0x02: Vendor Input Report (Command Response), 64 Bytes
+ * Report ID 0x03: Vendor Output Report (Command), 32 Bytes
+ */
+static const unsigned char g_uhid_report_descriptor[] =
+{
+    0x06, 0x00, 0xFF,	// Usage Page (Vendor Defined 0xFF00)
+    0x09, 0x01,			// Usage (0x01)
+    0xA1, 0x01,			// Collection (Application)
+    0x15, 0x00,			//   Logical Minimum (0)
+    0x26, 0xFF, 0x00,	//   Logical Maximum (255)
+    0x75, 0x08,			//   Report Size (8)
+    0x85, 0x01,			//   Report ID (0x01)
+    0x09, 0x01,			//   Usage (0x01)
+    0x95, 0x40,			//   Report Count (64)
+    0x81, 0x02,			//   Input (Data, Variable, Absolute)
+    0x85, 0x02,			//   Report ID (0x02)
+    0x09, 0x02,			//   Usage (0x02)
+    0x95, 0x40,			//   Report Count (64)
+    0x81, 0x02,			//   Input (Data, Variable, Absolute)
+    0x85, 0x03,			//   Report ID (0x03)
+    0x09, 0x03,			//   Usage (0x03)
+    0x95, 0x20,			//   Report Count (32)
+    0x91, 0x02,			//   Output (Data, Variable, Absolute)
+    0xC0				// End Collection
+};
+
+/***************************************************
+ * Function Prototype
+ ***************************************************/
+
+static int uhid_write_event(int fd, struct uhid_event *p_event);
+static int uhid_create_device(struct uhid_standin *p_standin, unsigned short pid);
+static void uhid_destroy_device(int fd);
+static int uhid_send_input(int fd, unsigned char *p_report, int report_len);
+static int uhid_handle_event(struct uhid_standin *p_standin);
+static int uhid_find_hidraw(struct uhid_standin *p_standin);
+static void *uhid_serve_routine(void *p_arg);
+
+/***************************************************
+ * Function Implements
+ ***************************************************/
+
+static int uhid_write_event(int fd, struct uhid_event *p_event)
+{
+    ssize_t len = 0;
+
+    len = write(fd, p_event, sizeof(*p_event));
+    if(len != (ssize_t)sizeof(*p_event))
+    {
+        ERROR_PRINTF("%s: Fail to Write uhid Event %u! errno=%d.\r\n", __func__, p_event->type, errno);
+        return TP_ERR_IO_ERROR;
+    }
+
+    return TP_SUCCESS;
+}
+
+static int uhid_create_device(struct uhid_standin *p_standin, unsigned short pid)
+{
+    struct uhid_event event;
+
+    memset(&event, 0, sizeof(event));
+    event.type = UHID_CREATE2;
+    snprintf((char *)event.u.create2.name, sizeof(event.u.create2.name), "ELAN uhid %04X:%04X", ELAN_USB_VID, pid);
+    snprintf((char *)event.u.create2.phys, sizeof(event.u.create2.phys), "%s", p_standin->phys);
+    event.u.create2.rd_size = sizeof(g_uhid_report_descriptor);
+    event.u.create2.bus = BUS_I2C;
+    event.u.create2.vendor = ELAN_USB_VID;
+    event.u.create2.product = pid;
+    memcpy(event.u.create2.rd_data, g_uhid_report_descriptor, sizeof(g_uhid_report_descriptor));
+
+    return uhid_write_event(p_standin->fd, &event);
+}
+
+static void uhid_destroy_device(int fd)
+{
+    struct uhid_event event;
+
+    memset(&event, 0, sizeof(event));
+    event.type = UHID_DESTROY;
+    uhid_write_event(fd, &event);
+
+    return;
+}
+
+static int uhid_send_input(int fd, unsigned char *p_report, int report_len)
+{
+    struct uhid_event event;
+
+    memset(&event, 0, sizeof(event));
+    event.type = UHID_INPUT2;
+    event.u.input2.size = report_len;
+    memcpy(event.u.input2.data, p_report, report_len);
+
+    return uhid_write_event(fd, &event);
+}
+
+// Read One Event from uhid & Answer It
+static int uhid_handle_event(struct uhid_standin *p_standin)
+{
+    int err = TP_SUCCESS;
+    ssize_t len = 0;
+    struct uhid_event event,
+                      reply;
+
+    memset(&event, 0, sizeof(event));
+    len = read(p_standin->fd, &event, sizeof(event));
+    if(len <= 0)
+    {
+        if((len < 0) && ((errno == EINTR) || (errno == EAGAIN)))
+            return TP_SUCCESS;
+        ERROR_PRINTF("%s: Fail to Read uhid Event! errno=%d.\r\n", __func__, errno);
+        return TP_ERR_IO_ERROR;
+    }
+
+    switch(event.type)
+    {
+        case UHID_START:
+            DEBUG_PRINTF("%s: UHID_START.\r\n", __func__);
+            p_standin->started = true;
+            break;
+
+        case UHID_STOP:
+            DEBUG_PRINTF("%s: UHID_STOP.\r\n", __func__);
+            p_standin->started = false;
+            break;
+
+        case UHID_OPEN:
+        case UHID_CLOSE:
+            DEBUG_PRINTF("%s: %s.\r\n", __func__, (event.type == UHID_OPEN) ? "UHID_OPEN" : "UHID_CLOSE");
+            break;
+
+        case UHID_OUTPUT: // hidraw write()
+            if(event.u.output.rtype != UHID_OUTPUT_REPORT)
+                break;
+            p_standin->output_reports++;
+            err = p_standin->p_simulator->WriteRawBytes(event.u.output.data, event.u.output.size);
+            break;
+
+        case UHID_GET_REPORT: // Feature Reports Not Supported, Fail Fast instead of Kernel Timeout
+            memset(&reply, 0, sizeof(reply));
+            reply.type = UHID_GET_REPORT_REPLY;
+            reply.u.get_report_reply.id = event.u.get_report.id;
+            reply.u.get_report_reply.err = EIO;
+            err = uhid_write_event(p_standin->fd, &reply);
+            break;
+
+        case UHID_SET_REPORT:
+            memset(&reply, 0, sizeof(reply));
+            reply.type = UHID_SET_REPORT_REPLY;
+            reply.u.set_report_reply.id = event.u.set_report.id;
+            reply.u.set_report_reply.err = EIO;
+            err = uhid_write_event(p_standin->fd, &reply);
+            break;
+
+        default:
+            DEBUG_PRINTF("%s: Ignore uhid Event %u.\r\n", __func__, event.type);
+            break;
+    }
+
+    return err;
+}
+
+// Locate hidraw Node of Virtual Device by HID_PHYS
+static int uhid_find_hidraw(struct uhid_standin *p_standin)
+{
+    int err = TP_SUCCESS,
+        index = 0,
+        count = 0;
+    struct hid_dev_entry entry;
+
+    err = build_hid_dev_inventory(true);
+    if(err != TP_SUCCESS)
+        return err;
+
+    count = get_hid_dev_count();
+    for(index = 0; index < count; index++)
+    {
+        if(get_hid_dev_entry(index, &entry) != TP_SUCCESS)
+            continue;
+        if(strcmp(entry.phys, p_standin->phys) != 0)
+            continue;
+        if(access(entry.path, R_OK | W_OK) != 0)
+            continue;
+
+        snprintf(p_standin->hidraw_path, sizeof(p_standin->hidraw_path), "%s", entry.path);
+        return TP_SUCCESS;
+    }
+
+    return TP_ERR_NOT_FOUND_DEVICE;
+}
+
+// Server Thread: Deliver Reports of Simulated Controller at Their Ready Time & Answer uhid Events
+static void *uhid_serve_routine(void *p_arg)
+{
+    int err = TP_SUCCESS,
+        ret = 0;
+    struct uhid_standin *p_standin = (struct uhid_standin *)p_arg;
+    unsigned char report[ELAN_I2CHID_INPUT_BUFFER_SIZE] = {0};
+    unsigned long long ready_time_us = 0,
+                       now_us = 0,
+                       wait_us = 0;
+    struct pollfd poll_fd;
+    struct timespec timeout;
+
+    while(p_standin->stop == false)
+    {
+        // Reports Ready Now
+        wait_us = (unsigned long long)UHID_POLL_INTERVAL_MSEC * 1000ULL;
+        while((err = p_standin->p_simulator->TakeReport(report, sizeof(report), &ready_time_us)) == TP_SUCCESS)
+        {
+            if(uhid_send_input(p_standin->fd, report, sizeof(report)) != TP_SUCCESS)
+                goto UHID_SERVE_ROUTINE_EXIT;
+            p_standin->input_reports++;
+        }
+
+        // Wake up for Next Report in Flight
+        if(err == TP_ERR_TIMEOUT)
+        {
+            now_us = get_monotonic_time_us();
+            if(ready_time_us <= now_us)
+                wait_us = 0;
+            else if((ready_time_us - now_us) < wait_us)
+                wait_us = ready_time_us - now_us;
+        }
+
+        poll_fd.fd = p_standin->fd;
+        poll_fd.events = POLLIN;
+        poll_fd.revents = 0;
+        timeout.tv_sec = (time_t)(wait_us / 1000000ULL);
+        timeout.tv_nsec = (long)((wait_us % 1000000ULL) * 1000ULL);
+
+        ret = ppoll(&poll_fd, 1, &timeout, NULL);
+        if(ret < 0)
+        {
+            if(errno == EINTR)
+                continue;
+            ERROR_PRINTF("%s: Fail to Poll uhid! errno=%d.\r\n", __func__, errno);
+            break;
+        }
+        if(ret == 0)
+            continue;
+
+        if(poll_fd.revents & (POLLHUP | POLLERR))
+        {
+            ERROR_PRINTF("%s: uhid Closed (revents=0x%x)!\r\n", __func__, poll_fd.revents);
+            break;
+        }
+
+        if(uhid_handle_event(p_standin) != TP_SUCCESS)
+            break;
+    }
+
+UHID_SERVE_ROUTINE_EXIT:
+    DEBUG_PRINTF("%s: Stop (output_reports=%lu, input_reports=%lu).\r\n", __func__, p_standin->output_reports, p_standin->input_reports);
+    return NULL;
+}
+
+int uhid_standin_start(const char *p_config, struct uhid_standin *p_standin)
+{
+    int err = TP_SUCCESS;
+    structSimulatorConfig config;
+    unsigned long long start_time_us = 0;
+
+    memset(p_standin, 0, sizeof(*p_standin));
+    p_standin->fd = -1;
+
+    // Controller Model
+    p_standin->p_simulator = new CI2CHIDSimulatorGet();
+    err = p_standin->p_simulator->SetConfig(p_config);
+    if(err != TP_SUCCESS)
+    {
+        ERROR_PRINTF("%s: Invalid Simulator Config \"%s\"! err=0x%x.\r\n", __func__, p_config, err);
+        goto UHID_STANDIN_START_EXIT;
+    }
+    p_standin->p_simulator->GetConfig(&config);
+    p_standin->p_simulator->GetDeviceHandle(ELAN_USB_VID, ELAN_USB_FORCE_CONNECT_PID);
+
+    // Virtual Device
+    p_standin->fd = open(UHID_DEV_PATH, O_RDWR | O_CLOEXEC);
+    if(p_standin->fd < 0)
+    {
+        ERROR_PRINTF("%s: Fail to Open %s! errno=%d.\r\n", __func__, UHID_DEV_PATH, errno);
+        err = TP_ERR_NOT_FOUND_DEVICE;
+        goto UHID_STANDIN_START_EXIT;
+    }
+
+    snprintf(p_standin->phys, sizeof(p_standin->phys), "elan-uhid/%d", (int)getpid());
+    err = uhid_create_device(p_standin, config.usPID);
+    if(err != TP_SUCCESS)
+        goto UHID_STANDIN_START_EXIT;
+    DEBUG_PRINTF("%s: Create Virtual Device (VID 0x%04x, PID 0x%04x, phys \"%s\").\r\n", __func__, ELAN_USB_VID, config.usPID, p_standin->phys);
+
+    if(pthread_create(&p_standin->thread, NULL, uhid_serve_routine, p_standin) != 0)
+    {
+        ERROR_PRINTF("%s: Fail to Create Server Thread!\r\n", __func__);
+        err = TP_ERR_IO_ERROR;
+        goto UHID_STANDIN_START_EXIT;
+    }
+    p_standin->thread_created = true;
+
+    // Wait for hidraw Node (Created after HID Driver Bound, Device Node Made by devtmpfs / udev)
+    start_time_us = get_monotonic_time_us();
+    while(true)
+    {
+        if((p_standin->started == true) && (uhid_find_hidraw(p_standin) == TP_SUCCESS))
+            break;
+
+        if(get_elapsed_time_us(start_time_us) > ((unsigned long long)UHID_START_TIMEOUT_MSEC * 1000ULL))
+        {
+            ERROR_PRINTF("%s: hidraw Node of Virtual Device Not Found in %d ms!\r\n", __func__, UHID_START_TIMEOUT_MSEC);
+            err = TP_ERR_NOT_FOUND_DEVICE;
+            goto UHID_STANDIN_START_EXIT;
+        }
+        usleep(UHID_START_CHECK_INTERVAL_USEC);
+    }
+    DEBUG_PRINTF("%s: Virtual Device Ready at %s (%llu us).\r\n", __func__, p_standin->hidraw_path, get_elapsed_time_us(start_time_us));
+
+    // Success
+    err = TP_SUCCESS;
+
+UHID_STANDIN_START_EXIT:
+    if(err != TP_SUCCESS)
+        uhid_standin_stop(p_standin);
+    return err;
+}
+
+void uhid_standin_stop(struct uhid_standin *p_standin)
+{
+    if(p_standin->thread_created == true)
+    {
+        p_standin->stop = true;
+        pthread_join(p_standin->thread, NULL);
+        p_standin->thread_created = false;
+    }
+
+    if(p_standin->fd >= 0)
+    {
+        uhid_destroy_device(p_standin->fd);
+        close(p_standin->fd);
+        p_standin->fd = -1;
+    }
+
+    if(p_standin->p_simulator != NULL)
+    {
+        p_standin->p_simulator->Close();
+        delete p_standin->p_simulator;
+        p_standin->p_simulator = NULL;
+    }
+
+    return;
+}
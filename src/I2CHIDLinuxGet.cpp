@@ -9,11 +9,15 @@
 #include <linux/hidraw.h>	// hidraw
 #include <linux/input.h>	// BUS_TYPE
 #include <errno.h>			// errno
+#include <poll.h>			// poll
 // Debug Utility
 #ifdef _WIN32 // Windows 32-bit Platform
 #include "win32_debug_utility.h"
 #endif // Debug Utility
 #include "I2CHIDLinuxGet.h"
+#include "ElanTsTimeUtility.h"
+#include "ElanTsHidDevUtility.h"
+#include "ElanTsProfileUtility.h"
 
 /////////////////////////////////////////////////////////////////////////////
 // CI2CHIDLinuxGet::CI2CHIDGetLinux()
@@ -30,7 +34,26 @@ CI2CHIDLinuxGet::CI2CHIDLinuxGet(char *pszLogDirPath, char *pszDebugLogFileName)
     m_nHidrawFd = -1;
 
     // Initialize file descriptor monitor
-    memset(&m_tvRead, 0, sizeof(struct timeval));
+    m_pfdHidraw.fd = -1;
+    m_pfdHidraw.events = 0;
+    m_pfdHidraw.revents = 0;
+
+    // Initialize read deadline & latency
+    m_ullReadDeadlineUS = 0;
+    m_ullLastReadLatencyUS = 0;
+
+    // Initialize input report ring & report statistics
+    memset(m_szInputReportRing, 0, sizeof(m_szInputReportRing));
+    m_nInputReportRingHead = 0;
+    m_nInputReportRingCount = 0;
+    m_ulCommandReportCount = 0;
+    m_ulInputReportCount = 0;
+    m_ulDroppedReportCount = 0;
+    m_ulUnknownReportCount = 0;
+    m_ulDiscardedReportCount = 0;
+
+    // Initialize HID transaction trace
+    memset(&m_traceWriter, 0, sizeof(m_traceWriter));
 
     // Assign initial values to chip data
     m_usVID = 0;
@@ -58,6 +81,14 @@ CI2CHIDLinuxGet::CI2CHIDLinuxGet(char *pszLogDirPath, char *pszDebugLogFileName)
     m_outBuf = (unsigned char*)malloc(sizeof(unsigned char) * m_outBufSize);
     memset(m_outBuf, 0, sizeof(unsigned char)*m_outBufSize);
 
+    // Allocate cache line aligned memory to report slots
+    m_pReportSlots = NULL;
+    memset(m_bReportSlotInUse, 0, sizeof(m_bReportSlotInUse));
+    if (posix_memalign((void **)&m_pReportSlots, ELAN_HID_REPORT_SLOT_ALIGN, ELAN_HID_REPORT_SLOT_COUNT * ELAN_HID_REPORT_SLOT_STRIDE) != 0)
+        m_pReportSlots = NULL;
+    else
+        memset(m_pReportSlots, 0, ELAN_HID_REPORT_SLOT_COUNT * ELAN_HID_REPORT_SLOT_STRIDE);
+
     return;
 }
 
@@ -69,6 +100,9 @@ CI2CHIDLinuxGet::CI2CHIDLinuxGet(char *pszLogDirPath, char *pszDebugLogFileName)
 
 CI2CHIDLinuxGet::~CI2CHIDLinuxGet(void)
 {
+    // Flush HID transaction trace
+    StopTrace();
+
     // Deinitialize mutex (semaphore)
     sem_destroy(&m_ioMutex);
 
@@ -90,6 +124,13 @@ CI2CHIDLinuxGet::~CI2CHIDLinuxGet(void)
         m_outBufSize    = 0;
     }
 
+    // Release report slots (views still held are invalid from now on)
+    if (m_pReportSlots)
+    {
+        free(m_pReportSlots);
+        m_pReportSlots  = NULL;
+    }
+
     // Clear Chip Data
     m_usVID = 0;
     m_usPID = 0;
@@ -112,6 +153,10 @@ void CI2CHIDLinuxGet::Close(void)
         DBG("%s: Release hidraw device handle (fd=%d).", __func__, m_nHidrawFd);
         close(m_nHidrawFd);
         m_nHidrawFd = -1;
+
+        // Unregister hidraw device handler from file descriptor monitor
+        m_pfdHidraw.fd = -1;
+        m_pfdHidraw.events = 0;
     }
 
     return;
@@ -151,19 +196,64 @@ int CI2CHIDLinuxGet::GetDeviceHandle(int nVID, int nPID)
     }
 
     // Acquire hidraw device handler for I/O
-    nError = open(szHidrawDevPath, O_RDWR | O_NONBLOCK);
+    nRet = OpenHidrawDevice(szHidrawDevPath);
+
+GET_DEVICE_HANDLE_EXIT:
+    return nRet;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDLinuxGet::GetDeviceHandleByPath()
+// Open hidraw device node already identified (ex: from HID device inventory),
+// so several touch controllers with the same VID & PID can be opened at once.
+
+int CI2CHIDLinuxGet::GetDeviceHandleByPath(const char *pszDevicePath, int nVID, int nPID)
+{
+    int nRet = TP_SUCCESS;
+
+    if (pszDevicePath == NULL)
+    {
+        ERR("%s: NULL Device Path!", __func__);
+        nRet = TP_ERR_INVALID_PARAM;
+        goto GET_DEVICE_HANDLE_BY_PATH_EXIT;
+    }
+
+    m_usVID = (unsigned short) nVID;
+    m_usPID = (unsigned short) nPID;
+
+    nRet = OpenHidrawDevice(pszDevicePath);
+
+GET_DEVICE_HANDLE_BY_PATH_EXIT:
+    return nRet;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDLinuxGet::OpenHidrawDevice()
+// Acquire hidraw device handler for I/O
+
+int CI2CHIDLinuxGet::OpenHidrawDevice(const char *pszDevicePath)
+{
+    int nRet = TP_SUCCESS,
+        nError = 0;
+
+    nError = open(pszDevicePath, O_RDWR | O_NONBLOCK);
     if (nError < 0)
     {
-        ERR("%s: Fail to Open Device %s! errno=%d.", __func__, szHidrawDevPath, nError);
+        ERR("%s: Fail to Open Device %s! errno=%d.", __func__, pszDevicePath, nError);
         nRet = TP_ERR_NOT_FOUND_DEVICE;
-        goto GET_DEVICE_HANDLE_EXIT;
+        goto OPEN_HIDRAW_DEVICE_EXIT;
     }
 
     // Success
     m_nHidrawFd = nError;
-    DBG("%s: Open hidraw device \'%s\' (non-blocking), fd=%d.", __func__, szHidrawDevPath, m_nHidrawFd);
+    DBG("%s: Open hidraw device \'%s\' (non-blocking), fd=%d.", __func__, pszDevicePath, m_nHidrawFd);
 
-GET_DEVICE_HANDLE_EXIT:
+    // Register hidraw device handler to file descriptor monitor once for all reads
+    m_pfdHidraw.fd = m_nHidrawFd;
+    m_pfdHidraw.events = POLLIN;
+    m_pfdHidraw.revents = 0;
+
+OPEN_HIDRAW_DEVICE_EXIT:
     return nRet;
 }
 
@@ -196,6 +286,9 @@ int CI2CHIDLinuxGet::WriteRawBytes(unsigned char* pszBuf, int nLen, int nTimeout
         nResult = 0,
         nPollIndex = 0,
         nPollCount = 0;
+#ifdef __ENABLE_PROFILE__
+    unsigned long long ullProfileStartUS = get_monotonic_time_us();
+#endif //__ENABLE_PROFILE__
 
     nPollCount = nTimeout;
 
@@ -214,7 +307,7 @@ int CI2CHIDLinuxGet::WriteRawBytes(unsigned char* pszBuf, int nLen, int nTimeout
     memcpy(m_outBuf, pszBuf, ((unsigned)nLen <= m_outBufSize) ? nLen : m_outBufSize);
 
 #if defined(__ENABLE_DEBUG__) && defined(__ENABLE_OUTBUF_DEBUG__)
-    if ((g_bEnableDebug == true) && (g_bEnableOutputBufferDebug == true))
+    if (ELAN_LOG_ENABLED(ELAN_LOG_LEVEL_TRACE, LOG_SINK_ENABLED && (g_bEnableDebug == true) && (g_bEnableOutputBufferDebug == true)))
         DebugPrintBuffer("m_outBuf", m_outBuf, nLen);
 #endif //__ENABLE_DEBUG__ && __ENABLE_OUTBUF_DEBUG__
 
@@ -241,10 +334,16 @@ int CI2CHIDLinuxGet::WriteRawBytes(unsigned char* pszBuf, int nLen, int nTimeout
         }
     }
 
+    if (nRet == TP_SUCCESS)
+        TraceReport(TRACE_DIRECTION_OUT, m_outBuf, m_outBufSize);
+
     // Mutex unlocks the critical section
     sem_post(&m_ioMutex);
 
 WRITE_RAW_BYTES_EXIT:
+#ifdef __ENABLE_PROFILE__
+    profile_record_io(PROFILE_IO_WRITE, get_elapsed_time_us(ullProfileStartUS), nRet, (nPollIndex < nPollCount) ? nPollIndex : (nPollCount - 1));
+#endif //__ENABLE_PROFILE__
     return nRet;
 }
 
@@ -283,6 +382,75 @@ int CI2CHIDLinuxGet::WriteCommand(unsigned char* pszCommandBuf, int nCommandLen,
     return nRet;
 }
 
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDLinuxGet::WaitForInputReport()
+// Wait until input report of hidraw device is available
+// nTimeout: Time to wait for device respond
+// The wait ends at the earlier of (now + nTimeout) and the read deadline
+// set by SetReadDeadline(). Both are absolute CLOCK_MONOTONIC times, so the
+// remaining time is recomputed when poll() is interrupted by a signal.
+// Caller must hold m_ioMutex.
+
+int CI2CHIDLinuxGet::WaitForInputReport(int nTimeout)
+{
+    int nRet = TP_SUCCESS,
+        nError = 0,
+        nPollTimeout = 0;
+    unsigned long long ullStartTimeUS = 0,
+                       ullNowTimeUS = 0,
+                       ullDeadlineUS = 0;
+
+    // Absolute deadline of this read
+    ullStartTimeUS = get_monotonic_time_us();
+    ullDeadlineUS = ullStartTimeUS + ((unsigned long long)((nTimeout > 0) ? nTimeout : 0) * 1000ULL);
+    if ((m_ullReadDeadlineUS != 0) && (m_ullReadDeadlineUS < ullDeadlineUS))
+        ullDeadlineUS = m_ullReadDeadlineUS;
+
+    while (true)
+    {
+        // Remaining time (rounded up to millisecond so poll never returns before deadline)
+        ullNowTimeUS = get_monotonic_time_us();
+        if (ullNowTimeUS >= ullDeadlineUS)
+            nPollTimeout = 0;
+        else
+            nPollTimeout = (int)((ullDeadlineUS - ullNowTimeUS + 999ULL) / 1000ULL);
+
+        m_pfdHidraw.revents = 0;
+        nError = poll(&m_pfdHidraw, 1, nPollTimeout);
+        if (nError < 0)
+        {
+            if (errno == EINTR) // Interrupted by signal, wait for the rest of time
+                continue;
+
+            ERR("%s: File descriptor monitor poll fail! errno=%d.", __func__, errno);
+            nRet = TP_ERR_IO_ERROR;
+            break;
+        }
+        else if (nError == 0)
+        {
+            TRACE("%s: timeout (%d ms, waited %llu us)!", __func__, nTimeout, get_elapsed_time_us(ullStartTimeUS));
+            nRet = TP_ERR_TIMEOUT; // Timeout error
+            break;
+        }
+        else if (m_pfdHidraw.revents & (POLLERR | POLLHUP | POLLNVAL))
+        {
+            ERR("%s: hidraw device error! revents=0x%x.", __func__, m_pfdHidraw.revents);
+            nRet = TP_ERR_IO_ERROR;
+            break;
+        }
+        else // Input report available
+        {
+            nRet = TP_SUCCESS;
+            break;
+        }
+    }
+
+    // Record actual response time of device
+    m_ullLastReadLatencyUS = get_elapsed_time_us(ullStartTimeUS);
+
+    return nRet;
+}
+
 /////////////////////////////////////////////////////////////////////////////
 // CI2CHIDLinuxGet::ReadRawBytes()
 // Read Data from HID device
@@ -292,71 +460,168 @@ int CI2CHIDLinuxGet::WriteCommand(unsigned char* pszCommandBuf, int nCommandLen,
 int CI2CHIDLinuxGet::ReadRawBytes(unsigned char* pszBuf, int nLen, int nTimeout, int nDevIdx)
 {
     int nRet = TP_SUCCESS,
-        nError = 0;
+        nReportLen = 0;
+#ifdef __ENABLE_PROFILE__
+    unsigned long long ullProfileStartUS = get_monotonic_time_us();
+#endif //__ENABLE_PROFILE__
 
     // Mutex locks the critical section
     sem_wait(&m_ioMutex);
 
-    // Re-initialize file descriptor monitor
-    FD_ZERO(&m_fdsHidraw);
+    // Receive Input Report until timeout or read deadline
+    nRet = ReceiveReport(m_inBuf, nTimeout, &nReportLen);
+    if (nRet != TP_SUCCESS)
+        goto READ_RAW_BYTES_EXIT;
+    TraceReport(TRACE_DIRECTION_IN, m_inBuf, nReportLen);
+
+    //DBG("Successfully read %d bytes of data from device, return %d.", transfer_cnt, ret);
+
+#if defined(__ENABLE_DEBUG__) && defined(__ENABLE_INBUF_DEBUG__)
+    if (ELAN_LOG_ENABLED(ELAN_LOG_LEVEL_TRACE, LOG_SINK_ENABLED && g_bEnableDebug))
+        DebugPrintBuffer("m_inBuf", m_inBuf, nLen);
+#endif //__ENABLE_DEBUG__ && __ENABLE_INBUF_DEBUG__
 
-    // Add hidraw device handler to file descriptor monitor
-    FD_SET(m_nHidrawFd, &m_fdsHidraw);
+    // Copy inBuf data to input buffer pointer
+    memcpy(pszBuf, m_inBuf, ((unsigned)nLen <= m_inBufSize) ? nLen : m_inBufSize);
 
-    // Set wait time up to nTimeout millisecond
-    m_tvRead.tv_sec = nTimeout / 1000; // sec
-    m_tvRead.tv_usec = (nTimeout % 1000) * 1000; // usec
+READ_RAW_BYTES_EXIT:
+    // Mutex unlocks the critical section
+    sem_post(&m_ioMutex);
+
+#ifdef __ENABLE_PROFILE__
+    profile_record_io(PROFILE_IO_READ, get_elapsed_time_us(ullProfileStartUS), nRet, 0);
+#endif //__ENABLE_PROFILE__
+    return nRet;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDLinuxGet::ReceiveReport()
+// Wait for input report and read it straight into pszReport (m_inBufSize bytes,
+// bytes after a short report are cleared). Transport of subclass replaces this only.
+// pnReportLen: Bytes received
+// Caller must hold m_ioMutex.
+
+int CI2CHIDLinuxGet::ReceiveReport(unsigned char* pszReport, int nTimeout, int* pnReportLen)
+{
+    int nRet = TP_SUCCESS,
+        nError = 0;
+
+    // Wait for input report until timeout or read deadline
+    nRet = WaitForInputReport(nTimeout);
+    if (nRet != TP_SUCCESS)
+        goto RECEIVE_REPORT_EXIT;
 
-    // Add file descriptor & timeout to file descriptor monitor
-    nError = select(m_nHidrawFd + 1, &m_fdsHidraw, NULL, NULL, &m_tvRead);
+    // Read Input Report
+    nError = read(m_nHidrawFd, pszReport, m_inBufSize);
     if (nError < 0)
     {
-        ERR("%s: File descriptor monitor select fail! errno=%d.", __func__, nError);
+        ERR("%s: Fail to Read Data! errno=%d.", __func__, errno);
         nRet = TP_ERR_IO_ERROR;
-        goto READ_RAW_BYTES_EXIT;
-    }
-    else if (nError == 0)
-    {
-        DBG("%s: timeout (%d ms)!", __func__, nTimeout);
-        nRet = TP_ERR_TIMEOUT; // Timeout error
-        goto READ_RAW_BYTES_EXIT;
+        goto RECEIVE_REPORT_EXIT;
     }
-    else // Read Successfully
-    {
-        memset(m_inBuf, 0, sizeof(unsigned char)*m_inBufSize);
+    if ((unsigned)nError < m_inBufSize)
+        memset(&pszReport[nError], 0, m_inBufSize - nError);
 
-        if (FD_ISSET(m_nHidrawFd, &m_fdsHidraw))
-        {
-            nError = read(m_nHidrawFd, m_inBuf, m_inBufSize);
-            if (nError < 0)
-            {
-                ERR("%s: Fail to Read Data! errno=%d.", __func__, nError);
-                nRet = TP_ERR_IO_ERROR;
-                goto READ_RAW_BYTES_EXIT;
-            }
+    *pnReportLen = nError;
+    nRet = TP_SUCCESS;
 
-            //DBG("Succesfully read %d bytes.\n", nError);
-            nRet = TP_SUCCESS;
+RECEIVE_REPORT_EXIT:
+    return nRet;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDLinuxGet::ReadReportView()
+// Read input report straight into a report slot of interface, without copy.
+// ppszReport: View of whole report (report ID included), valid until ReleaseReportView()
+// pnReportLen: Bytes received
+// Return TP_ERR_DEVICE_BUSY if all slots are still held by caller.
+
+int CI2CHIDLinuxGet::ReadReportView(const unsigned char** ppszReport, int* pnReportLen, int nTimeout, int nDevIdx)
+{
+    int nRet = TP_SUCCESS,
+        nSlot = 0,
+        nReportLen = 0;
+    unsigned char *pszSlot = NULL;
+#ifdef __ENABLE_PROFILE__
+    unsigned long long ullProfileStartUS = get_monotonic_time_us();
+#endif //__ENABLE_PROFILE__
+
+    if ((ppszReport == NULL) || (pnReportLen == NULL))
+        return TP_ERR_INVALID_PARAM;
+    *ppszReport = NULL;
+    *pnReportLen = 0;
+
+    // Mutex locks the critical section
+    sem_wait(&m_ioMutex);
+
+    // Take a free slot
+    for (nSlot = 0; (m_pReportSlots != NULL) && (nSlot < ELAN_HID_REPORT_SLOT_COUNT); nSlot++)
+    {
+        if (m_bReportSlotInUse[nSlot] == false)
+        {
+            pszSlot = &m_pReportSlots[nSlot * ELAN_HID_REPORT_SLOT_STRIDE];
+            break;
         }
     }
+    if (pszSlot == NULL)
+    {
+        ERR("%s: No free report slot (%d views not released)!", __func__, ELAN_HID_REPORT_SLOT_COUNT);
+        nRet = TP_ERR_DEVICE_BUSY;
+        goto READ_REPORT_VIEW_EXIT;
+    }
 
-    //DBG("Successfully read %d bytes of data from device, return %d.", transfer_cnt, ret);
+    // Receive Input Report until timeout or read deadline
+    nRet = ReceiveReport(pszSlot, nTimeout, &nReportLen);
+    if (nRet != TP_SUCCESS)
+        goto READ_REPORT_VIEW_EXIT;
+    TraceReport(TRACE_DIRECTION_IN, pszSlot, nReportLen);
 
 #if defined(__ENABLE_DEBUG__) && defined(__ENABLE_INBUF_DEBUG__)
-    if (g_bEnableDebug)
-        DebugPrintBuffer("m_inBuf", m_inBuf, nLen);
+    if (ELAN_LOG_ENABLED(ELAN_LOG_LEVEL_TRACE, LOG_SINK_ENABLED && g_bEnableDebug))
+        DebugPrintBuffer("pszSlot", pszSlot, nReportLen);
 #endif //__ENABLE_DEBUG__ && __ENABLE_INBUF_DEBUG__
 
-    // Copy inBuf data to input buffer pointer
-    memcpy(pszBuf, m_inBuf, ((unsigned)nLen <= m_inBufSize) ? nLen : m_inBufSize);
+    m_bReportSlotInUse[nSlot] = true;
+    *ppszReport = pszSlot;
+    *pnReportLen = nReportLen;
 
-READ_RAW_BYTES_EXIT:
+READ_REPORT_VIEW_EXIT:
     // Mutex unlocks the critical section
     sem_post(&m_ioMutex);
 
+#ifdef __ENABLE_PROFILE__
+    if (pszSlot != NULL)
+        profile_record_io(PROFILE_IO_READ, get_elapsed_time_us(ullProfileStartUS), nRet, 0);
+#endif //__ENABLE_PROFILE__
     return nRet;
 }
 
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDLinuxGet::ReleaseReportView()
+// Return report slot of a view taken by ReadReportView() / ReadDataView()
+// pszView: Any pointer into the view (NULL is ignored)
+
+void CI2CHIDLinuxGet::ReleaseReportView(const unsigned char* pszView)
+{
+    int nSlot = 0;
+
+    if ((pszView == NULL) || (m_pReportSlots == NULL) || (pszView < m_pReportSlots) || \
+        (pszView >= &m_pReportSlots[ELAN_HID_REPORT_SLOT_COUNT * ELAN_HID_REPORT_SLOT_STRIDE]))
+        return;
+
+    nSlot = (int)((pszView - m_pReportSlots) / ELAN_HID_REPORT_SLOT_STRIDE);
+
+    // Mutex locks the critical section
+    sem_wait(&m_ioMutex);
+
+    m_bReportSlotInUse[nSlot] = false;
+
+    // Mutex unlocks the critical section
+    sem_post(&m_ioMutex);
+
+    return;
+}
+
 // Modify by Johnny 20171123
 int CI2CHIDLinuxGet::ReadGhostRawBytes(unsigned char* pszBuf, int nLen, int nTimeout, int nDevIdx)
 {
@@ -368,53 +633,28 @@ int CI2CHIDLinuxGet::ReadGhostRawBytes(unsigned char* pszBuf, int nLen, int nTim
     // Mutex locks the critical section
     sem_wait(&m_ioMutex);
 
-    // Re-initialize file descriptor monitor
-    FD_ZERO(&m_fdsHidraw);
-
-    // Add hidraw device handler to file descriptor monitor
-    FD_SET(m_nHidrawFd, &m_fdsHidraw);
-
-    // Set wait time up to nTimeout millisecond
-    m_tvRead.tv_sec = nTimeout / 1000; // sec
-    m_tvRead.tv_usec = (nTimeout % 1000) * 1000; // usec
+    // Wait for input report until timeout or read deadline
+    nRet = WaitForInputReport(nTimeout);
+    if (nRet != TP_SUCCESS)
+        goto READ_RAW_BYTES_EXIT;
 
-    // Add file descriptor & timeout to file descriptor monitor
-    nError = select(m_nHidrawFd + 1, &m_fdsHidraw, NULL, NULL, &m_tvRead);
+    // Read Input Report
+    memset(m_inBuf, 0, sizeof(unsigned char)*m_inBufSize);
+    nError = read(m_nHidrawFd, m_inBuf, m_inBufSize);
     if (nError < 0)
     {
-        ERR("%s: File descriptor monitor select fail! errno=%d.", __func__, nError);
+        ERR("%s: Fail to Read Data! errno=%d.", __func__, errno);
         nRet = TP_ERR_IO_ERROR;
         goto READ_RAW_BYTES_EXIT;
     }
-    else if (nError == 0)
-    {
-        DBG("%s: timeout (%d ms)!", __func__, nTimeout);
-        nRet = TP_ERR_TIMEOUT; // Timeout error
-        goto READ_RAW_BYTES_EXIT;
-    }
-    else // Read Successfully
-    {
-        memset(m_inBuf, 0, sizeof(unsigned char)*m_inBufSize);
-
-        if (FD_ISSET(m_nHidrawFd, &m_fdsHidraw))
-        {
-            nError = read(m_nHidrawFd, m_inBuf, m_inBufSize);
-            if (nError < 0)
-            {
-                ERR("%s: Fail to Read Data! errno=%d.", __func__, nError);
-                nRet = TP_ERR_IO_ERROR;
-                goto READ_RAW_BYTES_EXIT;
-            }
 
-            //DBG("Succesfully read %d bytes.\n", nError);
-            nRet = TP_SUCCESS;
-        }
-    }
+    //DBG("Succesfully read %d bytes.\n", nError);
+    nRet = TP_SUCCESS;
 
     //DBG("Successfully read %d bytes of data from device, return %d.", transfer_cnt, ret);
 
 #ifdef __ENABLE_DEBUG__
-    if (g_bEnableDebug)
+    if (ELAN_LOG_ENABLED(ELAN_LOG_LEVEL_TRACE, LOG_SINK_ENABLED && g_bEnableDebug))
         DebugPrintBuffer("m_inBuf", m_inBuf, nLen);
 #endif //__ENABLE_DEBUG__
 
@@ -437,53 +677,106 @@ READ_RAW_BYTES_EXIT:
 
 int CI2CHIDLinuxGet::ReadData(unsigned char* pszDataBuf, int nDataLen, int nTimeout, int nDevIdx, bool bFilter)
 {
-    int nRet = TP_SUCCESS,
-        nReportID = 0;
-
-    // Clear Data Raw Buffer
-    memset(m_szInputBuf, 0, sizeof(m_szInputBuf));
+    int nRet = TP_SUCCESS;
+    const unsigned char *pszData = NULL;
 
-    // Read 2-Byte Header & Command Data to Data Raw Buffer
-    nRet = ReadRawBytes(m_szInputBuf, nDataLen + 2, nTimeout, nDevIdx);
-    if (nRet == TP_ERR_TIMEOUT)
-    {
-        DBG("%s: Fail to Read Raw Bytes! err=0x%x.", __func__, nRet);
+    // Command response stays in report slot, only requested data is copied
+    nRet = ReadDataView(&pszData, nDataLen, nTimeout, nDevIdx, bFilter);
+    if (nRet != TP_SUCCESS)
         goto READ_DATA_EXIT;
-    }
-    else if (nRet != TP_SUCCESS)
+
+    memcpy(pszDataBuf, pszData, nDataLen);
+    ReleaseReportView(pszData);
+
+READ_DATA_EXIT:
+    return nRet;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDLinuxGet::ReadDataView()
+// Read command response without copy, finger / pen reports are routed away
+// ppszData: View of response data (2-byte report header stripped if bFilter), valid until ReleaseReportView()
+// nDataLen: Data length to read
+// nTimeout: Time to wait for device respond
+
+int CI2CHIDLinuxGet::ReadDataView(const unsigned char** ppszData, int nDataLen, int nTimeout, int nDevIdx, bool bFilter)
+{
+    int nRet = TP_SUCCESS,
+        nReportClass = ELAN_HID_REPORT_CLASS_UNKNOWN,
+        nRemainTimeout = 0,
+        nReportLen = 0;
+    const unsigned char *pszReport = NULL;
+    unsigned long long ullNowTimeUS = 0,
+                       ullDeadlineUS = 0;
+
+    if ((ppszData == NULL) || (nDataLen < 0) || ((unsigned)(nDataLen + ((bFilter == true) ? 2 : 0)) > m_inBufSize))
     {
-        ERR("%s: Fail to Read Raw Bytes! err=0x%x.", __func__, nRet);
-        goto READ_DATA_EXIT;
+        ERR("%s: Invalid data (view=%p, len=%d, buffer size=%d)!", __func__, ppszData, nDataLen, m_inBufSize);
+        return TP_ERR_INVALID_PARAM;
     }
+    *ppszData = NULL;
 
-    // Set Report ID Number for Checking
-    if (m_usPID == 0xb)
-        nReportID = ELAN_HID_INPUT_REPORT_ID_PID_B; // HID Report ID
-    else
-        nReportID = ELAN_HID_INPUT_REPORT_ID; // HID Report ID
+    // One deadline for whole wait: time spent on parking finger / pen reports counts against it,
+    // so a stream of touch reports can not hold off the timeout of a lost command response
+    ullDeadlineUS = get_monotonic_time_us() + ((unsigned long long)((nTimeout > 0) ? nTimeout : 0) * 1000ULL);
 
-    // Check if Report ID of Packet is correct
-    if ((m_szInputBuf[0] != nReportID) &&
-        (m_szInputBuf[0] != ELAN_HID_FINGER_REPORT_ID) &&
-        (m_szInputBuf[0] != ELAN_HID_PEN_REPORT_ID)	 &&
-        (m_szInputBuf[0] != ELAN_HID_PEN_DEBUG_REPORT_ID))
+    while (true)
     {
-        nRet = TP_ERR_DATA_PATTERN;
-        goto READ_DATA_EXIT;
+        // Remaining time to wait for command response
+        ullNowTimeUS = get_monotonic_time_us();
+        if (ullNowTimeUS >= ullDeadlineUS)
+            nRemainTimeout = 0;
+        else
+            nRemainTimeout = (int)((ullDeadlineUS - ullNowTimeUS + 999ULL) / 1000ULL);
+
+        // Read Whole Report into Report Slot (Input Report Needs to be Kept Complete)
+        nRet = ReadReportView(&pszReport, &nReportLen, nRemainTimeout, nDevIdx);
+        if (nRet == TP_ERR_TIMEOUT)
+        {
+            DBG("%s: Fail to Read Raw Bytes! err=0x%x.", __func__, nRet);
+            goto READ_DATA_VIEW_EXIT;
+        }
+        else if (nRet != TP_SUCCESS)
+        {
+            ERR("%s: Fail to Read Raw Bytes! err=0x%x.", __func__, nRet);
+            goto READ_DATA_VIEW_EXIT;
+        }
+
+        // Route Report by Report ID & Response Header
+        nReportClass = ClassifyReport((unsigned char *)pszReport);
+        if (nReportClass == ELAN_HID_REPORT_CLASS_COMMAND_RESPONSE)
+        {
+            m_ulCommandReportCount++;
+            break;
+        }
+        else if (nReportClass == ELAN_HID_REPORT_CLASS_INPUT)
+        {
+            // Keep finger / pen report aside and wait for command response again
+            PushInputReport((unsigned char *)pszReport);
+            ReleaseReportView(pszReport);
+            continue;
+        }
+        else // ELAN_HID_REPORT_CLASS_UNKNOWN
+        {
+            m_ulUnknownReportCount++;
+            ReleaseReportView(pszReport);
+            nRet = TP_ERR_DATA_PATTERN;
+            goto READ_DATA_VIEW_EXIT;
+        }
     }
 
     if (bFilter == true)
     {
-        // Strip 2-Byte Report Header & Load Data to Buffer
-        memcpy(pszDataBuf, &m_szInputBuf[2], nDataLen);
+        // Strip 2-Byte Report Header
+        *ppszData = &pszReport[2];
     }
     else // if(bFilter == false)
     {
-        // Load Report Header & Data to Buffer
-        memcpy(pszDataBuf, m_szInputBuf, nDataLen);
+        // Report Header & Data
+        *ppszData = pszReport;
     }
 
-READ_DATA_EXIT:
+READ_DATA_VIEW_EXIT:
     return nRet;
 }
 
@@ -534,6 +827,269 @@ READ_DATA_EXIT:
     return nRet;
 }
 
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDLinuxGet::SetReadDeadline()
+// Set an absolute deadline shared by all following reads
+// nTimeoutMS: Overall time budget from now
+
+int CI2CHIDLinuxGet::SetReadDeadline(int nTimeoutMS)
+{
+    if (nTimeoutMS < 0)
+        return TP_ERR_INVALID_PARAM;
+
+    m_ullReadDeadlineUS = get_monotonic_time_us() + ((unsigned long long)nTimeoutMS * 1000ULL);
+
+    return TP_SUCCESS;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDLinuxGet::ClearReadDeadline()
+// Remove read deadline, each read is bounded by its own timeout only
+
+int CI2CHIDLinuxGet::ClearReadDeadline(void)
+{
+    m_ullReadDeadlineUS = 0;
+
+    return TP_SUCCESS;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDLinuxGet::GetLastReadLatency()
+// Return time waited for the last input report (in microsecond)
+
+int CI2CHIDLinuxGet::GetLastReadLatency(unsigned long long* p_ullLatencyUS)
+{
+    if (p_ullLatencyUS == NULL)
+        return TP_ERR_INVALID_PARAM;
+
+    *p_ullLatencyUS = m_ullLastReadLatencyUS;
+
+    return TP_SUCCESS;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDLinuxGet::ClassifyReport()
+// Classify incoming report by report ID
+// 1. Report with vendor input report ID is always command response.
+// 2. Finger / pen report is always input report (user touching the panel).
+//    Its payload is not looked at: contact ID / coordinates take any value,
+//    including the ones of response headers (0x52, 0x66, 0x95, 0x99, 0xAA).
+// pszReport: Whole report (report ID included)
+
+int CI2CHIDLinuxGet::ClassifyReport(unsigned char* pszReport)
+{
+    int nReportID = 0;
+
+    // Set Report ID Number for Checking
+    if (m_usPID == 0xb)
+        nReportID = ELAN_HID_INPUT_REPORT_ID_PID_B; // HID Report ID
+    else
+        nReportID = ELAN_HID_INPUT_REPORT_ID; // HID Report ID
+
+    if (pszReport[0] == nReportID)
+        return ELAN_HID_REPORT_CLASS_COMMAND_RESPONSE;
+
+    if ((pszReport[0] != ELAN_HID_FINGER_REPORT_ID) &&
+        (pszReport[0] != ELAN_HID_PEN_REPORT_ID) &&
+        (pszReport[0] != ELAN_HID_PEN_DEBUG_REPORT_ID))
+        return ELAN_HID_REPORT_CLASS_UNKNOWN;
+
+    return ELAN_HID_REPORT_CLASS_INPUT;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDLinuxGet::PushInputReport()
+// Keep input report in ring, the oldest one is dropped if ring is full
+// pszReport: Whole report (report ID included)
+
+void CI2CHIDLinuxGet::PushInputReport(unsigned char* pszReport)
+{
+    unsigned int nTail = 0;
+
+    if (m_nInputReportRingCount == (unsigned int)ELAN_HID_INPUT_REPORT_RING_SIZE)
+    {
+        // Drop the oldest report
+        m_nInputReportRingHead = (m_nInputReportRingHead + 1) % ELAN_HID_INPUT_REPORT_RING_SIZE;
+        m_nInputReportRingCount--;
+        m_ulDroppedReportCount++;
+    }
+
+    nTail = (m_nInputReportRingHead + m_nInputReportRingCount) % ELAN_HID_INPUT_REPORT_RING_SIZE;
+    memcpy(m_szInputReportRing[nTail], pszReport, ELAN_I2CHID_INPUT_BUFFER_SIZE);
+    m_nInputReportRingCount++;
+    m_ulInputReportCount++;
+
+    return;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDLinuxGet::PopInputReport()
+// Take the oldest input report received while waiting for command response
+// pszBuf: Buffer to store report (report ID included)
+// nBufLen: Buffer length
+// Return number of bytes copied, or 0 if no input report kept.
+
+int CI2CHIDLinuxGet::PopInputReport(unsigned char* pszBuf, int nBufLen)
+{
+    int nCopyLen = 0;
+
+    if ((pszBuf == NULL) || (nBufLen <= 0))
+        return TP_ERR_INVALID_PARAM;
+
+    if (m_nInputReportRingCount == 0)
+        return 0;
+
+    nCopyLen = (nBufLen < ELAN_I2CHID_INPUT_BUFFER_SIZE) ? nBufLen : ELAN_I2CHID_INPUT_BUFFER_SIZE;
+    memcpy(pszBuf, m_szInputReportRing[m_nInputReportRingHead], nCopyLen);
+    m_nInputReportRingHead = (m_nInputReportRingHead + 1) % ELAN_HID_INPUT_REPORT_RING_SIZE;
+    m_nInputReportRingCount--;
+
+    return nCopyLen;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDLinuxGet::DrainInputReports()
+// Empty kernel report queue with non-blocking reads before a command is sent,
+// so a stale hello packet or response is not taken as reply of the command.
+// Finger / pen reports are kept in input report ring, others are discarded.
+// p_ulDiscardedReports: Number of stale reports discarded (can be NULL)
+
+int CI2CHIDLinuxGet::DrainInputReports(unsigned long* p_ulDiscardedReports)
+{
+    int nRet = TP_SUCCESS,
+        nError = 0,
+        nReportIndex = 0;
+    unsigned long ulDiscarded = 0;
+
+    if (m_nHidrawFd < 0)
+        goto DRAIN_INPUT_REPORTS_EXIT;
+
+    // Mutex locks the critical section
+    sem_wait(&m_ioMutex);
+
+    for (nReportIndex = 0; nReportIndex < ELAN_HID_DRAIN_REPORT_MAX; nReportIndex++)
+    {
+        memset(m_inBuf, 0, sizeof(unsigned char)*m_inBufSize);
+
+        // hidraw device is opened with O_NONBLOCK, read returns EAGAIN if queue is empty
+        nError = read(m_nHidrawFd, m_inBuf, m_inBufSize);
+        if (nError < 0)
+        {
+            if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) // Queue is empty
+                break;
+            if (errno == EINTR)
+                continue;
+
+            ERR("%s: Fail to Read Data! errno=%d.", __func__, errno);
+            nRet = TP_ERR_IO_ERROR;
+            break;
+        }
+        TraceReport(TRACE_DIRECTION_IN, m_inBuf, nError);
+
+        if (ClassifyReport(m_inBuf) == ELAN_HID_REPORT_CLASS_INPUT)
+        {
+            PushInputReport(m_inBuf);
+        }
+        else
+        {
+            TRACE("%s: Discard stale report %02x %02x %02x %02x.", __func__, m_inBuf[0], m_inBuf[1], m_inBuf[2], m_inBuf[3]);
+            ulDiscarded++;
+        }
+    }
+
+    m_ulDiscardedReportCount += ulDiscarded;
+
+    // Mutex unlocks the critical section
+    sem_post(&m_ioMutex);
+
+DRAIN_INPUT_REPORTS_EXIT:
+    if (p_ulDiscardedReports != NULL)
+        *p_ulDiscardedReports = ulDiscarded;
+
+    return nRet;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDLinuxGet::StartTrace()
+// Record every output / input report from now on to binary trace file
+// (replayed later by CI2CHIDReplayGet). Call after device connected, so VID / PID are known.
+
+int CI2CHIDLinuxGet::StartTrace(const char *pszTraceFilePath)
+{
+    int nRet = TP_SUCCESS;
+
+    // Mutex locks the critical section
+    sem_wait(&m_ioMutex);
+
+    if (m_traceWriter.p_file != NULL)
+        trace_writer_close(&m_traceWriter);
+
+    nRet = trace_writer_open(pszTraceFilePath, m_usVID, m_usPID, &m_traceWriter);
+    if (nRet != TP_SUCCESS)
+    {
+        ERR("%s: Fail to start trace \"%s\"! err=0x%x.", __func__, pszTraceFilePath, nRet);
+    }
+
+    // Mutex unlocks the critical section
+    sem_post(&m_ioMutex);
+
+    return nRet;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDLinuxGet::StopTrace()
+// Flush & close trace file
+
+void CI2CHIDLinuxGet::StopTrace(void)
+{
+    // Mutex locks the critical section
+    sem_wait(&m_ioMutex);
+
+    trace_writer_close(&m_traceWriter);
+
+    // Mutex unlocks the critical section
+    sem_post(&m_ioMutex);
+
+    return;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDLinuxGet::TraceReport()
+// Append one report to trace file if tracing (timestamp taken now)
+// Caller must hold m_ioMutex.
+
+void CI2CHIDLinuxGet::TraceReport(TRACE_DIRECTION direction, unsigned char* pszReport, int nReportLen)
+{
+    if (m_traceWriter.p_file == NULL)
+        return;
+
+    if (trace_writer_append(&m_traceWriter, direction, get_monotonic_time_us(), pszReport, nReportLen) != TP_SUCCESS)
+    {
+        ERR("%s: Fail to write trace, stop tracing!", __func__);
+        trace_writer_close(&m_traceWriter);
+    }
+
+    return;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDLinuxGet::GetReportStatistics()
+// Return number of reports routed by ReadData() & DrainInputReports() since device object created
+
+int CI2CHIDLinuxGet::GetReportStatistics(unsigned long* p_ulCommandReports, unsigned long* p_ulInputReports, unsigned long* p_ulDroppedReports, unsigned long* p_ulUnknownReports, unsigned long* p_ulDiscardedReports)
+{
+    if ((p_ulCommandReports == NULL) || (p_ulInputReports == NULL) || (p_ulDroppedReports == NULL) || (p_ulUnknownReports == NULL) || (p_ulDiscardedReports == NULL))
+        return TP_ERR_INVALID_PARAM;
+
+    *p_ulCommandReports = m_ulCommandReportCount;
+    *p_ulInputReports = m_ulInputReportCount;
+    *p_ulDroppedReports = m_ulDroppedReportCount;
+    *p_ulUnknownReports = m_ulUnknownReportCount;
+    *p_ulDiscardedReports = m_ulDiscardedReportCount;
+
+    return TP_SUCCESS;
+}
+
 /////////////////////////////////////////////////////////////////////////////
 // CI2CHIDLinuxGet::GetDevVidPid()
 // Return Current VID & PID
@@ -642,14 +1198,12 @@ const char* CI2CHIDLinuxGet::bus_str(int bus)
 int CI2CHIDLinuxGet::FindHidrawDevice(int nVID, int nPID, char *pszDevicePath)
 {
     int nRet = TP_SUCCESS,
-        nError = 0,
-        nFd = 0;
+        nIndex = 0,
+        nCount = 0,
+        nPass = 0,
+        nMatchPID = 0;
     bool bFound = false;
-    DIR *pDirectory = NULL;
-    struct dirent *pDirEntry = NULL;
-    const char *pszPath = "/dev";
-    char szFile[64] = {0};
-    struct hidraw_devinfo info;
+    struct hid_dev_entry entry;
 
     // Check if filename ptr is valid
     if (pszDevicePath == NULL)
@@ -659,79 +1213,54 @@ int CI2CHIDLinuxGet::FindHidrawDevice(int nVID, int nPID, char *pszDevicePath)
         goto FIND_ELAN_HIDRAW_DEVICE_EXIT;
     }
 
-    // Open Directory
-    pDirectory = opendir(pszPath);
-    if (pDirectory == NULL)
-    {
-        ERR("%s: Fail to Open Directory %s.\r\n", __func__, pszPath);
-        nRet = TP_ERR_NOT_FOUND_DEVICE;
-        goto FIND_ELAN_HIDRAW_DEVICE_EXIT;
-    }
-
-    // Traverse Directory Elements
-    while ((pDirEntry = readdir(pDirectory)) != NULL)
+    // Look up Shared HID Device Inventory (Identity from sysfs, No Device Open).
+    // Rescan once if not found, since device may re-enumerate after mode switch.
+    for (nPass = 0; (nPass < 2) && (bFound == false); nPass++)
     {
-        // Only reserve hidraw devices
-        if (strncmp(pDirEntry->d_name, "hidraw", 6))
-            continue;
-
-        memset(szFile, 0, sizeof(szFile));
-        sprintf(szFile, "%s/%s", pszPath, pDirEntry->d_name);
-        DBG("%s: file=\"%s\".", __func__, szFile);
-
-        /* Open the Device with non-blocking reads. In real life,
-          don't use a hard coded path; use libudev instead. */
-        nError = open(szFile, O_RDWR | O_NONBLOCK);
-        if (nError < 0)
+        if (build_hid_dev_inventory(nPass != 0) != TP_SUCCESS)
         {
-            DBG("%s: Fail to Open Device %s! errno=%d.", __func__, pDirEntry->d_name, nError);
-            continue;
+            nRet = TP_ERR_NOT_FOUND_DEVICE;
+            goto FIND_ELAN_HIDRAW_DEVICE_EXIT;
         }
-        nFd = nError;
 
-        /* Get Raw Info */
-        nError = ioctl(nFd, HIDIOCGRAWINFO, &info);
-        if (nError >= 0)
+        nCount = get_hid_dev_count();
+        for (nIndex = 0; nIndex < nCount; nIndex++)
         {
+            if (get_hid_dev_entry(nIndex, &entry) != TP_SUCCESS)
+                break;
+            DBG("%s: file=\"%s\".", __func__, entry.path);
             DBG("--------------------------------");
-            DBG("  bustype: 0x%02x (%s)", info.bustype, bus_str(info.bustype));
-            DBG("  vendor: 0x%04hx", info.vendor);
-            DBG("  product: 0x%04hx", info.product);
+            DBG("  bustype: 0x%02x (%s)", entry.info.bustype, bus_str(entry.info.bustype));
+            DBG("  vendor: 0x%04hx", entry.info.vendor);
+            DBG("  product: 0x%04hx", entry.info.product);
+
+            nMatchPID = nPID;
 
             // Force touch device to connect if bustype=0x03(BUS_I2C), VID=0x4f3, and PID=0x0
-            if ((info.bustype == BUS_I2C) &&
-                (info.vendor == ELAN_USB_VID) /* nVID = usb_dev_desc.idVendor = ELAN_USB_VID */  &&
+            if ((entry.info.bustype == BUS_I2C) &&
+                ((unsigned short)entry.info.vendor == ELAN_USB_VID) /* nVID = usb_dev_desc.idVendor = ELAN_USB_VID */  &&
                 (nPID == ELAN_USB_FORCE_CONNECT_PID))
             {
                 // Use found PID from Hid-Raw
-                nPID = info.product;
-                DBG("%s: bustype=0x%02x, VID=0x%04x, PID=0x%04x => PID changes to 0x%04x.", __func__, BUS_I2C, ELAN_USB_VID, ELAN_USB_FORCE_CONNECT_PID, nPID);
+                nMatchPID = (unsigned short)entry.info.product;
+                DBG("%s: bustype=0x%02x, VID=0x%04x, PID=0x%04x => PID changes to 0x%04x.", __func__, BUS_I2C, ELAN_USB_VID, ELAN_USB_FORCE_CONNECT_PID, nMatchPID);
             }
 
-            if ((info.vendor == nVID) && (info.product == nPID))
+            if (((unsigned short)entry.info.vendor == nVID) && ((unsigned short)entry.info.product == nMatchPID))
             {
-                DBG("%s: Found hidraw device with VID 0x%x and PID 0x%x!", __func__, nVID, nPID);
+                DBG("%s: Found hidraw device with VID 0x%x and PID 0x%x!", __func__, nVID, nMatchPID);
                 m_usVID = (unsigned short) nVID;
-                m_usPID = (unsigned short) nPID;
-                memcpy(pszDevicePath, szFile, sizeof(szFile));
+                m_usPID = (unsigned short) nMatchPID;
+                memcpy(pszDevicePath, entry.path, sizeof(entry.path));
                 bFound = true;
+                break;
             }
         }
-
-        // Close Device
-        close(nFd);
-
-        // Stop the loop if found
-        if (bFound == true)
-            break;
     }
 
     if (!bFound)
         nRet = TP_ERR_NOT_FOUND_DEVICE;
 
-    // Close Directory
-    closedir(pDirectory);
-
 FIND_ELAN_HIDRAW_DEVICE_EXIT:
     return nRet;
 }
@@ -0,0 +1,166 @@
+// I2CHIDQueuedReportGet.cpp : implementation file
+//
+
+#include <time.h>			// clock_nanosleep
+#include <errno.h>			// errno
+#include "I2CHIDQueuedReportGet.h"
+#include "ElanTsTimeUtility.h"
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDQueuedReportGet::CI2CHIDQueuedReportGet()
+
+CI2CHIDQueuedReportGet::CI2CHIDQueuedReportGet(char *pszLogDirPath, char *pszDebugLogFileName) : CI2CHIDLinuxGet(pszLogDirPath, pszDebugLogFileName)
+{
+    m_bConnected = false;
+
+    return;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDQueuedReportGet::~CI2CHIDQueuedReportGet()
+
+CI2CHIDQueuedReportGet::~CI2CHIDQueuedReportGet(void)
+{
+    return;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDQueuedReportGet::IsConnected()
+// Check if device connected
+
+bool CI2CHIDQueuedReportGet::IsConnected(void)
+{
+    return m_bConnected;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDQueuedReportGet::ReceiveReport()
+// Wait for the next report of backend, taken straight into pszReport
+// The wait ends at the earlier of (now + nTimeout) and the read deadline
+// (scaled by ScaleWaitTime()), exactly as CI2CHIDLinuxGet::WaitForInputReport()
+// does on hidraw fd.
+// Caller must hold m_ioMutex.
+
+int CI2CHIDQueuedReportGet::ReceiveReport(unsigned char* pszReport, int nTimeout, int* pnReportLen)
+{
+    int nRet = TP_SUCCESS;
+    unsigned long long ullStartTimeUS = 0,
+                       ullDeadlineUS = 0,
+                       ullReadyUS = 0;
+
+    if (m_bConnected == false)
+    {
+        ERR("%s: Device not connected!", __func__);
+        return TP_ERR_IO_ERROR;
+    }
+
+    // Absolute deadline of this read
+    ullStartTimeUS = get_monotonic_time_us();
+    ullDeadlineUS = ullStartTimeUS + ((unsigned long long)((nTimeout > 0) ? nTimeout : 0) * 1000ULL);
+    if ((m_ullReadDeadlineUS != 0) && (m_ullReadDeadlineUS < ullDeadlineUS))
+        ullDeadlineUS = (m_ullReadDeadlineUS > ullStartTimeUS) ? m_ullReadDeadlineUS : ullStartTimeUS;
+    ullDeadlineUS = ullStartTimeUS + ScaleWaitTime(ullDeadlineUS - ullStartTimeUS);
+
+    while (true)
+    {
+        nRet = NextReport(pszReport, get_monotonic_time_us(), &ullReadyUS);
+        if (nRet == TP_SUCCESS)
+            break;
+
+        // Nothing comes, or next report comes after deadline
+        if ((nRet == TP_ERR_DATA_NOT_FOUND) || (ullReadyUS > ullDeadlineUS))
+        {
+            SleepUntil(ullDeadlineUS);
+            TRACE("%s: timeout (%d ms, waited %llu us)!", __func__, nTimeout, get_elapsed_time_us(ullStartTimeUS));
+            nRet = TP_ERR_TIMEOUT;
+            break;
+        }
+
+        SleepUntil(ullReadyUS);
+    }
+
+    // Record actual response time of device
+    m_ullLastReadLatencyUS = get_elapsed_time_us(ullStartTimeUS);
+
+    if (nRet == TP_SUCCESS)
+        *pnReportLen = (int)m_inBufSize;
+
+    return nRet;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDQueuedReportGet::DrainInputReports()
+// Take reports already delivered by backend before a command is sent.
+// Finger reports are kept in input report ring, others are discarded.
+// Reports not ready yet are not touched, like the ones not yet sent by a real controller.
+// p_ulDiscardedReports: Number of stale reports discarded (can be NULL)
+
+int CI2CHIDQueuedReportGet::DrainInputReports(unsigned long* p_ulDiscardedReports)
+{
+    int nReportIndex = 0;
+    unsigned long ulDiscarded = 0;
+    unsigned long long ullNowUS = 0,
+                       ullReadyUS = 0;
+
+    if (m_bConnected == false)
+        goto DRAIN_INPUT_REPORTS_EXIT;
+
+    // Mutex locks the critical section
+    sem_wait(&m_ioMutex);
+
+    ullNowUS = get_monotonic_time_us();
+    for (nReportIndex = 0; nReportIndex < ELAN_HID_DRAIN_REPORT_MAX; nReportIndex++)
+    {
+        memset(m_inBuf, 0, sizeof(unsigned char)*m_inBufSize);
+        if (NextReport(m_inBuf, ullNowUS, &ullReadyUS) != TP_SUCCESS) // Nothing ready
+            break;
+        TraceReport(TRACE_DIRECTION_IN, m_inBuf, m_inBufSize);
+
+        if (ClassifyReport(m_inBuf) == ELAN_HID_REPORT_CLASS_INPUT)
+        {
+            PushInputReport(m_inBuf);
+        }
+        else
+        {
+            TRACE("%s: Discard stale report %02x %02x %02x %02x.", __func__, m_inBuf[0], m_inBuf[1], m_inBuf[2], m_inBuf[3]);
+            ulDiscarded++;
+        }
+    }
+
+    m_ulDiscardedReportCount += ulDiscarded;
+
+    // Mutex unlocks the critical section
+    sem_post(&m_ioMutex);
+
+DRAIN_INPUT_REPORTS_EXIT:
+    if (p_ulDiscardedReports != NULL)
+        *p_ulDiscardedReports = ulDiscarded;
+
+    return TP_SUCCESS;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDQueuedReportGet::ScaleWaitTime()
+// Time actually waited for a read timeout, reports come in real time by default
+
+unsigned long long CI2CHIDQueuedReportGet::ScaleWaitTime(unsigned long long ullWaitUS)
+{
+    return ullWaitUS;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDQueuedReportGet::SleepUntil()
+// Sleep until absolute CLOCK_MONOTONIC time (in microsecond)
+
+void CI2CHIDQueuedReportGet::SleepUntil(unsigned long long ullTimeUS)
+{
+    struct timespec wake;
+
+    wake.tv_sec = (time_t)(ullTimeUS / 1000000ULL);
+    wake.tv_nsec = (long)((ullTimeUS % 1000000ULL) * 1000ULL);
+
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wake, NULL) == EINTR)
+        continue;
+
+    return;
+}
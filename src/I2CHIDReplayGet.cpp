@@ -0,0 +1,298 @@
+// I2CHIDReplayGet.cpp : implementation file
+//
+
+#include "I2CHIDReplayGet.h"
+#include "ElanTsTimeUtility.h"
+#include "ElanTsProfileUtility.h"
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDReplayGet::CI2CHIDReplayGet()
+
+CI2CHIDReplayGet::CI2CHIDReplayGet(char *pszLogDirPath, char *pszDebugLogFileName) : CI2CHIDQueuedReportGet(pszLogDirPath, pszDebugLogFileName)
+{
+    m_nSpeed = REPLAY_SPEED_ORIGINAL;
+
+    memset(&m_traceHeader, 0, sizeof(m_traceHeader));
+    m_pRecords = NULL;
+    m_nRecordCount = 0;
+    m_nCursor = 0;
+
+    m_ullAnchorHostUS = 0;
+    m_ullAnchorTraceUS = 0;
+
+    memset(&m_statistics, 0, sizeof(m_statistics));
+
+    return;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDReplayGet::~CI2CHIDReplayGet()
+
+CI2CHIDReplayGet::~CI2CHIDReplayGet(void)
+{
+    Close();
+    ReleaseTrace();
+
+    return;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDReplayGet::LoadTrace()
+// Load whole trace file into memory, replay starts from its first record on GetDeviceHandle()
+// nSpeed: N for N times faster than recorded, REPLAY_SPEED_NO_WAIT for no wait at all
+
+int CI2CHIDReplayGet::LoadTrace(const char *pszTraceFilePath, unsigned int nSpeed)
+{
+    int nRet = TP_SUCCESS;
+
+    ReleaseTrace();
+
+    nRet = trace_load(pszTraceFilePath, &m_traceHeader, &m_pRecords, &m_nRecordCount);
+    if (nRet != TP_SUCCESS)
+        goto LOAD_TRACE_EXIT;
+
+    m_nSpeed = nSpeed;
+    DBG("%s: Replay %d records of \"%s\" (VID 0x%x, PID 0x%x, speed %u%s).", __func__, m_nRecordCount, pszTraceFilePath, \
+        m_traceHeader.vid, m_traceHeader.pid, m_nSpeed, (m_nSpeed == REPLAY_SPEED_NO_WAIT) ? ", no wait" : "x");
+
+LOAD_TRACE_EXIT:
+    return nRet;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDReplayGet::GetReplayStatistics()
+// Return matched / diverged output reports and replayed / skipped input reports
+
+void CI2CHIDReplayGet::GetReplayStatistics(structReplayStatistics *pStatistics)
+{
+    if (pStatistics != NULL)
+        memcpy(pStatistics, &m_statistics, sizeof(structReplayStatistics));
+
+    return;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDReplayGet::GetInterfaceType()
+// Return Interface Type
+
+int CI2CHIDReplayGet::GetInterfaceType(void)
+{
+    return INTF_TYPE_ELAN_I2CHID_REPLAY;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDReplayGet::GetInterfaceVersion()
+// Return Version of Interface Inplementation
+
+const char* CI2CHIDReplayGet::GetInterfaceVersion(void)
+{
+    return I2CHID_REPLAY_INTF_IMPL_VER;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDReplayGet::GetDeviceHandle()
+// Connect to recorded device, replay (re)starts from first record
+// nPID: PID requested, ELAN_USB_FORCE_CONNECT_PID takes the recorded PID
+
+int CI2CHIDReplayGet::GetDeviceHandle(int nVID, int nPID)
+{
+    int nRet = TP_SUCCESS;
+
+    if (m_pRecords == NULL)
+    {
+        ERR("%s: No trace loaded!", __func__);
+        nRet = TP_ERR_NOT_FOUND_DEVICE;
+        goto GET_DEVICE_HANDLE_EXIT;
+    }
+
+    if ((nVID != m_traceHeader.vid) || ((nPID != ELAN_USB_FORCE_CONNECT_PID) && (nPID != m_traceHeader.pid)))
+    {
+        ERR("%s: Device (VID 0x%x, PID 0x%x) not in trace (VID 0x%x, PID 0x%x)!", __func__, \
+            nVID, nPID, m_traceHeader.vid, m_traceHeader.pid);
+        nRet = TP_ERR_NOT_FOUND_DEVICE;
+        goto GET_DEVICE_HANDLE_EXIT;
+    }
+
+    m_usVID = m_traceHeader.vid;
+    m_usPID = m_traceHeader.pid;
+
+    // Records before first output report are released relative to connection
+    m_nCursor = 0;
+    m_ullAnchorHostUS = get_monotonic_time_us();
+    m_ullAnchorTraceUS = 0;
+    m_bConnected = true;
+
+    DBG("%s: Connect recorded device (VID 0x%x, PID 0x%x).", __func__, m_usVID, m_usPID);
+
+GET_DEVICE_HANDLE_EXIT:
+    return nRet;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDReplayGet::Close()
+// Disconnect recorded device, trace kept for next connection
+
+void CI2CHIDReplayGet::Close(void)
+{
+    if (m_bConnected == true)
+    {
+        DBG("%s: Release recorded device (%d of %d records replayed).", __func__, m_nCursor, m_nRecordCount);
+        m_bConnected = false;
+    }
+
+    return;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDReplayGet::WriteRawBytes()
+// Match output report against next output report of trace
+// Input reports of trace not read before it are skipped. A differing report is
+// counted as divergence, and replay still goes on from the recorded one.
+
+int CI2CHIDReplayGet::WriteRawBytes(unsigned char* pszBuf, int nLen, int nTimeout, int nDevIdx)
+{
+    int nRet = TP_SUCCESS,
+        nIndex = 0;
+    struct trace_record *pRecord = NULL;
+#ifdef __ENABLE_PROFILE__
+    unsigned long long ullProfileStartUS = get_monotonic_time_us();
+#endif //__ENABLE_PROFILE__
+
+    if (m_bConnected == false)
+    {
+        ERR("%s: Recorded device not connected!", __func__);
+        nRet = TP_ERR_IO_ERROR;
+        goto WRITE_RAW_BYTES_EXIT;
+    }
+
+    if ((pszBuf == NULL) || (nLen <= 0) || ((unsigned)nLen > m_outBufSize))
+    {
+        ERR("%s: Invalid data (buf=%p, len=%d, buffer size=%d)!", __func__, pszBuf, nLen, m_outBufSize);
+        nRet = TP_ERR_INVALID_PARAM;
+        goto WRITE_RAW_BYTES_EXIT;
+    }
+
+    // Mutex locks the critical section
+    sem_wait(&m_ioMutex);
+
+    memset(m_outBuf, 0, sizeof(unsigned char)*m_outBufSize);
+    memcpy(m_outBuf, pszBuf, nLen);
+
+#if defined(__ENABLE_DEBUG__) && defined(__ENABLE_OUTBUF_DEBUG__)
+    if (ELAN_LOG_ENABLED(ELAN_LOG_LEVEL_TRACE, LOG_SINK_ENABLED && (g_bEnableDebug == true) && (g_bEnableOutputBufferDebug == true)))
+        DebugPrintBuffer("m_outBuf", m_outBuf, nLen);
+#endif //__ENABLE_DEBUG__ && __ENABLE_OUTBUF_DEBUG__
+
+    TraceReport(TRACE_DIRECTION_OUT, m_outBuf, m_outBufSize);
+
+    // Next output report of trace
+    for (nIndex = m_nCursor; nIndex < m_nRecordCount; nIndex++)
+    {
+        if (m_pRecords[nIndex].direction == TRACE_DIRECTION_OUT)
+            break;
+    }
+    m_statistics.ulSkippedReports += (unsigned long)(nIndex - m_nCursor);
+
+    if (nIndex == m_nRecordCount)
+    {
+        if (m_statistics.ulDivergedWrites == 0)
+            ERR("%s: Output report %02x %02x %02x %02x written after end of trace!", __func__, \
+                m_outBuf[0], m_outBuf[1], m_outBuf[2], m_outBuf[3]);
+        m_statistics.ulDivergedWrites++;
+        m_nCursor = m_nRecordCount;
+    }
+    else
+    {
+        pRecord = &m_pRecords[nIndex];
+        if (memcmp(m_outBuf, pRecord->data, (pRecord->report_size < m_outBufSize) ? pRecord->report_size : m_outBufSize) != 0)
+        {
+            if (m_statistics.ulDivergedWrites == 0)
+                ERR("%s: Output report %02x %02x %02x %02x differs from record #%d (%02x %02x %02x %02x)!", __func__, \
+                    m_outBuf[0], m_outBuf[1], m_outBuf[2], m_outBuf[3], nIndex, \
+                    pRecord->data[0], pRecord->data[1], pRecord->data[2], pRecord->data[3]);
+            m_statistics.ulDivergedWrites++;
+        }
+        else
+            m_statistics.ulMatchedWrites++;
+
+        // Input reports after this one are timed from now
+        m_ullAnchorHostUS = get_monotonic_time_us();
+        m_ullAnchorTraceUS = pRecord->time_us;
+        m_nCursor = nIndex + 1;
+    }
+
+    // Mutex unlocks the critical section
+    sem_post(&m_ioMutex);
+
+WRITE_RAW_BYTES_EXIT:
+#ifdef __ENABLE_PROFILE__
+    profile_record_io(PROFILE_IO_WRITE, get_elapsed_time_us(ullProfileStartUS), nRet, 0);
+#endif //__ENABLE_PROFILE__
+    return nRet;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDReplayGet::ReleaseTrace()
+// Free records of loaded trace
+
+void CI2CHIDReplayGet::ReleaseTrace(void)
+{
+    trace_free(m_pRecords);
+    m_pRecords = NULL;
+    m_nRecordCount = 0;
+    m_nCursor = 0;
+
+    return;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDReplayGet::NextReport()
+// Take the next input report of trace if released now
+// Return TP_SUCCESS if taken, TP_ERR_TIMEOUT if not released yet (release time
+// in *p_ullReadyUS), TP_ERR_DATA_NOT_FOUND if an output report (or end of trace) comes next.
+
+int CI2CHIDReplayGet::NextReport(unsigned char* pszReport, unsigned long long ullNowUS, unsigned long long* p_ullReadyUS)
+{
+    struct trace_record *pRecord = NULL;
+
+    *p_ullReadyUS = 0;
+
+    if ((m_nCursor >= m_nRecordCount) || (m_pRecords[m_nCursor].direction != TRACE_DIRECTION_IN))
+        return TP_ERR_DATA_NOT_FOUND;
+
+    pRecord = &m_pRecords[m_nCursor];
+    *p_ullReadyUS = ScaleTime(pRecord->time_us);
+    if (*p_ullReadyUS > ullNowUS)
+        return TP_ERR_TIMEOUT;
+
+    memcpy(pszReport, pRecord->data, (m_inBufSize < TRACE_REPORT_SIZE_MAX) ? m_inBufSize : TRACE_REPORT_SIZE_MAX); // Zero padded
+    m_nCursor++;
+    m_statistics.ulReplayedReports++;
+
+    return TP_SUCCESS;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDReplayGet::ScaleTime()
+// Host time (CLOCK_MONOTONIC, in microsecond) of a trace time, relative to timing anchor
+
+unsigned long long CI2CHIDReplayGet::ScaleTime(unsigned long long ullTraceUS)
+{
+    if ((m_nSpeed == REPLAY_SPEED_NO_WAIT) || (ullTraceUS <= m_ullAnchorTraceUS))
+        return m_ullAnchorHostUS;
+
+    return m_ullAnchorHostUS + ((ullTraceUS - m_ullAnchorTraceUS) / m_nSpeed);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDReplayGet::ScaleWaitTime()
+// Read timeout (and read deadline) is divided by replay speed as recorded delays are,
+// so a report recorded after a timeout still misses it.
+
+unsigned long long CI2CHIDReplayGet::ScaleWaitTime(unsigned long long ullWaitUS)
+{
+    if (m_nSpeed == REPLAY_SPEED_NO_WAIT)
+        return 0;
+
+    return ullWaitUS / m_nSpeed;
+}
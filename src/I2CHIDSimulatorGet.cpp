@@ -0,0 +1,935 @@
+// I2CHIDSimulatorGet.cpp : implementation file
+//
+
+#include "I2CHIDSimulatorGet.h"
+#include "ElanTsTimeUtility.h"
+#include "ElanTsProfileUtility.h"
+
+/////////////////////////////////////////////////////////////////////////////
+// Controller Firmware Parameters
+
+// 8-bit I2C Slave Address Answered by Boot Code
+#define SIMULATOR_I2C_SLAVE_ADDR		0x20
+
+// 7-bit I2C Slave Address Sent by Host (Check Slave Address Command)
+#define SIMULATOR_I2C_SLAVE_ADDR_CMD	(SIMULATOR_I2C_SLAVE_ADDR >> 1)
+
+// Hello Packets
+#define SIMULATOR_NORMAL_MODE_HELLO_PACKET			0x20
+#define SIMULATOR_RECOVERY_MODE_HELLO_PACKET		0x56
+#define SIMULATOR_GEN8_NORMAL_MODE_HELLO_PACKET		0x21
+#define SIMULATOR_GEN8_RECOVERY_MODE_HELLO_PACKET	0x57
+
+// Information ROM (Gen5/6/7: Word Address, Gen8: Byte Address of First Byte in ROM Image)
+#define SIMULATOR_INFO_REMARK_ID_WORD_ADDR	0x801F
+#define SIMULATOR_INFO_FWID_WORD_ADDR		0x8080
+#define SIMULATOR_GEN8_ROM_BASE_ADDR		0x40000
+
+// Frames
+#define SIMULATOR_PAGE_SIZE					132		// Address(1 word) + Data(64 words) + Checksum(1 word)
+#define SIMULATOR_PAGE_FRAME_SIZE			0x1C	// Data bytes of one frame data command
+#define SIMULATOR_BULK_FRAME_DATA_SIZE		0x3C	// Data bytes of one bulk ROM data frame
+
+// Reports Kept by hidraw while Not Read (Older Finger Reports are Lost)
+#define SIMULATOR_HIDRAW_QUEUE_MAX			64
+
+// Finger Reports of One Stroke (Same Contact ID)
+#define SIMULATOR_TOUCH_STROKE_REPORTS		8
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDSimulatorGet::CI2CHIDSimulatorGet()
+// 1. Set default controller configuration (Gen5/6/7 in main code)
+// 2. Load ROM image
+
+CI2CHIDSimulatorGet::CI2CHIDSimulatorGet(char *pszLogDirPath, char *pszDebugLogFileName) : CI2CHIDQueuedReportGet(pszLogDirPath, pszDebugLogFileName)
+{
+
+    // Default Controller: EKTH6308 in Main Code
+    memset(&m_config, 0, sizeof(m_config));
+    m_config.bGen8Touch = false;
+    m_config.bRecovery = false;
+    m_config.usPID = 0x2A03;
+    m_config.usFwID = 0x2A03;
+    m_config.usFwVersion = 0x6301;
+    m_config.usTestVersion = 0x0100;
+    m_config.usFwBcVersion = 0xA801;
+    m_config.usBcBcVersion = 0xA801;
+    m_config.usInfoFwID = 0x2A03;
+    m_config.nResponseDelayUS = SIMULATOR_DEFAULT_RESPONSE_DELAY_US;
+    m_config.nFrameIntervalUS = SIMULATOR_DEFAULT_FRAME_INTERVAL_US;
+    m_config.nFlashPageUS = SIMULATOR_DEFAULT_FLASH_PAGE_US;
+    m_config.nTouchReportHz = 0;
+
+    ResetController();
+    LoadRomImage();
+
+    return;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDSimulatorGet::~CI2CHIDSimulatorGet()
+
+CI2CHIDSimulatorGet::~CI2CHIDSimulatorGet(void)
+{
+    Close();
+
+    return;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDSimulatorGet::SetConfig()
+// Configure simulated controller & reload ROM image
+// pszConfig: Comma-separated items (NULL or "default" keeps default controller)
+//   gen5 / gen6 / gen7 / gen8: Controller generation
+//   normal / recovery: Main code or boot code
+//   delay=<us>, frame=<us>, flash=<us>: Response delay, frame interval, flash time of one page
+//   touch=<hz>: Finger reports injected per second
+//   fwid=<hex>, fwver=<hex>, bc=<hex>, pid=<hex>: Information FWID (& FW ID), FW version, BC version, PID
+
+int CI2CHIDSimulatorGet::SetConfig(const char *pszConfig)
+{
+    int nRet = TP_SUCCESS;
+    structSimulatorConfig config;
+    char szItem[64] = {0};
+    const char *pszItem = pszConfig,
+               *pszNext = NULL;
+    char *pszValue = NULL,
+         *pszEnd = NULL;
+    size_t nItemLen = 0;
+    unsigned long ulValue = 0;
+    bool bBcVersionSet = false,
+         bPidSet = false;
+
+    memcpy(&config, &m_config, sizeof(config));
+
+    while ((pszItem != NULL) && (*pszItem != '\0'))
+    {
+        // Take One Item
+        pszNext = strchr(pszItem, ',');
+        nItemLen = (pszNext != NULL) ? (size_t)(pszNext - pszItem) : strlen(pszItem);
+        if (nItemLen >= sizeof(szItem))
+        {
+            ERR("%s: Simulator config item too long!", __func__);
+            nRet = TP_ERR_INVALID_PARAM;
+            goto SET_CONFIG_EXIT;
+        }
+        memset(szItem, 0, sizeof(szItem));
+        memcpy(szItem, pszItem, nItemLen);
+        pszItem = (pszNext != NULL) ? (pszNext + 1) : NULL;
+
+        // Flags
+        if ((nItemLen == 0) || (strcmp(szItem, "default") == 0))
+            continue;
+        if ((strcmp(szItem, "gen5") == 0) || (strcmp(szItem, "gen6") == 0) || (strcmp(szItem, "gen7") == 0))
+        {
+            config.bGen8Touch = false;
+            continue;
+        }
+        if (strcmp(szItem, "gen8") == 0)
+        {
+            config.bGen8Touch = true;
+            continue;
+        }
+        if ((strcmp(szItem, "normal") == 0) || (strcmp(szItem, "recovery") == 0))
+        {
+            config.bRecovery = (strcmp(szItem, "recovery") == 0);
+            continue;
+        }
+
+        // Key=Value
+        pszValue = strchr(szItem, '=');
+        if ((pszValue == NULL) || (pszValue[1] == '\0'))
+        {
+            ERR("%s: Invalid simulator config item \"%s\"!", __func__, szItem);
+            nRet = TP_ERR_INVALID_PARAM;
+            goto SET_CONFIG_EXIT;
+        }
+        *pszValue++ = '\0';
+
+        if ((strcmp(szItem, "delay") == 0) || (strcmp(szItem, "frame") == 0) || \
+            (strcmp(szItem, "flash") == 0) || (strcmp(szItem, "touch") == 0))
+            ulValue = strtoul(pszValue, &pszEnd, 10);
+        else
+            ulValue = strtoul(pszValue, &pszEnd, 16);
+        if (*pszEnd != '\0')
+        {
+            ERR("%s: Invalid value \"%s\" of simulator config \"%s\"!", __func__, pszValue, szItem);
+            nRet = TP_ERR_INVALID_PARAM;
+            goto SET_CONFIG_EXIT;
+        }
+
+        if (strcmp(szItem, "delay") == 0)
+            config.nResponseDelayUS = (unsigned int)ulValue;
+        else if (strcmp(szItem, "frame") == 0)
+            config.nFrameIntervalUS = (unsigned int)ulValue;
+        else if (strcmp(szItem, "flash") == 0)
+            config.nFlashPageUS = (unsigned int)ulValue;
+        else if (strcmp(szItem, "touch") == 0)
+            config.nTouchReportHz = (unsigned int)ulValue;
+        else if (strcmp(szItem, "fwid") == 0)
+        {
+            config.usInfoFwID = (unsigned short)ulValue;
+            config.usFwID = (unsigned short)ulValue;
+        }
+        else if (strcmp(szItem, "fwver") == 0)
+            config.usFwVersion = (unsigned short)ulValue;
+        else if (strcmp(szItem, "bc") == 0)
+        {
+            config.usFwBcVersion = (unsigned short)ulValue;
+            config.usBcBcVersion = (unsigned short)ulValue;
+            bBcVersionSet = true;
+        }
+        else if (strcmp(szItem, "pid") == 0)
+        {
+            config.usPID = (unsigned short)ulValue;
+            bPidSet = true;
+        }
+        else
+        {
+            ERR("%s: Unknown simulator config \"%s\"!", __func__, szItem);
+            nRet = TP_ERR_INVALID_PARAM;
+            goto SET_CONFIG_EXIT;
+        }
+    }
+
+    // BC Version Identifies Generation (EM32F901 for Gen8)
+    if (bBcVersionSet == false)
+    {
+        config.usFwBcVersion = (config.bGen8Touch) ? 0x9501 : 0xA801;
+        config.usBcBcVersion = config.usFwBcVersion;
+    }
+
+    // Boot Code Enumerates with Recovery PID
+    if ((bPidSet == false) && (config.bRecovery == true))
+        config.usPID = ELAN_USB_RECOVERY_PID;
+
+    memcpy(&m_config, &config, sizeof(m_config));
+    LoadRomImage();
+
+    DBG("%s: %s %s, PID 0x%04x, FWID 0x%04x, delay %u us, frame %u us, flash %u us, touch %u Hz.", __func__, \
+        (m_config.bGen8Touch) ? "Gen8" : "Gen5/6/7", (m_config.bRecovery) ? "Recovery" : "Normal", \
+        m_config.usPID, m_config.usInfoFwID, m_config.nResponseDelayUS, m_config.nFrameIntervalUS, \
+        m_config.nFlashPageUS, m_config.nTouchReportHz);
+
+SET_CONFIG_EXIT:
+    return nRet;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDSimulatorGet::GetConfig()
+
+void CI2CHIDSimulatorGet::GetConfig(structSimulatorConfig *pConfig)
+{
+    if (pConfig != NULL)
+        memcpy(pConfig, &m_config, sizeof(structSimulatorConfig));
+
+    return;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDSimulatorGet::GetInterfaceType()
+// Return Interface Type
+
+int CI2CHIDSimulatorGet::GetInterfaceType(void)
+{
+    return INTF_TYPE_ELAN_I2CHID_SIMULATOR;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDSimulatorGet::GetInterfaceVersion()
+// Return Version of Interface Inplementation
+
+const char* CI2CHIDSimulatorGet::GetInterfaceVersion(void)
+{
+    return I2CHID_SIMULATOR_INTF_IMPL_VER;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDSimulatorGet::GetDeviceHandle()
+// Connect to simulated controller (power on, ROM content kept)
+// nPID: PID requested, ELAN_USB_FORCE_CONNECT_PID takes the configured PID
+
+int CI2CHIDSimulatorGet::GetDeviceHandle(int nVID, int nPID)
+{
+    int nRet = TP_SUCCESS;
+
+    if (nVID != ELAN_USB_VID)
+    {
+        ERR("%s: Simulated device (VID 0x%x) not found!", __func__, nVID);
+        nRet = TP_ERR_NOT_FOUND_DEVICE;
+        goto GET_DEVICE_HANDLE_EXIT;
+    }
+
+    m_usVID = (unsigned short) nVID;
+    m_usPID = (nPID != ELAN_USB_FORCE_CONNECT_PID) ? (unsigned short) nPID : m_config.usPID;
+
+    ResetController();
+    if (m_config.nTouchReportHz != 0)
+        m_ullNextTouchUS = get_monotonic_time_us() + (1000000ULL / m_config.nTouchReportHz);
+    m_bConnected = true;
+
+    DBG("%s: Connect simulated %s controller (VID 0x%x, PID 0x%x).", __func__, \
+        (m_config.bGen8Touch) ? "Gen8" : "Gen5/6/7", m_usVID, m_usPID);
+
+GET_DEVICE_HANDLE_EXIT:
+    return nRet;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDSimulatorGet::Close()
+// Disconnect simulated controller, reports in flight are lost
+
+void CI2CHIDSimulatorGet::Close(void)
+{
+    if (m_bConnected == true)
+    {
+        DBG("%s: Release simulated device.", __func__);
+        ResetController();
+        m_bConnected = false;
+    }
+
+    return;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDSimulatorGet::WriteRawBytes()
+// Deliver output report to simulated controller
+// Controller always receives whole output report (33 bytes), as hidraw does.
+
+int CI2CHIDSimulatorGet::WriteRawBytes(unsigned char* pszBuf, int nLen, int nTimeout, int nDevIdx)
+{
+    int nRet = TP_SUCCESS;
+#ifdef __ENABLE_PROFILE__
+    unsigned long long ullProfileStartUS = get_monotonic_time_us();
+#endif //__ENABLE_PROFILE__
+
+    if (m_bConnected == false)
+    {
+        ERR("%s: Simulated device not connected!", __func__);
+        nRet = TP_ERR_IO_ERROR;
+        goto WRITE_RAW_BYTES_EXIT;
+    }
+
+    if ((pszBuf == NULL) || (nLen <= 0) || ((unsigned)nLen > m_outBufSize))
+    {
+        ERR("%s: Invalid data (buf=%p, len=%d, buffer size=%d)!", __func__, pszBuf, nLen, m_outBufSize);
+        nRet = TP_ERR_INVALID_PARAM;
+        goto WRITE_RAW_BYTES_EXIT;
+    }
+
+    // Mutex locks the critical section
+    sem_wait(&m_ioMutex);
+
+    memset(m_outBuf, 0, sizeof(unsigned char)*m_outBufSize);
+    memcpy(m_outBuf, pszBuf, nLen);
+
+#if defined(__ENABLE_DEBUG__) && defined(__ENABLE_OUTBUF_DEBUG__)
+    if (ELAN_LOG_ENABLED(ELAN_LOG_LEVEL_TRACE, LOG_SINK_ENABLED && (g_bEnableDebug == true) && (g_bEnableOutputBufferDebug == true)))
+        DebugPrintBuffer("m_outBuf", m_outBuf, nLen);
+#endif //__ENABLE_DEBUG__ && __ENABLE_OUTBUF_DEBUG__
+
+    if (m_outBuf[0] != ELAN_HID_OUTPUT_REPORT_ID)
+    {
+        DBG("%s: Ignore output report with report ID 0x%02x.", __func__, m_outBuf[0]);
+    }
+    else
+    {
+        // Bridge Command
+        switch (m_outBuf[1])
+        {
+            case 0x00: // TP Command
+                if (m_outBuf[2] > (m_outBufSize - 3))
+                {
+                    DBG("%s: Ignore TP command of length %d.", __func__, m_outBuf[2]);
+                }
+                else if (m_config.bGen8Touch == true)
+                    HandleGen8Command(&m_outBuf[3], m_outBuf[2]);
+                else
+                    HandleCommand(&m_outBuf[3], m_outBuf[2]);
+                break;
+
+            case 0x18: // Request Hello Packet
+                HandleHelloPacketRequest();
+                break;
+
+            case 0x20: // Erase Flash Section (Gen8)
+                HandleEraseFlashSection(m_outBuf);
+                break;
+
+            case 0x21: // Frame Data
+                HandleFrameData(m_outBuf);
+                break;
+
+            case 0x22: // Flash Write
+                HandleFlashWrite();
+                break;
+
+            default:
+                DBG("%s: Ignore unknown bridge command 0x%02x.", __func__, m_outBuf[1]);
+                break;
+        }
+    }
+
+    TraceReport(TRACE_DIRECTION_OUT, m_outBuf, m_outBufSize);
+
+    // Mutex unlocks the critical section
+    sem_post(&m_ioMutex);
+
+WRITE_RAW_BYTES_EXIT:
+#ifdef __ENABLE_PROFILE__
+    profile_record_io(PROFILE_IO_WRITE, get_elapsed_time_us(ullProfileStartUS), nRet, 0);
+#endif //__ENABLE_PROFILE__
+    return nRet;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDSimulatorGet::TakeReport()
+// Take the next report if ready now, without waiting
+// Return TP_SUCCESS if taken, TP_ERR_TIMEOUT if next report not ready yet
+// (ready time in *p_ullReadyUS), TP_ERR_DATA_NOT_FOUND if nothing in flight.
+
+int CI2CHIDSimulatorGet::TakeReport(unsigned char* pszBuf, int nLen, unsigned long long* p_ullReadyUS)
+{
+    int nRet = TP_SUCCESS;
+
+    if (m_bConnected == false)
+    {
+        ERR("%s: Simulated device not connected!", __func__);
+        return TP_ERR_IO_ERROR;
+    }
+
+    // Mutex locks the critical section
+    sem_wait(&m_ioMutex);
+
+    memset(m_inBuf, 0, sizeof(unsigned char)*m_inBufSize);
+    nRet = NextReport(m_inBuf, get_monotonic_time_us(), p_ullReadyUS);
+    if (nRet == TP_SUCCESS)
+        memcpy(pszBuf, m_inBuf, ((unsigned)nLen <= m_inBufSize) ? nLen : m_inBufSize);
+
+    // Mutex unlocks the critical section
+    sem_post(&m_ioMutex);
+
+    return nRet;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDSimulatorGet::ResetController()
+// Power-on state: main code (or boot code if recovery), nothing in flight
+
+void CI2CHIDSimulatorGet::ResetController(void)
+{
+    m_bFlashKey = false;
+    m_bIapMode = false;
+    m_bTestMode = false;
+
+    memset(m_szPageBuf, 0, sizeof(m_szPageBuf));
+    m_nPageBufLen = 0;
+
+    memset(m_szReportQueue, 0, sizeof(m_szReportQueue));
+    memset(m_ullReportReadyUS, 0, sizeof(m_ullReportReadyUS));
+    m_nReportQueueHead = 0;
+    m_nReportQueueCount = 0;
+    m_ullLastReadyUS = 0;
+
+    m_ullNextTouchUS = 0;
+    m_nTouchReportIndex = 0;
+
+    return;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDSimulatorGet::LoadRomImage()
+// Fill ROM with deterministic pattern, then information FWID & remark ID
+// Gen5/6/7: Word address, word N at byte 2N (little endian).
+// Gen8: Byte address from information ROM (0x40000).
+
+void CI2CHIDSimulatorGet::LoadRomImage(void)
+{
+    unsigned int nIndex = 0,
+                 nOffset = 0;
+
+    for (nIndex = 0; nIndex < (unsigned int)SIMULATOR_ROM_SIZE; nIndex++)
+        m_szRom[nIndex] = (unsigned char)((nIndex * 0x9D) ^ (nIndex >> 8));
+
+    if (m_config.bGen8Touch == true)
+    {
+        m_szRom[0] = (unsigned char) (m_config.usInfoFwID & 0x00FF);
+        m_szRom[1] = (unsigned char)((m_config.usInfoFwID & 0xFF00) >> 8);
+    }
+    else
+    {
+        nOffset = SIMULATOR_INFO_FWID_WORD_ADDR * 2;
+        m_szRom[nOffset]     = (unsigned char) (m_config.usInfoFwID & 0x00FF);
+        m_szRom[nOffset + 1] = (unsigned char)((m_config.usInfoFwID & 0xFF00) >> 8);
+
+        nOffset = SIMULATOR_INFO_REMARK_ID_WORD_ADDR * 2;
+        m_szRom[nOffset]     = 0x00;
+        m_szRom[nOffset + 1] = 0x00;
+    }
+
+    return;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDSimulatorGet::HandleCommand()
+// TP command of Gen5/6/7 (also Gen8 4-byte / 6-byte commands)
+// pszCommand: Command without 3-byte header, nCommandLen: Command length
+
+void CI2CHIDSimulatorGet::HandleCommand(unsigned char* pszCommand, int nCommandLen)
+{
+    unsigned char szData[6] = {0};
+    unsigned short usAddr = 0,
+                   usWord = 0;
+    bool bBootCode = (m_config.bRecovery || m_bIapMode);
+
+    // Check Slave Address (Boot Code Only)
+    if ((nCommandLen == 1) && (pszCommand[0] == SIMULATOR_I2C_SLAVE_ADDR_CMD))
+    {
+        if (bBootCode == true)
+        {
+            szData[0] = SIMULATOR_I2C_SLAVE_ADDR;
+            QueueResponse(szData, 1, 0);
+        }
+        return;
+    }
+
+    if (nCommandLen < 4)
+    {
+        DBG("%s: Ignore command of length %d.", __func__, nCommandLen);
+        return;
+    }
+
+    switch (pszCommand[0])
+    {
+        case 0x53: // Get Info. (Main Code Only)
+            if (bBootCode == true)
+                break;
+            if (pszCommand[1] == 0xf0)
+                QueueVersionResponse(0xf, m_config.usFwID);
+            else if (pszCommand[1] == 0x00)
+                QueueVersionResponse(0x0, m_config.usFwVersion);
+            else if (pszCommand[1] == 0xe0)
+                QueueVersionResponse(0xe, m_config.usTestVersion);
+            else if (pszCommand[1] == 0x10)
+                QueueVersionResponse(0x1, m_config.usFwBcVersion);
+            else
+                DBG("%s: Ignore Get Info. command 0x53 0x%02x.", __func__, pszCommand[1]);
+            break;
+
+        case 0x54: // Set Command
+            if ((pszCommand[1] == 0xc0) && (pszCommand[2] == 0xe1) && (pszCommand[3] == 0x5a)) // Write Flash Key
+            {
+                m_bFlashKey = true;
+            }
+            else if ((pszCommand[1] == 0x00) && (pszCommand[2] == 0x12) && (pszCommand[3] == 0x34)) // Enter IAP
+            {
+                if (m_bFlashKey == true)
+                    m_bIapMode = true;
+            }
+            else if ((pszCommand[1] == 0x29) && (bBootCode == false)) // Re-Calibration
+            {
+                szData[0] = szData[1] = szData[2] = szData[3] = 0x66;
+                QueueResponse(szData, 4, m_config.nFlashPageUS);
+            }
+            // Others (ex: Set Power Status 0x54 0x5X) Need No Response
+            break;
+
+        case 0x55: // Enter Test Mode
+            if ((pszCommand[1] == 0x55) && (pszCommand[2] == 0x55) && (pszCommand[3] == 0x55))
+                m_bTestMode = true;
+            break;
+
+        case 0xa5: // Exit Test Mode
+            if ((pszCommand[1] == 0xa5) && (pszCommand[2] == 0xa5) && (pszCommand[3] == 0xa5))
+                m_bTestMode = false;
+            break;
+
+        case 0x96: // Read ROM Data (Main Code Only): 0x96 ADDR_H ADDR_L 0x00 0x00 INFO
+            if ((bBootCode == true) || (nCommandLen < 6))
+                break;
+            usAddr = (unsigned short)((pszCommand[1] << 8) | pszCommand[2]);
+            usWord = GetRomWord(usAddr);
+            szData[0] = 0x95;
+            szData[1] = pszCommand[1];
+            szData[2] = pszCommand[2];
+            szData[3] = (unsigned char)((usWord & 0xFF00) >> 8);
+            szData[4] = (unsigned char) (usWord & 0x00FF);
+            QueueResponse(szData, 6, 0);
+            break;
+
+        case 0x59: // Show Bulk ROM Data: 0x59 MODE ADDR_H ADDR_L LEN_H LEN_L
+            if (nCommandLen < 6)
+                break;
+            usAddr = (unsigned short)((pszCommand[2] << 8) | pszCommand[3]);
+            if (pszCommand[1] == 0x10) // Frame Stream (Main Code)
+            {
+                if (bBootCode == false)
+                    HandleShowBulkRomData(usAddr, (unsigned short)((pszCommand[4] << 8) | pszCommand[5]), true);
+            }
+            else if (pszCommand[1] == 0x00) // One Word (Boot Code)
+                HandleShowBulkRomData(usAddr, 1, false);
+            break;
+
+        default:
+            DBG("%s: Ignore unknown command %02x %02x %02x %02x.", __func__, pszCommand[0], pszCommand[1], pszCommand[2], pszCommand[3]);
+            break;
+    }
+
+    return;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDSimulatorGet::HandleGen8Command()
+// 10-byte TP command of Gen8, others handled as Gen5/6/7 command
+
+void CI2CHIDSimulatorGet::HandleGen8Command(unsigned char* pszCommand, int nCommandLen)
+{
+    static const unsigned char szGen8FlashKey[10] = {0x54, 0xc0, 0xcd, 0xab, 0x34, 0x84, 0x01, 0x67, 0x94, 0x81};
+    unsigned char szData[10] = {0},
+                  ucDataLen = 0,
+                  ucIndex = 0;
+    unsigned int nAddr = 0;
+    bool bBootCode = (m_config.bRecovery || m_bIapMode);
+
+    if ((nCommandLen == 10) && (pszCommand[0] == 0x96)) // Read 32-bit RAM/ROM Data: 0x96 LEN ADDR_3 ADDR_2 ADDR_1 ADDR_0
+    {
+        // Boot code only supports 8-bit read
+        ucDataLen = pszCommand[1];
+        if (((ucDataLen != 1) && (ucDataLen != 2) && (ucDataLen != 4)) || ((bBootCode == true) && (ucDataLen != 1)))
+            return;
+
+        nAddr = ((unsigned int)pszCommand[2] << 24) | ((unsigned int)pszCommand[3] << 16) | \
+                ((unsigned int)pszCommand[4] << 8) | (unsigned int)pszCommand[5];
+
+        // Echo Length & Address, Data Byte N at szData[9 - N]
+        szData[0] = 0x95;
+        memcpy(&szData[1], &pszCommand[1], 5);
+        for (ucIndex = 0; ucIndex < ucDataLen; ucIndex++)
+            szData[9 - ucIndex] = GetGen8RomByte(nAddr + ucIndex);
+        QueueResponse(szData, 10, 0);
+    }
+    else if ((nCommandLen == 10) && (memcmp(pszCommand, szGen8FlashKey, sizeof(szGen8FlashKey)) == 0)) // Gen8 Write Flash Key
+    {
+        m_bFlashKey = true;
+    }
+    else
+    {
+        HandleCommand(pszCommand, nCommandLen);
+    }
+
+    return;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDSimulatorGet::HandleFrameData()
+// Frame data: 0x03 0x21 OFFSET_H OFFSET_L LEN DATA...
+
+void CI2CHIDSimulatorGet::HandleFrameData(unsigned char* pszReport)
+{
+    int nOffset = (pszReport[2] << 8) | pszReport[3],
+        nLen = pszReport[4];
+
+    if ((nLen == 0) || (nLen > SIMULATOR_PAGE_FRAME_SIZE) || ((nOffset + nLen) > SIMULATOR_PAGE_BUFFER_SIZE))
+    {
+        DBG("%s: Ignore frame data (offset 0x%x, length %d).", __func__, nOffset, nLen);
+        return;
+    }
+
+    memcpy(&m_szPageBuf[nOffset], &pszReport[5], nLen);
+    if ((nOffset + nLen) > m_nPageBufLen)
+        m_nPageBufLen = nOffset + nLen;
+
+    return;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDSimulatorGet::HandleFlashWrite()
+// Program pages received by frame data commands, response 0xAA 0xAA
+// Gen5/6/7 page: ADDR_L ADDR_H, 64 words of data, checksum (word address).
+// Gen8 pages are acknowledged with same timing, content not programmed.
+
+void CI2CHIDSimulatorGet::HandleFlashWrite(void)
+{
+    unsigned char szData[2] = {0xAA, 0xAA};
+    int nPageCount = 0,
+        nPageIndex = 0;
+    unsigned int nAddr = 0;
+    unsigned char *pszPage = NULL;
+
+    if (m_bFlashKey == false)
+    {
+        DBG("%s: Ignore flash write without flash key.", __func__);
+        return;
+    }
+
+    nPageCount = m_nPageBufLen / SIMULATOR_PAGE_SIZE;
+    if (nPageCount == 0)
+        nPageCount = 1;
+
+    if (m_config.bGen8Touch == false)
+    {
+        for (nPageIndex = 0; (nPageIndex * SIMULATOR_PAGE_SIZE) + SIMULATOR_PAGE_SIZE <= m_nPageBufLen; nPageIndex++)
+        {
+            pszPage = &m_szPageBuf[nPageIndex * SIMULATOR_PAGE_SIZE];
+            nAddr = (unsigned int)((pszPage[1] << 8) | pszPage[0]);
+            if ((nAddr + 64) <= 0x10000)
+                memcpy(&m_szRom[nAddr * 2], &pszPage[2], 128);
+        }
+    }
+
+    memset(m_szPageBuf, 0, sizeof(m_szPageBuf));
+    m_nPageBufLen = 0;
+
+    QueueResponse(szData, sizeof(szData), m_config.nFlashPageUS * nPageCount);
+
+    return;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDSimulatorGet::HandleEraseFlashSection()
+// Gen8 erase: 0x03 0x20 ADDR_0 ADDR_1 ADDR_2 ADDR_3 COUNT_L COUNT_H, response 0xAA 0xAA
+
+void CI2CHIDSimulatorGet::HandleEraseFlashSection(unsigned char* pszReport)
+{
+    unsigned char szData[2] = {0xAA, 0xAA};
+    unsigned short usPageCount = (unsigned short)((pszReport[7] << 8) | pszReport[6]);
+
+    if ((m_config.bGen8Touch == false) || (m_bFlashKey == false) || (usPageCount == 0))
+    {
+        DBG("%s: Ignore erase flash section (page count %d).", __func__, usPageCount);
+        return;
+    }
+
+    QueueResponse(szData, sizeof(szData), m_config.nFlashPageUS * usPageCount);
+
+    return;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDSimulatorGet::HandleHelloPacketRequest()
+// Hello packet: HELLO 0x00 BC_VER_H BC_VER_L
+
+void CI2CHIDSimulatorGet::HandleHelloPacketRequest(void)
+{
+    unsigned char szData[4] = {0};
+    bool bBootCode = (m_config.bRecovery || m_bIapMode);
+
+    if (m_config.bGen8Touch == true)
+        szData[0] = (bBootCode) ? SIMULATOR_GEN8_RECOVERY_MODE_HELLO_PACKET : SIMULATOR_GEN8_NORMAL_MODE_HELLO_PACKET;
+    else
+        szData[0] = (bBootCode) ? SIMULATOR_RECOVERY_MODE_HELLO_PACKET : SIMULATOR_NORMAL_MODE_HELLO_PACKET;
+    szData[2] = (unsigned char)((m_config.usBcBcVersion & 0xFF00) >> 8);
+    szData[3] = (unsigned char) (m_config.usBcBcVersion & 0x00FF);
+
+    QueueResponse(szData, sizeof(szData), 0);
+
+    return;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDSimulatorGet::HandleShowBulkRomData()
+// bStream == true: Frames of 0x99 INDEX LEN DATA... (words in little endian)
+// bStream == false: One word 0x99 0x00 0x02 DATA_H DATA_L
+
+void CI2CHIDSimulatorGet::HandleShowBulkRomData(unsigned short usAddr, unsigned short usWordCount, bool bStream)
+{
+    unsigned char szData[3 + SIMULATOR_BULK_FRAME_DATA_SIZE] = {0},
+                  ucPacketIndex = 0;
+    unsigned short usWord = 0;
+    unsigned int nTotalLen = 0,
+                 nOffset = 0,
+                 nFrameLen = 0,
+                 nIndex = 0;
+
+    if (bStream == false)
+    {
+        usWord = GetRomWord(usAddr);
+        szData[0] = 0x99;
+        szData[1] = 0x00;
+        szData[2] = 0x02;
+        szData[3] = (unsigned char)((usWord & 0xFF00) >> 8);
+        szData[4] = (unsigned char) (usWord & 0x00FF);
+        QueueResponse(szData, 5, 0);
+        return;
+    }
+
+    nTotalLen = (unsigned int)usWordCount * 2;
+    for (nOffset = 0; nOffset < nTotalLen; nOffset += nFrameLen)
+    {
+        nFrameLen = nTotalLen - nOffset;
+        if (nFrameLen > SIMULATOR_BULK_FRAME_DATA_SIZE)
+            nFrameLen = SIMULATOR_BULK_FRAME_DATA_SIZE;
+
+        memset(szData, 0, sizeof(szData));
+        szData[0] = 0x99;
+        szData[1] = ucPacketIndex++;
+        szData[2] = (unsigned char)nFrameLen;
+        for (nIndex = 0; nIndex < nFrameLen; nIndex++)
+            szData[3 + nIndex] = m_szRom[(((unsigned int)usAddr * 2) + nOffset + nIndex) % SIMULATOR_ROM_SIZE];
+        QueueResponse(szData, 3 + nFrameLen, 0);
+    }
+
+    return;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDSimulatorGet::GetRomWord()
+
+unsigned short CI2CHIDSimulatorGet::GetRomWord(unsigned short usAddr)
+{
+    unsigned int nOffset = (unsigned int)usAddr * 2;
+
+    return (unsigned short)((m_szRom[nOffset + 1] << 8) | m_szRom[nOffset]);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDSimulatorGet::GetGen8RomByte()
+// Byte out of ROM image reads as erased flash (0xFF)
+
+unsigned char CI2CHIDSimulatorGet::GetGen8RomByte(unsigned int nAddr)
+{
+    if ((nAddr < SIMULATOR_GEN8_ROM_BASE_ADDR) || ((nAddr - SIMULATOR_GEN8_ROM_BASE_ADDR) >= (unsigned int)SIMULATOR_ROM_SIZE))
+        return 0xFF;
+
+    return m_szRom[nAddr - SIMULATOR_GEN8_ROM_BASE_ADDR];
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDSimulatorGet::QueueResponse()
+// Queue one response report: 0x02 LEN DATA...
+// First report of a command is ready after response delay, following ones
+// after frame interval; controller handles commands one by one, so a report
+// is never ready before the one queued earlier.
+// nExtraDelayUS: Processing time of command (ex: flash write)
+
+void CI2CHIDSimulatorGet::QueueResponse(unsigned char* pszData, int nDataLen, unsigned int nExtraDelayUS)
+{
+    unsigned int nTail = 0;
+    unsigned long long ullReadyUS = 0;
+
+    if (nDataLen > (ELAN_I2CHID_INPUT_BUFFER_SIZE - 2))
+        nDataLen = ELAN_I2CHID_INPUT_BUFFER_SIZE - 2;
+
+    ullReadyUS = get_monotonic_time_us() + m_config.nResponseDelayUS + nExtraDelayUS;
+    if ((m_nReportQueueCount != 0) && (ullReadyUS < (m_ullLastReadyUS + m_config.nFrameIntervalUS)))
+        ullReadyUS = m_ullLastReadyUS + m_config.nFrameIntervalUS;
+
+    if (m_nReportQueueCount == (unsigned int)SIMULATOR_REPORT_QUEUE_SIZE)
+    {
+        // Drop the oldest report
+        DBG("%s: Report queue full, drop the oldest report.", __func__);
+        m_nReportQueueHead = (m_nReportQueueHead + 1) % SIMULATOR_REPORT_QUEUE_SIZE;
+        m_nReportQueueCount--;
+    }
+
+    nTail = (m_nReportQueueHead + m_nReportQueueCount) % SIMULATOR_REPORT_QUEUE_SIZE;
+    memset(m_szReportQueue[nTail], 0, ELAN_I2CHID_INPUT_BUFFER_SIZE);
+    m_szReportQueue[nTail][0] = ELAN_HID_INPUT_REPORT_ID;
+    m_szReportQueue[nTail][1] = (unsigned char)nDataLen;
+    memcpy(&m_szReportQueue[nTail][2], pszData, nDataLen);
+    m_ullReportReadyUS[nTail] = ullReadyUS;
+    m_nReportQueueCount++;
+    m_ullLastReadyUS = ullReadyUS;
+
+    return;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDSimulatorGet::QueueVersionResponse()
+// Get Info. response: 0x52 TVVV VVVV VVV1 (T: type nibble, V: 16-bit version)
+
+void CI2CHIDSimulatorGet::QueueVersionResponse(unsigned char ucType, unsigned short usVersion)
+{
+    unsigned char szData[4] = {0};
+
+    szData[0] = 0x52;
+    szData[1] = (unsigned char)(((ucType & 0x0F) << 4) | ((usVersion & 0xF000) >> 12));
+    szData[2] = (unsigned char) ((usVersion & 0x0FF0) >> 4);
+    szData[3] = (unsigned char)(((usVersion & 0x000F) << 4) | 0x01);
+
+    QueueResponse(szData, sizeof(szData), 0);
+
+    return;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDSimulatorGet::NextReport()
+// Take the earliest report ready at ullNowUS (response or injected finger report)
+// Return TP_SUCCESS if taken, TP_ERR_TIMEOUT if next report not ready yet
+// (ready time in *p_ullReadyUS), TP_ERR_DATA_NOT_FOUND if nothing in flight.
+
+int CI2CHIDSimulatorGet::NextReport(unsigned char* pszReport, unsigned long long ullNowUS, unsigned long long* p_ullReadyUS)
+{
+    unsigned long long ullResponseReadyUS = 0,
+                       ullTouchPeriodUS = 0;
+    bool bResponse = (m_nReportQueueCount != 0),
+         bTouch = (m_ullNextTouchUS != 0);
+
+    *p_ullReadyUS = 0;
+
+    if ((bResponse == false) && (bTouch == false))
+        return TP_ERR_DATA_NOT_FOUND;
+
+    // hidraw keeps limited reports, finger reports not read in time are lost
+    if (bTouch == true)
+    {
+        ullTouchPeriodUS = 1000000ULL / m_config.nTouchReportHz;
+        if ((m_ullNextTouchUS + (ullTouchPeriodUS * SIMULATOR_HIDRAW_QUEUE_MAX)) < ullNowUS)
+            m_ullNextTouchUS = ullNowUS - (ullTouchPeriodUS * (SIMULATOR_HIDRAW_QUEUE_MAX - 1));
+    }
+
+    if (bResponse == true)
+        ullResponseReadyUS = m_ullReportReadyUS[m_nReportQueueHead];
+
+    if ((bTouch == true) && ((bResponse == false) || (m_ullNextTouchUS < ullResponseReadyUS)))
+    {
+        if (m_ullNextTouchUS > ullNowUS)
+        {
+            *p_ullReadyUS = m_ullNextTouchUS;
+            return TP_ERR_TIMEOUT;
+        }
+
+        BuildTouchReport(pszReport);
+        m_ullNextTouchUS += ullTouchPeriodUS;
+        return TP_SUCCESS;
+    }
+
+    if (ullResponseReadyUS > ullNowUS)
+    {
+        *p_ullReadyUS = ullResponseReadyUS;
+        return TP_ERR_TIMEOUT;
+    }
+
+    memcpy(pszReport, m_szReportQueue[m_nReportQueueHead], ELAN_I2CHID_INPUT_BUFFER_SIZE);
+    m_nReportQueueHead = (m_nReportQueueHead + 1) % SIMULATOR_REPORT_QUEUE_SIZE;
+    m_nReportQueueCount--;
+
+    return TP_SUCCESS;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// CI2CHIDSimulatorGet::BuildTouchReport()
+// Finger report: 0x01 TIP CONTACT_ID X_L X_H Y_L Y_H ... CONTACT_COUNT
+// One finger drawing short strokes across the panel. Each stroke takes a new
+// contact ID (tracking ID, 0x00 ~ 0xFF), and coordinates sweep every byte value,
+// so payloads look like response headers (0x52, 0x99, ...) from time to time.
+
+void CI2CHIDSimulatorGet::BuildTouchReport(unsigned char* pszReport)
+{
+    unsigned short usPosX = (unsigned short)((m_nTouchReportIndex * 37) & 0x0FFF),
+                   usPosY = (unsigned short)((m_nTouchReportIndex * 23 + 0x0800) & 0x0FFF);
+
+    memset(pszReport, 0, ELAN_I2CHID_INPUT_BUFFER_SIZE);
+    pszReport[0] = ELAN_HID_FINGER_REPORT_ID;
+    pszReport[1] = 0x03; // Tip Switch & In Range
+    pszReport[2] = (unsigned char)((m_nTouchReportIndex / SIMULATOR_TOUCH_STROKE_REPORTS) & 0xFF); // Contact ID
+    pszReport[3] = (unsigned char) (usPosX & 0x00FF);
+    pszReport[4] = (unsigned char)((usPosX & 0xFF00) >> 8);
+    pszReport[5] = (unsigned char) (usPosY & 0x00FF);
+    pszReport[6] = (unsigned char)((usPosY & 0xFF00) >> 8);
+    pszReport[ELAN_I2CHID_INPUT_BUFFER_SIZE - 1] = 0x01; // Contact Count
+
+    m_nTouchReportIndex++;
+
+    return;
+}
@@ -12,12 +12,27 @@
 #include <stdint.h>
 #include <string.h>
 #include <getopt.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <signal.h>		/* sigaction */
+#include <linux/input.h>	/* BUS_TYPE */
 #include "I2CHIDLinuxGet.h"
+#include "I2CHIDSimulatorGet.h"
+#include "I2CHIDReplayGet.h"
+#include "ElanTsLogUtility.h"
 #include "ElanTsI2chidUtility.h"
 #include "ElanTsFuncApi.h"
 #include "ElanTsHidDevUtility.h"
 #include "ElanTsEdidUtility.h"
 #include "ElanTsLcmDevUtility.h"
+#include "ElanTsDefaultFwidMappingUtility.h"
+#include "ElanTsFwidCacheUtility.h"
+#include "ElanTsTimeUtility.h"
+#include "ElanTsRetryUtility.h"
+#include "ElanTsDaemonUtility.h"
+#include "ElanTsUeventUtility.h"
+#include "ElanTsUhidUtility.h"
+#include "ElanTsProfileUtility.h"
 #include "ElanGen8TsI2chidHwParameters.h"
 #include "ElanGen8TsFuncApi.h"
 
@@ -40,10 +55,142 @@
 #define ERROR_RETRY_COUNT	3
 #endif //ERROR_RETRY_COUNT
 
+// Worker Threads of Multi-Device Mode
+#ifndef MULTI_DEVICE_THREAD_MAX
+#define MULTI_DEVICE_THREAD_MAX	4
+#endif //MULTI_DEVICE_THREAD_MAX
+
+// Touch Controllers Tracked by Watch Mode
+#ifndef WATCH_DEVICE_MAX
+#define WATCH_DEVICE_MAX			8
+#endif //WATCH_DEVICE_MAX
+
+// Interval to Check Stop Request while Waiting for Uevent
+#ifndef WATCH_POLL_INTERVAL_MSEC
+#define WATCH_POLL_INTERVAL_MSEC	500
+#endif //WATCH_POLL_INTERVAL_MSEC
+
+// Time for udev to Set up hidraw Node after "add" Uevent
+#ifndef WATCH_DEVICE_SETTLE_MSEC
+#define WATCH_DEVICE_SETTLE_MSEC	100
+#endif //WATCH_DEVICE_SETTLE_MSEC
+
 /*******************************************
  * Data Structure Declaration
  ******************************************/
 
+// Execution Phase
+enum phase_id
+{
+    PHASE_RESOURCE_INIT = 0,
+    PHASE_OPEN_DEVICE,
+    PHASE_PANEL_INFO,
+    PHASE_FWID_CACHE,
+    PHASE_TOUCH_INFO,
+    PHASE_HELLO_PACKET,		// Part of PHASE_TOUCH_INFO
+    PHASE_BC_VERSION,		// Part of PHASE_TOUCH_INFO
+    PHASE_INFO_FWID,		// Part of PHASE_TOUCH_INFO
+    PHASE_SYSTEM_INFO,
+    PHASE_MAPPING_FILE,		// Part of PHASE_SYSTEM_INFO
+    PHASE_OUTPUT,
+    PHASE_COUNT
+};
+
+// System Info. Task: Panel EDID & HID Device / Mapping File, No Touch Controller I/O
+typedef struct system_info_task
+{
+    // Worker Thread (Concurrent Mode)
+    pthread_t thread;
+    bool thread_started;
+    sem_t panel_info_ready;		// Posted by Worker after Panel Info.
+    bool panel_info_taken;		// Panel Info. Waited for (or Read in Serial Mode) by Main Thread
+    bool cache_hit;				// Serial Mode Only: Worker Always Loads Mapping File, Discarded on Hit
+
+    // Panel Info.
+    int panel_info_err;
+    bool edid_info_found;
+    unsigned short edid_manufacturer_code;
+    unsigned short edid_product_code;
+
+    // System Info.
+    int system_info_err;
+    struct hidraw_devinfo *p_hid_dev_info;
+    size_t hid_dev_info_size;
+    struct lcm_dev_table *p_lcm_dev_table;
+} SYSTEM_INFO_TASK, *PSYSTEM_INFO_TASK;
+
+// Multi-Device Task: Touch Info. of One Touch Controller, Run on Thread Pool with Its Own Device Handle
+typedef struct multi_device_task
+{
+    struct hid_dev_entry dev_entry;
+
+    int err;
+    unsigned char hello_packet;
+    unsigned short fw_bc_version;
+    unsigned short bc_bc_version;
+    bool gen8_touch;
+    bool recovery;
+    unsigned short info_fwid;
+    unsigned long long elapsed_us;
+} MULTI_DEVICE_TASK, *PMULTI_DEVICE_TASK;
+
+// Daemon State: Controller Identity & Panel Resolved Once, Queries Answered from Memory
+typedef struct daemon_state
+{
+    // Touch Info.
+    unsigned char hello_packet;
+    unsigned short fw_bc_version;
+    unsigned short bc_bc_version;
+    bool gen8_touch;
+    bool recovery;
+    unsigned short info_fwid;
+
+    // Panel Info.
+    bool edid_info_found;
+    unsigned short edid_manufacturer_code;
+    unsigned short edid_product_code;
+
+    // System Info.
+    struct hidraw_devinfo *p_hid_dev_info;
+    size_t hid_dev_info_size;
+    struct lcm_dev_table *p_lcm_dev_table;
+
+    unsigned long requests;
+} DAEMON_STATE, *PDAEMON_STATE;
+
+// Watch Mode: Last Known State of Touch Controllers & Panel, Updated per Uevent
+typedef struct watch_device
+{
+    bool valid;
+    char path[64];
+    unsigned short pid;
+    int err;
+    bool recovery;
+    unsigned short info_fwid;
+} WATCH_DEVICE, *PWATCH_DEVICE;
+
+typedef struct watch_state
+{
+    struct watch_device devices[WATCH_DEVICE_MAX];
+
+    // Panel Info.
+    bool edid_info_found;
+    unsigned short edid_manufacturer_code;
+    unsigned short edid_product_code;
+
+    struct lcm_dev_table *p_lcm_dev_table;
+    unsigned long events;
+} WATCH_STATE, *PWATCH_STATE;
+
+// Thread Pool of Multi-Device Mode (Workers Take Next Task until All Done)
+typedef struct multi_device_pool
+{
+    struct multi_device_task *p_tasks;
+    int task_count;
+    int next_task;
+    pthread_mutex_t mutex;
+} MULTI_DEVICE_POOL, *PMULTI_DEVICE_POOL;
+
 /*******************************************
  * Global Variables Declaration
  ******************************************/
@@ -51,16 +198,8 @@
 // Debug
 bool g_debug = false;
 
-#ifndef DEBUG_PRINTF
-#define DEBUG_PRINTF(fmt, argv...) if(g_debug) printf(fmt, ##argv)
-#endif //DEBUG_PRINTF
-
-#ifndef ERROR_PRINTF
-#define ERROR_PRINTF(fmt, argv...) fprintf(stderr, fmt, ##argv)
-#endif //ERROR_PRINTF
-
-// InterfaceGet Class
-CI2CHIDLinuxGet *g_pIntfGet = NULL;		// Pointer to I2CHID Inteface Class (CI2CHIDLinuxGet)
+// InterfaceGet Class (Per Thread, Each Worker of Multi-Device Mode Owns a Handle)
+__thread CI2CHIDLinuxGet *g_pIntfGet = NULL;		// Pointer to I2CHID Inteface Class (CI2CHIDLinuxGet)
 
 // Validate Touchscreen Device
 bool g_validate_dev = false;
@@ -74,6 +213,16 @@ bool g_lookup_fwid = false;
 // FWID Mapping Table
 char g_fwid_mapping_file_path[FILE_NAME_LENGTH_MAX] = {0};
 
+// DRM sysfs Root for Panel EDID
+char g_drm_sysfs_root[FILE_NAME_LENGTH_MAX] = DRM_SYSFS_ROOT;
+
+// FWID Resolution Cache
+bool g_fwid_cache = false;
+char g_fwid_cache_file_path[FILE_NAME_LENGTH_MAX] = {0};
+
+// Revalidate FWID Resolution Cache
+bool g_revalidate_cache = false;
+
 // System Inforamtion
 bool g_show_system_info = false;
 
@@ -83,21 +232,101 @@ system_type g_system_type = UNKNOWN;
 // Silent Mode (Quiet)
 bool g_silent_mode = false;
 
+// Compile FWID Mapping Table into Binary Image
+bool g_compile_mapping = false;
+
+// Benchmark
+char g_benchmark[SYSTEM_NAME_LENGTH] = {0};
+
+// Concurrent Mode (Panel & Mapping Resolution on Worker Thread)
+bool g_concurrent = false;
+
+// Multi-Device Mode (All Elan Touch Controllers, in Parallel)
+bool g_multi_device = false;
+
+// Watch Mode (Hotplug Uevents) & Replay of Recorded Uevents
+bool g_watch = false;
+bool g_uevent_replay = false;
+char g_uevent_replay_file_path[FILE_NAME_LENGTH_MAX] = {0};
+volatile sig_atomic_t g_watch_stop = 0;
+
+// Daemon Mode (Answer Queries over Unix Domain Socket) & Client Mode
+bool g_daemon = false;
+bool g_daemon_query = false;
+char g_daemon_socket_path[FILE_NAME_LENGTH_MAX] = DAEMON_SOCKET_PATH;
+char g_daemon_request[DAEMON_MESSAGE_LENGTH_MAX] = {0};
+
+// Simulated Touch Controller (Benchmark Protocol Layer without Panel)
+bool g_simulator = false;
+char g_simulator_config[FILE_NAME_LENGTH_MAX] = {0};
+
+// Virtual Device through uhid (Simulated Touch Controller behind Kernel hidraw)
+bool g_uhid = false;
+char g_uhid_config[FILE_NAME_LENGTH_MAX] = {0};
+struct uhid_standin g_uhid_standin;
+
+// HID Transaction Trace (Record Reports of Device / Replay Recorded Reports instead of Device)
+bool g_trace_record = false;
+char g_trace_record_file_path[FILE_NAME_LENGTH_MAX] = {0};
+bool g_trace_replay = false;
+char g_trace_replay_file_path[FILE_NAME_LENGTH_MAX] = {0};
+unsigned int g_trace_replay_speed = REPLAY_SPEED_ORIGINAL;
+
+// Phase Timing
+unsigned long long g_start_time_us = 0;
+PHASE_TIMING g_phase_timing[PHASE_COUNT] =
+{
+    { "Resource Init",				0, 0},
+    { "Open Device",				0, 0},
+    { "Panel EDID",					0, 0},
+    { "FWID Cache",					0, 0},
+    { "Touch Controller",			0, 0},
+    { "Hello Packet",				0, 0},
+    { "BC Version",					0, 0},
+    { "Information FWID",			0, 0},
+    { "HID Device / Mapping File",	0, 0},
+    { "Mapping File",				0, 0},
+    { "Output",						0, 0},
+};
+__thread bool g_phase_timing_enabled = true;	// Off on Multi-Device Workers (Phases Belong to Main Run Only)
+
+// Profile Report (Phase Timing & I/O Latency Histogram)
+bool g_profile = false;
+PROFILE_FORMAT g_profile_format = PROFILE_FORMAT_TABLE;
+
 // Help Info.
 bool g_help = false;
 
 // Parameter Option Settings
-const char* const short_options = "p:P:f:s:iqdh";
+const char* const short_options = "p:P:f:s:e:c:rCb:tMD:Q:WU:R:S:H:k:K:T::iqdh";
 const struct option long_options[] =
 {
     { "pid",				1, NULL, 'p'},
     { "pid_hex",			1, NULL, 'P'},
     { "mapping_file_path",	1, NULL, 'f'},
     { "system",				1, NULL, 's'},
+    { "drm_sysfs_root",		1, NULL, 'e'},
+    { "fwid_cache",			1, NULL, 'c'},
+    { "revalidate",			0, NULL, 'r'},
+    { "compile_mapping",	0, NULL, 'C'},
+    { "benchmark",			1, NULL, 'b'},
+    { "concurrent",			0, NULL, 't'},
+    { "multi_device",		0, NULL, 'M'},
+    { "daemon",				1, NULL, 'D'},
+    { "query",				1, NULL, 'Q'},
+    { "watch",				0, NULL, 'W'},
+    { "uevent_replay",		1, NULL, 'U'},
+    { "retry_policy",		1, NULL, 'R'},
+    { "simulator",			1, NULL, 'S'},
+    { "uhid",				1, NULL, 'H'},
+    { "trace_record",		1, NULL, 'k'},
+    { "trace_replay",		1, NULL, 'K'},
+    { "profile",			2, NULL, 'T'},
     { "dev_info",			0, NULL, 'i'},
     { "quiet",				0, NULL, 'q'},
     { "debug",				0, NULL, 'd'},
     { "help",				0, NULL, 'h'},
+    { 0,					0, 0,	 0},
 };
 
 /*******************************************
@@ -110,17 +339,73 @@ int show_info_fwid(unsigned short info_fwid);
 // FWID
 int show_fwid(system_type system, unsigned short fwid, bool silent_mode);
 
-// System Info. (HID Device / Panel EDID / LCM Device)
+// Touch Info. (Hello Packet / BC Version / Information FWID)
+int get_touch_info(unsigned char *p_hello_packet, unsigned short *p_fw_bc_version, unsigned short *p_bc_bc_version, \
+                   bool *p_gen8_touch, bool *p_recovery, unsigned short *p_info_fwid);
+
+// Panel Info. (Panel EDID)
+int get_panel_info(unsigned short *p_edid_manufacturer_code, unsigned short *p_edid_product_code, bool *p_edid_info_found);
+
+// System Info. (HID Device / LCM Device)
 int get_system_info(struct hidraw_devinfo *p_hid_dev_info, size_t hid_dev_info_size, \
-                    unsigned short *p_edid_manufacturer_code, unsigned short *p_edid_product_code, \
                     char* p_fwid_mapping_file_path, size_t fwid_mapping_file_path_size, \
-                    struct lcm_dev_info *p_lcm_dev_info, size_t lcm_dev_info_size);
+                    struct lcm_dev_table *p_lcm_dev_table);
+
+// FWID Resolution Cache
+int lookup_fwid_cache(struct system_info_task *p_task, struct fwid_cache_key *p_cache_key, struct fwid_cache_data *p_cache_data);
+int update_fwid_cache(struct fwid_cache_key *p_cache_key, unsigned char hello_packet, \
+                      unsigned short fw_bc_version, unsigned short bc_bc_version, bool gen8_touch, bool recovery, \
+                      unsigned short info_fwid, bool edid_info_found, unsigned short edid_manufacturer_code, unsigned short edid_product_code, \
+                      struct lcm_dev_table *p_lcm_dev_table);
 
 int show_system_info(struct hidraw_devinfo *p_hid_dev_info, size_t hid_dev_info_size, \
                      bool edid_info_found, unsigned short edid_manufacturer_code, unsigned short edid_product_code, \
-                     bool lookup_fwid, struct lcm_dev_info *p_lcm_dev_info, size_t lcm_dev_info_size, \
+                     bool lookup_fwid, struct lcm_dev_table *p_lcm_dev_table, \
                      unsigned short info_fwid);
 
+// System Info. Task
+int run_panel_info_task(struct system_info_task *p_task);
+int take_panel_info(struct system_info_task *p_task);
+int run_system_info_task(struct system_info_task *p_task);
+void *system_info_task_routine(void *p_arg);
+int start_system_info_task(struct system_info_task *p_task);
+void stop_system_info_task(struct system_info_task *p_task);
+
+// Multi-Device Mode
+bool is_elan_touch_device(const struct hid_dev_entry *p_entry);
+int find_elan_touch_devices(struct multi_device_task *p_tasks, int task_max, int *p_task_count);
+int run_multi_device_task(struct multi_device_task *p_task);
+void *multi_device_worker_routine(void *p_arg);
+int run_multi_device(void);
+
+// Daemon Mode & Client Mode
+int handle_daemon_request(const char *p_request, char *p_response, size_t response_size, void *p_context);
+int run_daemon(struct daemon_state *p_state);
+int run_daemon_query(void);
+
+// Watch Mode
+void watch_signal_handler(int signal_number);
+unsigned short resolve_watch_fwid(struct watch_state *p_state, unsigned short info_fwid);
+void emit_watch_device_event(struct watch_state *p_state, const char *p_action, struct watch_device *p_device);
+int resolve_watch_device(struct watch_state *p_state, const struct hid_dev_entry *p_entry, const char *p_action);
+int get_replay_hid_dev_entry(const struct uevent_message *p_message, struct hid_dev_entry *p_entry);
+int get_replay_panel_info(const struct uevent_message *p_message, unsigned short *p_edid_manufacturer_code, unsigned short *p_edid_product_code, bool *p_edid_info_found);
+int handle_hidraw_uevent(struct watch_state *p_state, const struct uevent_message *p_message);
+int handle_drm_uevent(struct watch_state *p_state, const struct uevent_message *p_message);
+int handle_uevent(struct watch_state *p_state, const struct uevent_message *p_message);
+int run_watch(void);
+
+// Phase Timing
+void begin_phase(phase_id phase);
+void end_phase(phase_id phase);
+void show_phase_timing(void);
+
+// Report Statistics
+void show_report_statistics(void);
+
+// Retry Statistics
+void show_retry_statistics(void);
+
 // Help
 void show_help_information(void);
 
@@ -130,8 +415,15 @@ int __hidraw_read(unsigned char* buf, int len, int timeout_ms);
 
 // Abstract Device I/O Function
 int write_cmd(unsigned char *cmd_buf, int len, int timeout_ms);
+int write_pipelined_cmd(unsigned char *cmd_buf, int len, int timeout_ms);
 int read_data(unsigned char *data_buf, int len, int timeout_ms);
+int read_data_view(const unsigned char **pp_data, int len, int timeout_ms);
+void release_data_view(const unsigned char *p_data);
 int write_vendor_cmd(unsigned char *cmd_buf, int len, int timeout_ms);
+int drain_input_reports(void);
+int set_read_deadline(int timeout_ms);
+int clear_read_deadline(void);
+int get_last_read_latency(unsigned long long *p_latency_us);
 int open_device(void);
 int close_device(void);
 
@@ -209,6 +501,22 @@ __HIDRAW_READ_EXIT:
     return nRet;
 }
 
+int __hidraw_read_data_view(const unsigned char** pp_buf, int len, int timeout_ms)
+{
+    int nRet = TP_SUCCESS;
+
+    if(g_pIntfGet == NULL)
+    {
+        nRet = TP_ERR_COMMAND_NOT_SUPPORT;
+        goto __HIDRAW_READ_EXIT;
+    }
+
+    nRet = g_pIntfGet->ReadDataView(pp_buf, len, timeout_ms, 0, true);
+
+__HIDRAW_READ_EXIT:
+    return nRet;
+}
+
 /***************************************************
  * Abstract I/O Functions
  ***************************************************/
@@ -218,10 +526,19 @@ int write_cmd(unsigned char *cmd_buf, int len, int timeout_ms)
     //write_bytes_from_buffer_to_i2c(cmd_buf); //pseudo function
 
     /*** example *********************/
+    // Drop Stale Reports, so Data Read Next is Reply of This Command
+    drain_input_reports();
+
     return __hidraw_write_command(cmd_buf, len, timeout_ms);
     /*********************************/
 }
 
+int write_pipelined_cmd(unsigned char *cmd_buf, int len, int timeout_ms)
+{
+    // No Drain: Replies of Earlier Commands in the Pipeline are Still Pending
+    return __hidraw_write_command(cmd_buf, len, timeout_ms);
+}
+
 int read_data(unsigned char *data_buf, int len, int timeout_ms)
 {
     //read_bytes_from_i2c_to_buffer(data_buf, len, timeout); //pseudo function
@@ -231,6 +548,20 @@ int read_data(unsigned char *data_buf, int len, int timeout_ms)
     /*********************************/
 }
 
+int read_data_view(const unsigned char **pp_data, int len, int timeout_ms)
+{
+    // Response Data Stays in Report Slot of Interface until release_data_view()
+    return __hidraw_read_data_view(pp_data, len, timeout_ms);
+}
+
+void release_data_view(const unsigned char *p_data)
+{
+    if(g_pIntfGet != NULL)
+        g_pIntfGet->ReleaseReportView(p_data);
+
+    return;
+}
+
 int write_vendor_cmd(unsigned char *cmd_buf, int len, int timeout_ms)
 {
     unsigned char vendor_cmd_buf[ELAN_I2CHID_OUTPUT_BUFFER_SIZE] = {0};
@@ -239,9 +570,79 @@ int write_vendor_cmd(unsigned char *cmd_buf, int len, int timeout_ms)
     vendor_cmd_buf[0] = ELAN_HID_OUTPUT_REPORT_ID;
     memcpy(&vendor_cmd_buf[1], cmd_buf, len);
 
+    // Drop Stale Reports, so Data Read Next is Reply of This Command
+    drain_input_reports();
+
     return __hidraw_write(vendor_cmd_buf, sizeof(vendor_cmd_buf), timeout_ms);
 }
 
+int drain_input_reports(void)
+{
+    int err = TP_SUCCESS;
+    unsigned long discarded_reports = 0;
+
+    if(g_pIntfGet == NULL)
+    {
+        err = TP_ERR_COMMAND_NOT_SUPPORT;
+        goto DRAIN_INPUT_REPORTS_EXIT;
+    }
+
+    err = g_pIntfGet->DrainInputReports(&discarded_reports);
+    if(discarded_reports > 0)
+        DEBUG_PRINTF("%s: Discard %lu stale report(s).\r\n", __func__, discarded_reports);
+
+DRAIN_INPUT_REPORTS_EXIT:
+    return err;
+}
+
+int set_read_deadline(int timeout_ms)
+{
+    int err = TP_SUCCESS;
+
+    if(g_pIntfGet == NULL)
+    {
+        err = TP_ERR_COMMAND_NOT_SUPPORT;
+        goto SET_READ_DEADLINE_EXIT;
+    }
+
+    err = g_pIntfGet->SetReadDeadline(timeout_ms);
+
+SET_READ_DEADLINE_EXIT:
+    return err;
+}
+
+int clear_read_deadline(void)
+{
+    int err = TP_SUCCESS;
+
+    if(g_pIntfGet == NULL)
+    {
+        err = TP_ERR_COMMAND_NOT_SUPPORT;
+        goto CLEAR_READ_DEADLINE_EXIT;
+    }
+
+    err = g_pIntfGet->ClearReadDeadline();
+
+CLEAR_READ_DEADLINE_EXIT:
+    return err;
+}
+
+int get_last_read_latency(unsigned long long *p_latency_us)
+{
+    int err = TP_SUCCESS;
+
+    if(g_pIntfGet == NULL)
+    {
+        err = TP_ERR_COMMAND_NOT_SUPPORT;
+        goto GET_LAST_READ_LATENCY_EXIT;
+    }
+
+    err = g_pIntfGet->GetLastReadLatency(p_latency_us);
+
+GET_LAST_READ_LATENCY_EXIT:
+    return err;
+}
+
 /*******************************************
  * Function Implementation
  ******************************************/
@@ -284,63 +685,139 @@ SHOW_FWID_EXIT:
     return err;
 }
 
-// System Info. (HID Device / Panel EDID / LCM Device)
-int get_system_info(struct hidraw_devinfo *p_hid_dev_info, size_t hid_dev_info_size, \
-                    unsigned short *p_edid_manufacturer_code, unsigned short *p_edid_product_code, bool *p_edid_info_found, \
-                    char* p_fwid_mapping_file_path, size_t fwid_mapping_file_path_size, \
-                    struct lcm_dev_info *p_lcm_dev_info, size_t lcm_dev_info_size)
+// Touch Info. (Hello Packet / BC Version / Information FWID)
+int get_touch_info(unsigned char *p_hello_packet, unsigned short *p_fw_bc_version, unsigned short *p_bc_bc_version, \
+                   bool *p_gen8_touch, bool *p_recovery, unsigned short *p_info_fwid)
 {
     int err = TP_SUCCESS;
-    bool edid_info_found = false;
-    FILE *p_fd_fwid_mapping_file = NULL;
+    bool recovery = false,		// True if Recovery Mode
+         gen8_touch = false;	// True if Gen8 Touch
+    unsigned char hello_packet = 0;
+    unsigned short fw_bc_version = 0,
+                   bc_bc_version = 0,
+                   info_fwid = 0;
 
-    // Validate HID Device Buffer
-    if((p_hid_dev_info == NULL) || (hid_dev_info_size == 0))
+    // Validate Input Parameter
+    if((p_hello_packet == NULL) || (p_fw_bc_version == NULL) || (p_bc_bc_version == NULL) || \
+       (p_gen8_touch == NULL) || (p_recovery == NULL) || (p_info_fwid == NULL))
     {
-        ERROR_PRINTF("%s: Invalid HID Device Buffer! (p_hid_dev_info=0x%p, hid_dev_info_size=%ld)\r\n", \
-                     __func__, p_hid_dev_info, hid_dev_info_size);
+        ERROR_PRINTF("%s: NULL Pointer!\r\n", __func__);
         err = TP_ERR_INVALID_PARAM;
-        goto GET_SYSTEM_INFO_EXIT;
+        goto GET_TOUCH_INFO_EXIT;
     }
 
-    // Validate Panel EDID Info.
-    if((p_edid_manufacturer_code == NULL) || (p_edid_product_code == NULL) || (p_edid_info_found == NULL))
+    /* Detect Touch State */
+
+    // Get Hello Packet (Cached in Session)
+    begin_phase(PHASE_HELLO_PACKET);
+    err = get_session_hello_packet_bc_version(&hello_packet, &bc_bc_version, ERROR_RETRY_COUNT);
+    end_phase(PHASE_HELLO_PACKET);
+    if(err != TP_SUCCESS)
     {
-        ERROR_PRINTF("%s: Invalid Panel EDID Data Buffer! (p_edid_manufacturer_code=0x%p, p_edid_product_code=0x%p, p_edid_info_found=0x%p)\r\n", \
-                     __func__, p_edid_manufacturer_code, p_edid_product_code, p_edid_info_found);
-        err = TP_ERR_INVALID_PARAM;
-        goto GET_SYSTEM_INFO_EXIT;
+        ERROR_PRINTF("Fail to Get Hello Packet (& BC Version)! err=0x%x.\r\n", err);
+        goto GET_TOUCH_INFO_EXIT;
     }
+    DEBUG_PRINTF("Hello Packet: 0x%02x, Recovery Mode BC Version: 0x%04x.\r\n", hello_packet, bc_bc_version);
 
-    // Validate FWID Mapping Table File Path
-    if((p_fwid_mapping_file_path == NULL) || (fwid_mapping_file_path_size == 0))
+    // Identify HW Series & Touch State
+    switch (hello_packet)
     {
-        ERROR_PRINTF("%s: Invalid FWID Mapping Table File Path! (p_fwid_mapping_file_path=0x%p, fwid_mapping_file_path_size=%ld)\r\n", \
-                     __func__, p_fwid_mapping_file_path, fwid_mapping_file_path_size);
-        err = TP_ERR_INVALID_PARAM;
-        goto GET_SYSTEM_INFO_EXIT;
+        case ELAN_I2CHID_NORMAL_MODE_HELLO_PACKET:
+            // BC Version (Normal Mode, Cached in Session)
+            begin_phase(PHASE_BC_VERSION);
+            err = get_session_boot_code_version(&fw_bc_version);
+            end_phase(PHASE_BC_VERSION);
+            if(err != TP_SUCCESS)
+            {
+                ERROR_PRINTF("%s: Fail to Get BC Version (Normal Mode)! err=0x%x.\r\n", __func__, err);
+                goto GET_TOUCH_INFO_EXIT;
+            }
+            DEBUG_PRINTF("Normal Mode BC Version: 0x%04x.\r\n", fw_bc_version);
+
+            // Special Case: First BC of EM32F901 / EM32F902
+            if((HIGH_BYTE(fw_bc_version) == BC_VER_H_BYTE_FOR_EM32F901_I2CHID) /* EM32F901 */ ||
+               (HIGH_BYTE(fw_bc_version) == BC_VER_H_BYTE_FOR_EM32F902_I2CHID) /* FM32F902 */)
+                gen8_touch = true;	// Gen8 Touch
+            else
+                gen8_touch = false;	// Gen5/6/7 Touch
+            recovery = false;		// Normal Mode
+            break;
+
+        case ELAN_GEN8_I2CHID_NORMAL_MODE_HELLO_PACKET:
+            gen8_touch = true;		// Gen8 Touch
+            recovery = false;		// Normal Mode
+            break;
+
+        case ELAN_I2CHID_RECOVERY_MODE_HELLO_PACKET:
+            // Special Case: First BC of EM32F901 / EM32F902
+            if((HIGH_BYTE(bc_bc_version) == BC_VER_H_BYTE_FOR_EM32F901_I2CHID) /* EM32F901 */ ||
+               (HIGH_BYTE(bc_bc_version) == BC_VER_H_BYTE_FOR_EM32F902_I2CHID) /* FM32F902 */)
+                gen8_touch = true;	// Gen8 Touch
+            else
+                gen8_touch = false;	// Gen5/6/7 Touch
+            recovery = true;		// Recovery Mode
+            break;
+
+        case ELAN_GEN8_I2CHID_RECOVERY_MODE_HELLO_PACKET:
+            gen8_touch = true;		// Gen8 Touch
+            recovery = true;		// Recovery Mode
+            break;
+
+        default:
+            ERROR_PRINTF("%s: Unknown Hello Packet! (0x%02x) \r\n", __func__, hello_packet);
+            err = TP_UNKNOWN_DEVICE_TYPE;
+            goto GET_TOUCH_INFO_EXIT;
     }
 
-    // Validate LCM Device Buffer
-    if((p_lcm_dev_info == NULL) || (lcm_dev_info_size == 0))
+    /* Read Information FWID */
+    begin_phase(PHASE_INFO_FWID);
+    if(gen8_touch) // Gen8 Touch
+        err = gen8_read_info_fwid(&info_fwid, recovery);
+    else // Gen5/6/7 Touch
+        err = read_info_fwid(&info_fwid, recovery);
+    end_phase(PHASE_INFO_FWID);
+    if (err != TP_SUCCESS)
     {
-        ERROR_PRINTF("%s: Invalid LCM Device Buffer! (p_lcm_dev_info=0x%p, lcm_dev_info_size=%ld)\r\n", \
-                     __func__, p_lcm_dev_info, lcm_dev_info_size);
-        err = TP_ERR_INVALID_PARAM;
-        goto GET_SYSTEM_INFO_EXIT;
+        ERROR_PRINTF("Fail to Read Information FWID! err=0x%x.\r\n", err);
+        goto GET_TOUCH_INFO_EXIT;
     }
 
-    // Get HID Device Info.
-    err = get_hid_dev_info(p_hid_dev_info, hid_dev_info_size);
-    if(err != TP_SUCCESS)
+    *p_hello_packet = hello_packet;
+    *p_fw_bc_version = fw_bc_version;
+    *p_bc_bc_version = bc_bc_version;
+    *p_gen8_touch = gen8_touch;
+    *p_recovery = recovery;
+    *p_info_fwid = info_fwid;
+
+    // Success
+    err = TP_SUCCESS;
+
+GET_TOUCH_INFO_EXIT:
+    return err;
+}
+
+// Panel Info. (Panel EDID)
+int get_panel_info(unsigned short *p_edid_manufacturer_code, unsigned short *p_edid_product_code, bool *p_edid_info_found)
+{
+    int err = TP_SUCCESS;
+    bool edid_info_found = false;
+
+    // Validate Panel EDID Info.
+    if((p_edid_manufacturer_code == NULL) || (p_edid_product_code == NULL) || (p_edid_info_found == NULL))
     {
-        ERROR_PRINTF("%s: Fail to Get HID Dev Info.! err=0x%x.\r\n", __func__, err);
-        goto GET_SYSTEM_INFO_EXIT;
+        ERROR_PRINTF("%s: Invalid Panel EDID Data Buffer! (p_edid_manufacturer_code=0x%p, p_edid_product_code=0x%p, p_edid_info_found=0x%p)\r\n", \
+                     __func__, p_edid_manufacturer_code, p_edid_product_code, p_edid_info_found);
+        err = TP_ERR_INVALID_PARAM;
+        goto GET_PANEL_INFO_EXIT;
     }
 
     // Get EDID Manufacturer Code & Product Code
-    err = get_edid_manufacturer_product_code(p_edid_manufacturer_code, p_edid_product_code);
-    if (err != TP_SUCCESS)
+    err = get_edid_manufacturer_product_code(g_drm_sysfs_root, p_edid_manufacturer_code, p_edid_product_code);
+    if (err == TP_SUCCESS)
+    {
+        edid_info_found = true;
+    }
+    else
     {
         //ERROR_PRINTF("%s: Fail to get EDID manufacturer code & product code ! err=0x%x.\r\n", __func__, err);
         if(err == TP_ERR_DATA_NOT_FOUND)
@@ -355,50 +832,23 @@ int get_system_info(struct hidraw_devinfo *p_hid_dev_info, size_t hid_dev_info_s
         else // Other
         {
             edid_info_found = false;
-            goto GET_SYSTEM_INFO_EXIT;
+            goto GET_PANEL_INFO_EXIT;
         }
     }
-    edid_info_found = true;
     DEBUG_PRINTF("%s: EDID Info. Found? %s.\r\n", __func__, (edid_info_found) ? "true" : "false");
     *p_edid_info_found = edid_info_found;
 
-    // Get LCM Device Info.
-    if(strcmp(g_fwid_mapping_file_path, "") != 0) // File path has been configured
-    {
-        // Open FWID Mapping File
-        p_fd_fwid_mapping_file = fopen(p_fwid_mapping_file_path, "r");
-        DEBUG_PRINTF("%s: p_fd_fwid_mapping_file=0x%p.\r\n", __func__, p_fd_fwid_mapping_file);
-        if (p_fd_fwid_mapping_file == NULL)
-        {
-            ERROR_PRINTF("%s: Fail to open FWID mapping table file \"%s\"!\r\n", __func__, g_fwid_mapping_file_path);
-            err = TP_ERR_FILE_NOT_FOUND;
-            goto GET_SYSTEM_INFO_EXIT;
-        }
-
-        /* Parse FWID Mapping File */
-        err = parse_fwid_mapping_file(p_fd_fwid_mapping_file, p_lcm_dev_info, lcm_dev_info_size);
-        if (err != TP_SUCCESS)
-        {
-            ERROR_PRINTF("%s: Fail to parse FWID mapping file, err=%d.", __func__, err);
-            //goto GET_SYSTEM_INFO_EXIT;
-        }
-
-        // Close FWID Mapping File
-        fclose(p_fd_fwid_mapping_file);
-        p_fd_fwid_mapping_file = NULL;
-    }
-
     // Success
     err = TP_SUCCESS;
 
-GET_SYSTEM_INFO_EXIT:
+GET_PANEL_INFO_EXIT:
     return err;
 }
 
-int show_system_info(struct hidraw_devinfo *p_hid_dev_info, size_t hid_dev_info_size, \
-                     bool edid_info_found, unsigned short edid_manufacturer_code, unsigned short edid_product_code, \
-                     bool lookup_fwid, struct lcm_dev_info *p_lcm_dev_info, size_t lcm_dev_info_size, \
-                     unsigned short info_fwid)
+// System Info. (HID Device / LCM Device)
+int get_system_info(struct hidraw_devinfo *p_hid_dev_info, size_t hid_dev_info_size, \
+                    char* p_fwid_mapping_file_path, size_t fwid_mapping_file_path_size, \
+                    struct lcm_dev_table *p_lcm_dev_table)
 {
     int err = TP_SUCCESS;
 
@@ -408,31 +858,96 @@ int show_system_info(struct hidraw_devinfo *p_hid_dev_info, size_t hid_dev_info_
         ERROR_PRINTF("%s: Invalid HID Device Buffer! (p_hid_dev_info=0x%p, hid_dev_info_size=%ld)\r\n", \
                      __func__, p_hid_dev_info, hid_dev_info_size);
         err = TP_ERR_INVALID_PARAM;
-        goto SHOW_SYSTEM_INFO_EXIT;
+        goto GET_SYSTEM_INFO_EXIT;
     }
 
-    // Validate LCM Device Buffer
-    if((p_lcm_dev_info == NULL) || (lcm_dev_info_size == 0))
+    // Validate FWID Mapping Table File Path
+    if((p_fwid_mapping_file_path == NULL) || (fwid_mapping_file_path_size == 0))
     {
-        ERROR_PRINTF("%s: Invalid LCM Device Buffer! (p_lcm_dev_info=0x%p, lcm_dev_info_size=%ld)\r\n", \
-                     __func__, p_lcm_dev_info, lcm_dev_info_size);
+        ERROR_PRINTF("%s: Invalid FWID Mapping Table File Path! (p_fwid_mapping_file_path=0x%p, fwid_mapping_file_path_size=%ld)\r\n", \
+                     __func__, p_fwid_mapping_file_path, fwid_mapping_file_path_size);
         err = TP_ERR_INVALID_PARAM;
-        goto SHOW_SYSTEM_INFO_EXIT;
+        goto GET_SYSTEM_INFO_EXIT;
     }
 
-    // Show HID Device Info.
-    err = show_hid_dev_info(p_hid_dev_info, hid_dev_info_size);
-    if (err != TP_SUCCESS)
+    // Validate LCM Device Buffer
+    if(p_lcm_dev_table == NULL)
     {
-        ERROR_PRINTF("%s: Fail to show elan HID Device! err=0x%x.\r\n", __func__, err);
-        goto SHOW_SYSTEM_INFO_EXIT;
+        ERROR_PRINTF("%s: Invalid LCM Device Table! (p_lcm_dev_table=0x%p)\r\n", \
+                     __func__, p_lcm_dev_table);
+        err = TP_ERR_INVALID_PARAM;
+        goto GET_SYSTEM_INFO_EXIT;
     }
 
-    // SHow EDID Info.
-    if(edid_info_found == true) // EDID Info. Found
+    // Get HID Device Info.
+    err = get_hid_dev_info(p_hid_dev_info, hid_dev_info_size);
+    if(err != TP_SUCCESS)
     {
-        show_edid_manufacturer_product_code(edid_manufacturer_code, edid_product_code);
-    }
+        ERROR_PRINTF("%s: Fail to Get HID Dev Info.! err=0x%x.\r\n", __func__, err);
+        goto GET_SYSTEM_INFO_EXIT;
+    }
+
+    // Get LCM Device Info.
+    if(strcmp(g_fwid_mapping_file_path, "") != 0) // File path has been configured
+    {
+        /* Load FWID Mapping File (Binary Image if Up-to-Date, else Text) */
+        begin_phase(PHASE_MAPPING_FILE);
+        err = load_fwid_mapping_file(p_fwid_mapping_file_path, p_lcm_dev_table);
+        end_phase(PHASE_MAPPING_FILE);
+        if (err == TP_ERR_FILE_NOT_FOUND)
+            goto GET_SYSTEM_INFO_EXIT;
+        else if (err != TP_SUCCESS)
+        {
+            ERROR_PRINTF("%s: Fail to load FWID mapping file, err=%d.", __func__, err);
+            //goto GET_SYSTEM_INFO_EXIT;
+        }
+    }
+
+    // Success
+    err = TP_SUCCESS;
+
+GET_SYSTEM_INFO_EXIT:
+    return err;
+}
+
+int show_system_info(struct hidraw_devinfo *p_hid_dev_info, size_t hid_dev_info_size, \
+                     bool edid_info_found, unsigned short edid_manufacturer_code, unsigned short edid_product_code, \
+                     bool lookup_fwid, struct lcm_dev_table *p_lcm_dev_table, \
+                     unsigned short info_fwid)
+{
+    int err = TP_SUCCESS;
+
+    // Validate HID Device Buffer
+    if((p_hid_dev_info == NULL) || (hid_dev_info_size == 0))
+    {
+        ERROR_PRINTF("%s: Invalid HID Device Buffer! (p_hid_dev_info=0x%p, hid_dev_info_size=%ld)\r\n", \
+                     __func__, p_hid_dev_info, hid_dev_info_size);
+        err = TP_ERR_INVALID_PARAM;
+        goto SHOW_SYSTEM_INFO_EXIT;
+    }
+
+    // Validate LCM Device Buffer
+    if(p_lcm_dev_table == NULL)
+    {
+        ERROR_PRINTF("%s: Invalid LCM Device Table! (p_lcm_dev_table=0x%p)\r\n", \
+                     __func__, p_lcm_dev_table);
+        err = TP_ERR_INVALID_PARAM;
+        goto SHOW_SYSTEM_INFO_EXIT;
+    }
+
+    // Show HID Device Info.
+    err = show_hid_dev_info(p_hid_dev_info, hid_dev_info_size);
+    if (err != TP_SUCCESS)
+    {
+        ERROR_PRINTF("%s: Fail to show elan HID Device! err=0x%x.\r\n", __func__, err);
+        goto SHOW_SYSTEM_INFO_EXIT;
+    }
+
+    // SHow EDID Info.
+    if(edid_info_found == true) // EDID Info. Found
+    {
+        show_edid_manufacturer_product_code(edid_manufacturer_code, edid_product_code);
+    }
     else // EDID Info. Not Found
     {
         ERROR_PRINTF("%s: EDID Info. Not Found!\r\n", __func__);
@@ -441,7 +956,7 @@ int show_system_info(struct hidraw_devinfo *p_hid_dev_info, size_t hid_dev_info_
     // Show LCM Device Info.
     if(lookup_fwid == true) // Lookup FWID has been Requested
     {
-        err = show_lcm_dev_info(p_lcm_dev_info, lcm_dev_info_size);
+        err = show_lcm_dev_info(p_lcm_dev_table);
         if (err != TP_SUCCESS)
         {
             ERROR_PRINTF("%s: Fail to show LCM Device Information! err=0x%x.\r\n", __func__, err);
@@ -459,6 +974,1073 @@ SHOW_SYSTEM_INFO_EXIT:
     return err;
 }
 
+/*******************************************
+ * System Info. Task
+ ******************************************/
+
+int run_panel_info_task(struct system_info_task *p_task)
+{
+    begin_phase(PHASE_PANEL_INFO);
+    p_task->panel_info_err = get_panel_info(&p_task->edid_manufacturer_code, &p_task->edid_product_code, &p_task->edid_info_found);
+    end_phase(PHASE_PANEL_INFO);
+
+    return p_task->panel_info_err;
+}
+
+// Panel Info. where It is Needed: Wait for Worker (Concurrent Mode) or Read It Now (Serial Mode)
+int take_panel_info(struct system_info_task *p_task)
+{
+    if(p_task->panel_info_taken == true)
+        return p_task->panel_info_err;
+
+    if(p_task->thread_started == true)
+        sem_wait(&p_task->panel_info_ready);
+    else
+        run_panel_info_task(p_task);
+    p_task->panel_info_taken = true;
+
+    return p_task->panel_info_err;
+}
+
+int run_system_info_task(struct system_info_task *p_task)
+{
+    begin_phase(PHASE_SYSTEM_INFO);
+    if(p_task->cache_hit == true)
+    {
+        // Only HID Device Info. is Required for Device Validation
+        if(g_validate_dev == true)
+            p_task->system_info_err = get_hid_dev_info(p_task->p_hid_dev_info, p_task->hid_dev_info_size);
+        else
+            p_task->system_info_err = TP_SUCCESS;
+    }
+    else
+    {
+        p_task->system_info_err = get_system_info(p_task->p_hid_dev_info, p_task->hid_dev_info_size, \
+                                                  g_fwid_mapping_file_path, sizeof(g_fwid_mapping_file_path), \
+                                                  p_task->p_lcm_dev_table);
+    }
+    end_phase(PHASE_SYSTEM_INFO);
+
+    return p_task->system_info_err;
+}
+
+void *system_info_task_routine(void *p_arg)
+{
+    struct system_info_task *p_task = (struct system_info_task *)p_arg;
+
+    // Panel Info. (Required by FWID Cache Key)
+    run_panel_info_task(p_task);
+    sem_post(&p_task->panel_info_ready);
+    if(p_task->panel_info_err != TP_SUCCESS)
+        goto SYSTEM_INFO_TASK_ROUTINE_EXIT;
+
+    // HID Device & Mapping File: Loaded while Main Opens Device & Looks up FWID Cache,
+    // without Waiting for Cache Decision (Result is Discarded on Cache Hit)
+    run_system_info_task(p_task);
+
+SYSTEM_INFO_TASK_ROUTINE_EXIT:
+    return NULL;
+}
+
+int start_system_info_task(struct system_info_task *p_task)
+{
+    int err = TP_SUCCESS;
+
+    sem_init(&p_task->panel_info_ready, 0, 0);
+
+    if(pthread_create(&p_task->thread, NULL, system_info_task_routine, p_task) != 0)
+    {
+        ERROR_PRINTF("%s: Fail to create system info. task!\r\n", __func__);
+        sem_destroy(&p_task->panel_info_ready);
+        err = TP_ERR_NO_INTERFACE_CREATE;
+        goto START_SYSTEM_INFO_TASK_EXIT;
+    }
+    p_task->thread_started = true;
+
+START_SYSTEM_INFO_TASK_EXIT:
+    return err;
+}
+
+void stop_system_info_task(struct system_info_task *p_task)
+{
+    if(p_task->thread_started == false)
+        return;
+
+    pthread_join(p_task->thread, NULL);
+    p_task->thread_started = false;
+
+    sem_destroy(&p_task->panel_info_ready);
+
+    return;
+}
+
+/*******************************************
+ * Multi-Device Mode
+ ******************************************/
+
+// Elan I2C-HID Touch Controller with Requested PID (Any PID if Not Specified) or in Recovery Mode
+bool is_elan_touch_device(const struct hid_dev_entry *p_entry)
+{
+    if((p_entry->info.bustype != BUS_I2C) || ((unsigned short)p_entry->info.vendor != ELAN_USB_VID))
+        return false;
+    if((g_pid != ELAN_USB_FORCE_CONNECT_PID) && \
+       ((unsigned short)p_entry->info.product != g_pid) && ((unsigned short)p_entry->info.product != ELAN_USB_RECOVERY_PID))
+        return false;
+
+    return true;
+}
+
+int find_elan_touch_devices(struct multi_device_task *p_tasks, int task_max, int *p_task_count)
+{
+    int err = TP_SUCCESS,
+        index = 0,
+        dev_count = 0,
+        task_count = 0;
+    struct hid_dev_entry entry;
+
+    // Enumerate Once (Shared HID Device Inventory)
+    err = build_hid_dev_inventory(false);
+    if(err != TP_SUCCESS)
+        goto FIND_ELAN_TOUCH_DEVICES_EXIT;
+
+    dev_count = get_hid_dev_count();
+    for(index = 0; (index < dev_count) && (task_count < task_max); index++)
+    {
+        if(get_hid_dev_entry(index, &entry) != TP_SUCCESS)
+            break;
+
+        if(is_elan_touch_device(&entry) == false)
+            continue;
+
+        memset(&p_tasks[task_count], 0, sizeof(struct multi_device_task));
+        memcpy(&p_tasks[task_count].dev_entry, &entry, sizeof(struct hid_dev_entry));
+        DEBUG_PRINTF("%s: [%d] %s (PID %04x).\r\n", __func__, task_count, entry.path, (unsigned short)entry.info.product);
+        task_count++;
+    }
+
+    if(task_count == 0)
+    {
+        ERROR_PRINTF("%s: No Elan touch device found! (PID: %04x)\r\n", __func__, g_pid);
+        err = TP_ERR_NOT_FOUND_DEVICE;
+        goto FIND_ELAN_TOUCH_DEVICES_EXIT;
+    }
+
+    *p_task_count = task_count;
+    err = TP_SUCCESS;
+
+FIND_ELAN_TOUCH_DEVICES_EXIT:
+    return err;
+}
+
+int run_multi_device_task(struct multi_device_task *p_task)
+{
+    int err = TP_SUCCESS;
+    unsigned long long start_time_us = get_monotonic_time_us();
+    CI2CHIDSimulatorGet *p_simulator = NULL;
+    char simulator_config[FILE_NAME_LENGTH_MAX + 16] = {0};
+
+    // Own Interface of This Thread: I/O Functions & Function APIs Talk to This Device Only
+    // Touch Controller of Replayed Uevent is Simulated, No hidraw Node is Opened
+    if(g_uevent_replay == true)
+        g_pIntfGet = p_simulator = new CI2CHIDSimulatorGet();
+    else
+        g_pIntfGet = new CI2CHIDLinuxGet();
+    if(g_pIntfGet == NULL)
+    {
+        err = TP_ERR_NO_INTERFACE_CREATE;
+        goto RUN_MULTI_DEVICE_TASK_EXIT;
+    }
+
+    if(p_simulator != NULL)
+    {
+        // Simulator Config of "-S" (Default Controller if Not Specified), in Recovery Mode if Recorded with Recovery PID
+        snprintf(simulator_config, sizeof(simulator_config), "%s%s", (g_simulator == true) ? g_simulator_config : "default", \
+                 ((unsigned short)p_task->dev_entry.info.product == ELAN_USB_RECOVERY_PID) ? ",recovery" : "");
+        err = p_simulator->SetConfig(simulator_config);
+        if(err == TP_SUCCESS)
+            err = p_simulator->GetDeviceHandle((unsigned short)p_task->dev_entry.info.vendor, (unsigned short)p_task->dev_entry.info.product);
+    }
+    else
+        err = g_pIntfGet->GetDeviceHandleByPath(p_task->dev_entry.path, (unsigned short)p_task->dev_entry.info.vendor, (unsigned short)p_task->dev_entry.info.product);
+    if(err != TP_SUCCESS)
+    {
+        ERROR_PRINTF("%s: Fail to Open Device %s! err=0x%x.\r\n", __func__, p_task->dev_entry.path, err);
+        goto RUN_MULTI_DEVICE_TASK_FREE;
+    }
+    reset_session_context();
+    set_page_ready_time(0); // Learned per Device, Not Carried over from Previous Task of This Thread
+
+    err = get_touch_info(&p_task->hello_packet, &p_task->fw_bc_version, &p_task->bc_bc_version, \
+                         &p_task->gen8_touch, &p_task->recovery, &p_task->info_fwid);
+
+    g_pIntfGet->Close();
+    reset_session_context();
+
+RUN_MULTI_DEVICE_TASK_FREE:
+    delete g_pIntfGet;
+    g_pIntfGet = NULL;
+
+RUN_MULTI_DEVICE_TASK_EXIT:
+    p_task->err = err;
+    p_task->elapsed_us = get_elapsed_time_us(start_time_us);
+    return err;
+}
+
+void *multi_device_worker_routine(void *p_arg)
+{
+    struct multi_device_pool *p_pool = (struct multi_device_pool *)p_arg;
+    int task_index = 0;
+    bool phase_timing_enabled = g_phase_timing_enabled;
+
+    // Workers Run Concurrently: Don't Record into Phase Timing of Main Run
+    g_phase_timing_enabled = false;
+
+    while(1)
+    {
+        // Take Next Task
+        pthread_mutex_lock(&p_pool->mutex);
+        task_index = p_pool->next_task;
+        if(task_index < p_pool->task_count)
+            p_pool->next_task++;
+        pthread_mutex_unlock(&p_pool->mutex);
+
+        if(task_index >= p_pool->task_count)
+            break;
+
+        run_multi_device_task(&p_pool->p_tasks[task_index]);
+    }
+
+    g_phase_timing_enabled = phase_timing_enabled;
+    return NULL;
+}
+
+int run_multi_device(void)
+{
+    int err = TP_SUCCESS,
+        task_count = 0,
+        thread_count = 0,
+        thread_index = 0,
+        index = 0;
+    unsigned long long start_time_us = get_monotonic_time_us();
+    struct multi_device_task tasks[DEV_INFO_SET_MAX];
+    struct multi_device_pool pool;
+    pthread_t threads[MULTI_DEVICE_THREAD_MAX];
+
+    err = find_elan_touch_devices(tasks, DEV_INFO_SET_MAX, &task_count);
+    if(err != TP_SUCCESS)
+        goto RUN_MULTI_DEVICE_EXIT;
+
+    pool.p_tasks = tasks;
+    pool.task_count = task_count;
+    pool.next_task = 0;
+    pthread_mutex_init(&pool.mutex, NULL);
+
+    // Start Workers (Main Thread Joins in if Thread Creation Fails)
+    for(thread_index = 0; (thread_index < MULTI_DEVICE_THREAD_MAX) && (thread_index < task_count); thread_index++)
+    {
+        if(pthread_create(&threads[thread_index], NULL, multi_device_worker_routine, &pool) != 0)
+        {
+            ERROR_PRINTF("%s: Fail to Create Worker Thread %d!\r\n", __func__, thread_index);
+            break;
+        }
+        thread_count++;
+    }
+    if(thread_count == 0)
+        multi_device_worker_routine(&pool);
+
+    for(thread_index = 0; thread_index < thread_count; thread_index++)
+        pthread_join(threads[thread_index], NULL);
+    pthread_mutex_destroy(&pool.mutex);
+
+    // Show Results in Enumeration Order
+    if(g_silent_mode == false)
+    {
+        printf("--------------------------------------\r\n");
+        printf("Multi-Device: %d touch controller(s), %d worker(s), %llu us.\r\n", \
+               task_count, (thread_count > 0) ? thread_count : 1, get_elapsed_time_us(start_time_us));
+    }
+    for(index = 0; index < task_count; index++)
+    {
+        if(tasks[index].err != TP_SUCCESS)
+        {
+            ERROR_PRINTF("[%d] %s (PID %04x): Fail to Get Touch Info.! err=0x%x.\r\n", \
+                         index, tasks[index].dev_entry.path, (unsigned short)tasks[index].dev_entry.info.product, tasks[index].err);
+            if(err == TP_SUCCESS)
+                err = tasks[index].err;
+            continue;
+        }
+
+        if(g_silent_mode == true)
+            printf("%s %04x\r\n", tasks[index].dev_entry.path, tasks[index].info_fwid);
+        else
+            printf("[%d] %s (PID %04x): Information FWID: %04x%s. (%llu us)\r\n", \
+                   index, tasks[index].dev_entry.path, (unsigned short)tasks[index].dev_entry.info.product, \
+                   tasks[index].info_fwid, (tasks[index].recovery) ? ", In Recovery Mode" : "", tasks[index].elapsed_us);
+    }
+
+RUN_MULTI_DEVICE_EXIT:
+    return err;
+}
+
+/*******************************************
+ * Watch Mode
+ ******************************************/
+
+void watch_signal_handler(int signal_number)
+{
+    g_watch_stop = 1;
+    return;
+}
+
+// FWID from Panel EDID & Mapping Table, else Information FWID
+unsigned short resolve_watch_fwid(struct watch_state *p_state, unsigned short info_fwid)
+{
+    unsigned short fwid = info_fwid;
+
+    if((g_lookup_fwid == true) && (p_state->edid_info_found == true))
+    {
+        if(get_fwid_from_edid(p_state->p_lcm_dev_table, p_state->edid_manufacturer_code, p_state->edid_product_code, g_system_type, &fwid) != TP_SUCCESS)
+            fwid = info_fwid;
+    }
+
+    return fwid;
+}
+
+// Event Line: "hidraw <action> <path> pid=<pid> info_fwid=<info_fwid> fwid=<fwid>[ recovery]" or "... err=<err>"
+void emit_watch_device_event(struct watch_state *p_state, const char *p_action, struct watch_device *p_device)
+{
+    if(p_device->err != TP_SUCCESS)
+        printf("hidraw %s %s pid=%04x err=0x%x\r\n", p_action, p_device->path, p_device->pid, p_device->err);
+    else
+        printf("hidraw %s %s pid=%04x info_fwid=%04x fwid=%04x%s\r\n", p_action, p_device->path, p_device->pid, \
+               p_device->info_fwid, resolve_watch_fwid(p_state, p_device->info_fwid), (p_device->recovery) ? " recovery" : "");
+    fflush(stdout);
+
+    return;
+}
+
+// Query One Touch Controller (Own Device Handle, Same Sequence as Multi-Device Mode)
+int resolve_watch_device(struct watch_state *p_state, const struct hid_dev_entry *p_entry, const char *p_action)
+{
+    int err = TP_SUCCESS,
+        index = 0,
+        free_index = -1;
+    struct multi_device_task task;
+    struct watch_device *p_device = NULL;
+
+    for(index = 0; index < WATCH_DEVICE_MAX; index++)
+    {
+        if((p_state->devices[index].valid == true) && (strcmp(p_state->devices[index].path, p_entry->path) == 0))
+            break;
+        if((p_state->devices[index].valid == false) && (free_index < 0))
+            free_index = index;
+    }
+    if(index == WATCH_DEVICE_MAX)
+        index = free_index;
+    if(index < 0)
+    {
+        ERROR_PRINTF("%s: Too many touch controllers (max. %d)!\r\n", __func__, WATCH_DEVICE_MAX);
+        err = TP_ERR_INVALID_PARAM;
+        goto RESOLVE_WATCH_DEVICE_EXIT;
+    }
+    p_device = &p_state->devices[index];
+
+    memset(&task, 0, sizeof(task));
+    memcpy(&task.dev_entry, p_entry, sizeof(struct hid_dev_entry));
+    err = run_multi_device_task(&task);
+
+    memset(p_device, 0, sizeof(struct watch_device));
+    p_device->valid = true;
+    snprintf(p_device->path, sizeof(p_device->path), "%s", p_entry->path);
+    p_device->pid = (unsigned short)p_entry->info.product;
+    p_device->err = task.err;
+    p_device->recovery = task.recovery;
+    p_device->info_fwid = task.info_fwid;
+    emit_watch_device_event(p_state, p_action, p_device);
+
+RESOLVE_WATCH_DEVICE_EXIT:
+    return err;
+}
+
+// Identity of Replayed hidraw Node Comes from Its Uevent, Not from sysfs of This System
+int get_replay_hid_dev_entry(const struct uevent_message *p_message, struct hid_dev_entry *p_entry)
+{
+    int err = TP_SUCCESS;
+    unsigned int bus = 0;
+    unsigned short vid = 0,
+                   pid = 0;
+
+    err = uevent_get_hid_id(p_message, &bus, &vid, &pid);
+    if(err != TP_SUCCESS)
+    {
+        DEBUG_PRINTF("%s: No HID device in DEVPATH \"%s\".\r\n", __func__, p_message->devpath);
+        goto GET_REPLAY_HID_DEV_ENTRY_EXIT;
+    }
+
+    memset(p_entry, 0, sizeof(struct hid_dev_entry));
+    snprintf(p_entry->path, sizeof(p_entry->path), "%s/%s", HIDRAW_DEV_ROOT, p_message->devname);
+    p_entry->info.bustype = bus;
+    p_entry->info.vendor = (short)vid;
+    p_entry->info.product = (short)pid;
+
+GET_REPLAY_HID_DEV_ENTRY_EXIT:
+    return err;
+}
+
+// Panel of Replay Comes from "EDID=mmmm:pppp" of Recorded drm Uevent, Not from DRM sysfs of This System
+int get_replay_panel_info(const struct uevent_message *p_message, unsigned short *p_edid_manufacturer_code, unsigned short *p_edid_product_code, bool *p_edid_info_found)
+{
+    unsigned int manufacturer_code = 0,
+                 product_code = 0;
+
+    *p_edid_info_found = false;
+    *p_edid_manufacturer_code = 0;
+    *p_edid_product_code = 0;
+
+    if((p_message == NULL) || (p_message->edid[0] == '\0')) // No Panel Recorded
+        return TP_SUCCESS;
+
+    if(sscanf(p_message->edid, "%x:%x", &manufacturer_code, &product_code) != 2)
+    {
+        ERROR_PRINTF("%s: Invalid EDID \"%s\"!\r\n", __func__, p_message->edid);
+        return TP_ERR_DATA_PATTERN;
+    }
+
+    *p_edid_manufacturer_code = (unsigned short)manufacturer_code;
+    *p_edid_product_code = (unsigned short)product_code;
+    *p_edid_info_found = true;
+    return TP_SUCCESS;
+}
+
+int handle_hidraw_uevent(struct watch_state *p_state, const struct uevent_message *p_message)
+{
+    int err = TP_SUCCESS,
+        index = 0,
+        dev_count = 0;
+    char path[64] = {0};
+    struct hid_dev_entry entry;
+
+    snprintf(path, sizeof(path), "%s/%s", HIDRAW_DEV_ROOT, p_message->devname);
+
+    // Inventory Changed: Rescan (Identity from sysfs, No Device Open)
+    if(g_uevent_replay == false)
+        build_hid_dev_inventory(true);
+
+    if(strcmp(p_message->action, "remove") == 0)
+    {
+        for(index = 0; index < WATCH_DEVICE_MAX; index++)
+        {
+            if((p_state->devices[index].valid == true) && (strcmp(p_state->devices[index].path, path) == 0))
+            {
+                printf("hidraw remove %s pid=%04x\r\n", path, p_state->devices[index].pid);
+                fflush(stdout);
+                p_state->devices[index].valid = false;
+            }
+        }
+        goto HANDLE_HIDRAW_UEVENT_EXIT;
+    }
+
+    if((strcmp(p_message->action, "add") != 0) && (strcmp(p_message->action, "change") != 0) && (strcmp(p_message->action, "bind") != 0))
+        goto HANDLE_HIDRAW_UEVENT_EXIT;
+
+    // Only the Touch Controller Behind This Node is Queried
+    if(g_uevent_replay == true)
+    {
+        if(get_replay_hid_dev_entry(p_message, &entry) != TP_SUCCESS)
+            goto HANDLE_HIDRAW_UEVENT_EXIT;
+        if(is_elan_touch_device(&entry) == false)
+        {
+            DEBUG_PRINTF("%s: %s is not Elan touch device, ignored.\r\n", __func__, path);
+            goto HANDLE_HIDRAW_UEVENT_EXIT;
+        }
+        err = resolve_watch_device(p_state, &entry, p_message->action);
+        goto HANDLE_HIDRAW_UEVENT_EXIT;
+    }
+
+    dev_count = get_hid_dev_count();
+    for(index = 0; index < dev_count; index++)
+    {
+        if(get_hid_dev_entry(index, &entry) != TP_SUCCESS)
+            break;
+        if(strcmp(entry.path, path) != 0)
+            continue;
+
+        if(is_elan_touch_device(&entry) == false)
+        {
+            DEBUG_PRINTF("%s: %s is not Elan touch device, ignored.\r\n", __func__, path);
+            break;
+        }
+
+        if(strcmp(p_message->action, "add") == 0)
+            usleep(WATCH_DEVICE_SETTLE_MSEC * 1000);
+        err = resolve_watch_device(p_state, &entry, p_message->action);
+        break;
+    }
+
+HANDLE_HIDRAW_UEVENT_EXIT:
+    return err;
+}
+
+int handle_drm_uevent(struct watch_state *p_state, const struct uevent_message *p_message)
+{
+    int err = TP_SUCCESS,
+        index = 0;
+    bool edid_info_found = false;
+    unsigned short edid_manufacturer_code = 0,
+                   edid_product_code = 0;
+
+    // Connector Hotplug / Panel Change: Re-read EDID Only
+    if(g_uevent_replay == true)
+        err = get_replay_panel_info(p_message, &edid_manufacturer_code, &edid_product_code, &edid_info_found);
+    else
+        err = get_panel_info(&edid_manufacturer_code, &edid_product_code, &edid_info_found);
+    if(err != TP_SUCCESS)
+    {
+        ERROR_PRINTF("%s: Fail to Get Panel Info.! err=0x%x.\r\n", __func__, err);
+        goto HANDLE_DRM_UEVENT_EXIT;
+    }
+
+    if((edid_info_found == p_state->edid_info_found) && \
+       (edid_manufacturer_code == p_state->edid_manufacturer_code) && (edid_product_code == p_state->edid_product_code))
+    {
+        DEBUG_PRINTF("%s: Panel not changed.\r\n", __func__);
+        goto HANDLE_DRM_UEVENT_EXIT;
+    }
+
+    p_state->edid_info_found = edid_info_found;
+    p_state->edid_manufacturer_code = edid_manufacturer_code;
+    p_state->edid_product_code = edid_product_code;
+    printf("drm %s %s edid=%04x:%04x\r\n", p_message->action, p_message->devname, \
+           (edid_info_found) ? edid_manufacturer_code : 0, (edid_info_found) ? edid_product_code : 0);
+
+    // FWID of Known Touch Controllers Re-resolved from Memory (No Touch Controller I/O)
+    for(index = 0; index < WATCH_DEVICE_MAX; index++)
+    {
+        if((p_state->devices[index].valid == true) && (p_state->devices[index].err == TP_SUCCESS))
+            emit_watch_device_event(p_state, "panel", &p_state->devices[index]);
+    }
+    fflush(stdout);
+
+HANDLE_DRM_UEVENT_EXIT:
+    return err;
+}
+
+int handle_uevent(struct watch_state *p_state, const struct uevent_message *p_message)
+{
+    int err = TP_SUCCESS;
+
+    p_state->events++;
+    DEBUG_PRINTF("%s: ACTION=%s, SUBSYSTEM=%s, DEVNAME=%s, DEVPATH=%s.\r\n", __func__, \
+                 p_message->action, p_message->subsystem, p_message->devname, p_message->devpath);
+
+    if(strcmp(p_message->subsystem, "hidraw") == 0)
+        err = handle_hidraw_uevent(p_state, p_message);
+    else if(strcmp(p_message->subsystem, "drm") == 0)
+        err = handle_drm_uevent(p_state, p_message);
+
+    return err;
+}
+
+int run_watch(void)
+{
+    int err = TP_SUCCESS,
+        index = 0,
+        dev_count = 0,
+        uevent_fd = -1;
+    FILE *p_replay_file = NULL;
+    struct lcm_dev_table lcm_dev_table;
+    struct watch_state state;
+    struct hid_dev_entry entry;
+    struct uevent_message message;
+    struct sigaction action;
+    CBaseLog *p_watch_log = NULL;
+
+    init_lcm_dev_table(&lcm_dev_table);
+    memset(&state, 0, sizeof(state));
+    state.p_lcm_dev_table = &lcm_dev_table;
+
+    // Logger Held for Whole Watch: Interface of Each Event Appends to Same Log (Async Writer Not Restarted per Event)
+    p_watch_log = new CBaseLog();
+
+    // Mapping Table Parsed Once
+    if(strcmp(g_fwid_mapping_file_path, "") != 0)
+    {
+        err = load_fwid_mapping_file(g_fwid_mapping_file_path, &lcm_dev_table);
+        if(err != TP_SUCCESS)
+        {
+            ERROR_PRINTF("%s: Fail to load FWID mapping file, err=0x%x.\r\n", __func__, err);
+            goto RUN_WATCH_EXIT;
+        }
+    }
+
+    // Subscribe before Initial Scan, so No Change is Missed in Between
+    if(g_uevent_replay == true)
+    {
+        p_replay_file = fopen(g_uevent_replay_file_path, "r");
+        if(p_replay_file == NULL)
+        {
+            ERROR_PRINTF("%s: Fail to Open Uevent File \"%s\"!\r\n", __func__, g_uevent_replay_file_path);
+            err = TP_ERR_FILE_NOT_FOUND;
+            goto RUN_WATCH_EXIT;
+        }
+    }
+    else
+    {
+        err = uevent_open(&uevent_fd);
+        if(err != TP_SUCCESS)
+            goto RUN_WATCH_EXIT;
+    }
+
+    // Initial State: Panel & All Present Touch Controllers
+    // (Replay Starts with No Panel & No Touch Controller, Recorded Uevents Bring Them in)
+    if(g_uevent_replay == true)
+        get_replay_panel_info(NULL, &state.edid_manufacturer_code, &state.edid_product_code, &state.edid_info_found);
+    else
+    {
+        get_panel_info(&state.edid_manufacturer_code, &state.edid_product_code, &state.edid_info_found);
+        build_hid_dev_inventory(true);
+        dev_count = get_hid_dev_count();
+        for(index = 0; index < dev_count; index++)
+        {
+            if(get_hid_dev_entry(index, &entry) != TP_SUCCESS)
+                break;
+            if(is_elan_touch_device(&entry) == true)
+                resolve_watch_device(&state, &entry, "present");
+        }
+    }
+
+    // Stop on SIGINT / SIGTERM
+    g_watch_stop = 0;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = watch_signal_handler;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGINT, &action, NULL);
+    sigaction(SIGTERM, &action, NULL);
+
+    while(g_watch_stop == 0)
+    {
+        if(p_replay_file != NULL)
+        {
+            err = uevent_replay_next(p_replay_file, &message);
+            if(err == TP_ERR_DATA_NOT_FOUND) // End of Recorded Uevents
+                break;
+        }
+        else
+            err = uevent_receive(uevent_fd, &message, WATCH_POLL_INTERVAL_MSEC);
+
+        if(err == TP_ERR_TIMEOUT)
+            continue;
+        if(err == TP_ERR_DATA_PATTERN) // Not a Complete Uevent
+            continue;
+        if(err != TP_SUCCESS)
+        {
+            ERROR_PRINTF("%s: Fail to Receive Uevent! err=0x%x.\r\n", __func__, err);
+            goto RUN_WATCH_EXIT;
+        }
+
+        handle_uevent(&state, &message);
+    }
+
+    DEBUG_PRINTF("%s: %lu uevent(s) handled.\r\n", __func__, state.events);
+    err = TP_SUCCESS;
+
+RUN_WATCH_EXIT:
+    if(p_replay_file != NULL)
+        fclose(p_replay_file);
+    uevent_close(uevent_fd);
+    free_lcm_dev_table(&lcm_dev_table);
+    if(p_watch_log != NULL)
+        delete p_watch_log;
+    return err;
+}
+
+/*******************************************
+ * Daemon Mode & Client Mode
+ ******************************************/
+
+/*
+ * Line Protocol (One Request per Connection):
+ *   ping                    => OK pong
+ *   fwid [chrome|windows]   => OK <fwid>
+ *   info_fwid               => OK <info_fwid>
+ *   version                 => OK hello=<hh> fw_bc=<hhhh> bc_bc=<hhhh> gen8=<0|1> recovery=<0|1>
+ *   system_info             => OK edid=<mmmm>:<pppp> lcm_devices=<n> hid=<bus>:<vid>:<pid>,...
+ *   refresh                 => OK <info_fwid> (Reopen device & query touch controller again)
+ *   quit                    => OK bye
+ * Error: ERR 0x<err> <reason>
+ */
+int handle_daemon_request(const char *p_request, char *p_response, size_t response_size, void *p_context)
+{
+    int err = TP_SUCCESS,
+        index = 0;
+    struct daemon_state *p_state = (struct daemon_state *)p_context;
+    char command[32] = {0},
+         argument[32] = {0};
+    system_type system = g_system_type;
+    unsigned short fwid = 0;
+    size_t response_len = 0;
+
+    p_state->requests++;
+    sscanf(p_request, "%31s %31s", command, argument);
+
+    if(strcmp(command, "ping") == 0)
+    {
+        snprintf(p_response, response_size, "OK pong");
+    }
+    else if(strcmp(command, "fwid") == 0)
+    {
+        if(strcmp(argument, "chrome") == 0)
+            system = CHROME;
+        else if(strcmp(argument, "windows") == 0)
+            system = WINDOWS;
+        else if(strcmp(argument, "") != 0)
+            system = UNKNOWN;
+        if(system == UNKNOWN)
+        {
+            err = TP_ERR_INVALID_PARAM;
+            snprintf(p_response, response_size, "ERR 0x%x unknown system", err);
+            goto HANDLE_DAEMON_REQUEST_EXIT;
+        }
+
+        // Same Resolution as Command-line Mode, Mapping Table Already in Memory
+        fwid = p_state->info_fwid;
+        if(p_state->edid_info_found == true)
+        {
+            err = get_fwid_from_edid(p_state->p_lcm_dev_table, p_state->edid_manufacturer_code, p_state->edid_product_code, system, &fwid);
+            if(err == TP_ERR_DATA_NOT_FOUND)
+                fwid = p_state->info_fwid;
+            else if(err != TP_SUCCESS)
+            {
+                snprintf(p_response, response_size, "ERR 0x%x fwid lookup", err);
+                goto HANDLE_DAEMON_REQUEST_EXIT;
+            }
+        }
+        snprintf(p_response, response_size, "OK %04x", fwid);
+    }
+    else if(strcmp(command, "info_fwid") == 0)
+    {
+        snprintf(p_response, response_size, "OK %04x", p_state->info_fwid);
+    }
+    else if(strcmp(command, "version") == 0)
+    {
+        snprintf(p_response, response_size, "OK hello=%02x fw_bc=%04x bc_bc=%04x gen8=%d recovery=%d", \
+                 p_state->hello_packet, p_state->fw_bc_version, p_state->bc_bc_version, p_state->gen8_touch, p_state->recovery);
+    }
+    else if(strcmp(command, "system_info") == 0)
+    {
+        response_len = snprintf(p_response, response_size, "OK edid=%04x:%04x lcm_devices=%zu hid=", \
+                                (p_state->edid_info_found) ? p_state->edid_manufacturer_code : 0, \
+                                (p_state->edid_info_found) ? p_state->edid_product_code : 0, \
+                                p_state->p_lcm_dev_table->dev_info_count);
+        for(index = 0; (index < DEV_INFO_SET_MAX) && (response_len < response_size); index++)
+        {
+            if(p_state->p_hid_dev_info[index].bustype <= 0)
+                continue;
+            response_len += snprintf(&p_response[response_len], response_size - response_len, "%s%04x:%04x:%04x", \
+                                     (p_response[response_len - 1] == '=') ? "" : ",", p_state->p_hid_dev_info[index].bustype, \
+                                     (unsigned short)p_state->p_hid_dev_info[index].vendor, (unsigned short)p_state->p_hid_dev_info[index].product);
+        }
+    }
+    else if(strcmp(command, "refresh") == 0)
+    {
+        // Device May be Re-enumerated (ex: Firmware Update / Recovery), so Reopen it before Query
+        close_device();
+        err = open_device();
+        if(err != TP_SUCCESS)
+        {
+            snprintf(p_response, response_size, "ERR 0x%x open device", err);
+            goto HANDLE_DAEMON_REQUEST_EXIT;
+        }
+        err = get_touch_info(&p_state->hello_packet, &p_state->fw_bc_version, &p_state->bc_bc_version, \
+                             &p_state->gen8_touch, &p_state->recovery, &p_state->info_fwid);
+        if(err != TP_SUCCESS)
+        {
+            snprintf(p_response, response_size, "ERR 0x%x touch info", err);
+            goto HANDLE_DAEMON_REQUEST_EXIT;
+        }
+        snprintf(p_response, response_size, "OK %04x", p_state->info_fwid);
+    }
+    else if(strcmp(command, "quit") == 0)
+    {
+        daemon_stop();
+        snprintf(p_response, response_size, "OK bye");
+    }
+    else
+    {
+        err = TP_ERR_COMMAND_NOT_SUPPORT;
+        snprintf(p_response, response_size, "ERR 0x%x unknown request", err);
+        goto HANDLE_DAEMON_REQUEST_EXIT;
+    }
+
+    err = TP_SUCCESS;
+
+HANDLE_DAEMON_REQUEST_EXIT:
+    return err;
+}
+
+int run_daemon(struct daemon_state *p_state)
+{
+    int err = TP_SUCCESS,
+        listen_fd = -1;
+
+    err = daemon_listen(g_daemon_socket_path, &listen_fd);
+    if(err != TP_SUCCESS)
+    {
+        ERROR_PRINTF("%s: Fail to Listen on \"%s\"! err=0x%x.\r\n", __func__, g_daemon_socket_path, err);
+        goto RUN_DAEMON_EXIT;
+    }
+
+    if(g_silent_mode == false)
+        printf("Daemon: serving on \"%s\" (info FWID %04x).\r\n", g_daemon_socket_path, p_state->info_fwid);
+    fflush(stdout);
+
+    err = daemon_serve(listen_fd, handle_daemon_request, p_state);
+    daemon_close(listen_fd, g_daemon_socket_path);
+    DEBUG_PRINTF("%s: Daemon stopped after %lu request(s).\r\n", __func__, p_state->requests);
+
+RUN_DAEMON_EXIT:
+    return err;
+}
+
+int run_daemon_query(void)
+{
+    int err = TP_SUCCESS;
+    char response[DAEMON_MESSAGE_LENGTH_MAX] = {0};
+
+    err = daemon_query(g_daemon_socket_path, g_daemon_request, response, sizeof(response));
+    if(err != TP_SUCCESS)
+        goto RUN_DAEMON_QUERY_EXIT;
+
+    if(strncmp(response, "OK", 2) != 0)
+    {
+        // ex: "ERR 0x106 fwid lookup"
+        ERROR_PRINTF("%s\r\n", response);
+        if(sscanf(response, "ERR %x", (unsigned int *)&err) != 1)
+            err = TP_ERR_DATA_PATTERN;
+        goto RUN_DAEMON_QUERY_EXIT;
+    }
+
+    printf("%s\r\n", (response[2] == ' ') ? &response[3] : &response[2]);
+    err = TP_SUCCESS;
+
+RUN_DAEMON_QUERY_EXIT:
+    return err;
+}
+
+/*******************************************
+ * Phase Timing
+ ******************************************/
+
+void begin_phase(phase_id phase)
+{
+    if(g_phase_timing_enabled == false)
+        return;
+
+    g_phase_timing[phase].start_us = get_elapsed_time_us(g_start_time_us);
+    return;
+}
+
+void end_phase(phase_id phase)
+{
+    if(g_phase_timing_enabled == false)
+        return;
+
+    g_phase_timing[phase].end_us = get_elapsed_time_us(g_start_time_us);
+    return;
+}
+
+void show_phase_timing(void)
+{
+    int phase = 0;
+
+    DEBUG_PRINTF("--------------------------------------\r\n");
+    DEBUG_PRINTF("Phase Timing (%s):\r\n", (g_concurrent) ? "Concurrent" : "Serial");
+    for(phase = 0; phase < PHASE_COUNT; phase++)
+    {
+        if(g_phase_timing[phase].end_us == 0) // Not Executed
+            continue;
+        DEBUG_PRINTF("%-26s: %8llu us - %8llu us (%llu us).\r\n", g_phase_timing[phase].name, \
+                     g_phase_timing[phase].start_us, g_phase_timing[phase].end_us, \
+                     g_phase_timing[phase].end_us - g_phase_timing[phase].start_us);
+    }
+    DEBUG_PRINTF("%-26s: %8llu us.\r\n", "Total", get_elapsed_time_us(g_start_time_us));
+
+    return;
+}
+
+void show_report_statistics(void)
+{
+    unsigned long command_reports = 0,
+                  input_reports = 0,
+                  dropped_reports = 0,
+                  unknown_reports = 0,
+                  discarded_reports = 0;
+    structReplayStatistics replay_statistics;
+
+    if(g_pIntfGet == NULL)
+        return;
+
+    if(g_pIntfGet->GetReportStatistics(&command_reports, &input_reports, &dropped_reports, &unknown_reports, &discarded_reports) != TP_SUCCESS)
+        return;
+
+    DEBUG_PRINTF("--------------------------------------\r\n");
+    DEBUG_PRINTF("Report Statistics:\r\n");
+    DEBUG_PRINTF("%-26s: %lu.\r\n", "Command Response", command_reports);
+    DEBUG_PRINTF("%-26s: %lu (dropped %lu).\r\n", "Finger/Pen Input", input_reports, dropped_reports);
+    DEBUG_PRINTF("%-26s: %lu.\r\n", "Unknown", unknown_reports);
+    DEBUG_PRINTF("%-26s: %lu.\r\n", "Stale (Drained)", discarded_reports);
+
+    // Replay of HID Transaction Trace
+    if(g_pIntfGet->GetInterfaceType() == INTF_TYPE_ELAN_I2CHID_REPLAY)
+    {
+        dynamic_cast<CI2CHIDReplayGet *>(g_pIntfGet)->GetReplayStatistics(&replay_statistics);
+        DEBUG_PRINTF("%-26s: %lu (diverged %lu).\r\n", "Replayed Output", replay_statistics.ulMatchedWrites + replay_statistics.ulDivergedWrites, \
+                     replay_statistics.ulDivergedWrites);
+        DEBUG_PRINTF("%-26s: %lu (skipped %lu).\r\n", "Replayed Input", replay_statistics.ulReplayedReports, replay_statistics.ulSkippedReports);
+    }
+
+    return;
+}
+
+void show_retry_statistics(void)
+{
+    struct retry_statistics statistics;
+
+    get_retry_statistics(&statistics);
+    if(statistics.operations == 0) // No Operation Run by Retry Engine
+        return;
+
+    DEBUG_PRINTF("--------------------------------------\r\n");
+    DEBUG_PRINTF("Retry Statistics:\r\n");
+    DEBUG_PRINTF("%-26s: %lu (failed %lu).\r\n", "Operations", statistics.operations, statistics.failed_operations);
+    DEBUG_PRINTF("%-26s: %lu.\r\n", "Attempts", statistics.attempts);
+    DEBUG_PRINTF("%-26s: %llu us.\r\n", "Backoff Sleep", statistics.sleep_us);
+
+    return;
+}
+
+/*******************************************
+ * FWID Resolution Cache
+ ******************************************/
+
+int lookup_fwid_cache(struct system_info_task *p_task, struct fwid_cache_key *p_cache_key, struct fwid_cache_data *p_cache_data)
+{
+    int err = TP_SUCCESS;
+    unsigned int vid = 0,
+                 pid = 0;
+    unsigned char hello_packet = 0;
+    unsigned short bc_bc_version = 0,
+                   fw_version = 0;
+
+    // Invalid Key (Never Saved) unless Built
+    memset(p_cache_key, 0, sizeof(struct fwid_cache_key));
+
+    if(g_pIntfGet == NULL)
+    {
+        err = TP_ERR_COMMAND_NOT_SUPPORT;
+        goto LOOKUP_FWID_CACHE_EXIT;
+    }
+
+    // Get VID & PID of Opened hidraw Device (No Touch Controller I/O)
+    err = g_pIntfGet->GetDevVidPid(&vid, &pid);
+    if(err != TP_SUCCESS)
+    {
+        ERROR_PRINTF("%s: Fail to Get VID & PID! err=0x%x.\r\n", __func__, err);
+        goto LOOKUP_FWID_CACHE_EXIT;
+    }
+
+    // Get Firmware Identity: Two Short Queries, Information FWID (ROM Read) is Still Skipped on Hit
+    // (Hello packet is cached in session, so get_touch_info() does not query it again on miss.)
+    err = get_session_hello_packet_bc_version(&hello_packet, &bc_bc_version, ERROR_RETRY_COUNT);
+    if(err != TP_SUCCESS)
+    {
+        ERROR_PRINTF("%s: Fail to Get Hello Packet! err=0x%x.\r\n", __func__, err);
+        goto LOOKUP_FWID_CACHE_EXIT;
+    }
+    if((hello_packet == ELAN_I2CHID_NORMAL_MODE_HELLO_PACKET) || (hello_packet == ELAN_GEN8_I2CHID_NORMAL_MODE_HELLO_PACKET))
+    {
+        err = get_fw_version(&fw_version);
+        if(err != TP_SUCCESS)
+        {
+            ERROR_PRINTF("%s: Fail to Get FW Version! err=0x%x.\r\n", __func__, err);
+            goto LOOKUP_FWID_CACHE_EXIT;
+        }
+    }
+    else // Recovery Mode (No Main Code)
+        fw_version = bc_bc_version;
+
+    // Panel EDID First Needed Here (Concurrent Mode: Read by Worker while Touch Controller was Queried)
+    err = take_panel_info(p_task);
+    if(err != TP_SUCCESS)
+        goto LOOKUP_FWID_CACHE_EXIT;
+
+    // Build Cache Key
+    err = get_fwid_cache_key((unsigned short)vid, (unsigned short)pid, hello_packet, fw_version, \
+                             p_task->edid_info_found, p_task->edid_manufacturer_code, p_task->edid_product_code, \
+                             (g_lookup_fwid) ? g_fwid_mapping_file_path : NULL, p_cache_key);
+    if(err != TP_SUCCESS)
+    {
+        ERROR_PRINTF("%s: Fail to Get FWID Cache Key! err=0x%x.\r\n", __func__, err);
+        memset(p_cache_key, 0, sizeof(struct fwid_cache_key)); // Invalid Key, Never Saved
+        goto LOOKUP_FWID_CACHE_EXIT;
+    }
+
+    // Forced Revalidation: Always Miss, Cache will be Rewritten
+    if(g_revalidate_cache == true)
+    {
+        DEBUG_PRINTF("%s: Revalidate FWID cache.\r\n", __func__);
+        err = TP_ERR_DATA_NOT_FOUND;
+        goto LOOKUP_FWID_CACHE_EXIT;
+    }
+
+    // Load Cache
+    err = load_fwid_cache(g_fwid_cache_file_path, p_cache_key, p_cache_data);
+
+LOOKUP_FWID_CACHE_EXIT:
+    return err;
+}
+
+int update_fwid_cache(struct fwid_cache_key *p_cache_key, unsigned char hello_packet, \
+                      unsigned short fw_bc_version, unsigned short bc_bc_version, bool gen8_touch, bool recovery, \
+                      unsigned short info_fwid, bool edid_info_found, unsigned short edid_manufacturer_code, unsigned short edid_product_code, \
+                      struct lcm_dev_table *p_lcm_dev_table)
+{
+    int err = TP_SUCCESS;
+    unsigned short fwid_from_edid = 0;
+    struct fwid_cache_data cache_data;
+
+    memset(&cache_data, 0, sizeof(cache_data));
+    cache_data.hello_packet = hello_packet;
+    cache_data.fw_bc_version = fw_bc_version;
+    cache_data.bc_bc_version = bc_bc_version;
+    cache_data.info_fwid = info_fwid;
+    if(gen8_touch == true)
+        cache_data.flags |= FWID_CACHE_FLAG_GEN8_TOUCH;
+    if(recovery == true)
+        cache_data.flags |= FWID_CACHE_FLAG_RECOVERY;
+
+    // Resolve Both Systems, so Cache Serves Either "-s" Option
+    if((g_lookup_fwid == true) && (edid_info_found == true))
+    {
+        if(get_fwid_from_edid(p_lcm_dev_table, edid_manufacturer_code, edid_product_code, CHROME, &fwid_from_edid) == TP_SUCCESS)
+        {
+            cache_data.chrome_fwid = fwid_from_edid;
+            cache_data.flags |= FWID_CACHE_FLAG_CHROME_FWID_FOUND;
+        }
+        if(get_fwid_from_edid(p_lcm_dev_table, edid_manufacturer_code, edid_product_code, WINDOWS, &fwid_from_edid) == TP_SUCCESS)
+        {
+            cache_data.windows_fwid = fwid_from_edid;
+            cache_data.flags |= FWID_CACHE_FLAG_WINDOWS_FWID_FOUND;
+        }
+    }
+
+    err = save_fwid_cache(g_fwid_cache_file_path, p_cache_key, &cache_data);
+    if(err != TP_SUCCESS)
+        ERROR_PRINTF("%s: Fail to Save FWID Cache! err=0x%x.\r\n", __func__, err);
+
+    return err;
+}
+
 /*******************************************
  * Help
  ******************************************/
@@ -480,6 +2062,8 @@ void show_help_information(void)
     printf("-f <fwid_mapping_table_file_path>.\r\n");
     printf("Ex: i2chid_read_fwid -f fwid_mapping_table.txt\r\n");
     printf("Ex: i2chid_read_fwid -f /tmp/fwid_mapping_table.txt\r\n");
+    printf("-f <fwid_mapping_table_file_path> -C. (Compile into <fwid_mapping_table_file_path>.bin)\r\n");
+    printf("Ex: i2chid_read_fwid -f fwid_mapping_table.txt -C\r\n");
 
     // System/Platform
     printf("\n[System Platform]\r\n");
@@ -487,6 +2071,18 @@ void show_help_information(void)
     printf("Ex: i2chid_read_fwid -s chrome\r\n");
     printf("Ex: i2chid_read_fwid -s windows\r\n");
 
+    // DRM sysfs Root of Panel EDID
+    printf("\n[Panel EDID]\r\n");
+    printf("-e <drm_sysfs_root>.\r\n");
+    printf("Ex: i2chid_read_fwid -e /sys/class/drm\r\n");
+
+    // FWID Resolution Cache
+    printf("\n[FWID Cache]\r\n");
+    printf("-c <fwid_cache_file_path>.\r\n");
+    printf("Ex: i2chid_read_fwid -c /var/cache/elan_fwid.cache\r\n");
+    printf("-r. (Revalidate FWID cache)\r\n");
+    printf("Ex: i2chid_read_fwid -c /var/cache/elan_fwid.cache -r\r\n");
+
     // Device Information
     printf("\n[Device Information]\r\n");
     printf("-i.\r\n");
@@ -502,6 +2098,67 @@ void show_help_information(void)
     printf("-d.\r\n");
     printf("Ex: i2chid_read_fwid -d\r\n");
 
+    // Concurrent Mode
+    printf("\n[Concurrent Mode]\r\n");
+    printf("-t. (Read panel EDID & mapping file while talking to touch controller)\r\n");
+    printf("Ex: i2chid_read_fwid -P 2a03 -f fwid_mapping_table.txt -s chrome -t\r\n");
+
+    // Multi-Device Mode
+    printf("\n[Multi-Device Mode]\r\n");
+    printf("-M. (Read information FWID of every Elan touch controller in parallel)\r\n");
+    printf("Ex: i2chid_read_fwid -M\r\n");
+    printf("Ex: i2chid_read_fwid -P 2a03 -M\r\n");
+
+    // Watch Mode
+    printf("\n[Watch Mode]\r\n");
+    printf("-W. (Re-resolve FWID on hidraw / drm uevent, one event line per change)\r\n");
+    printf("Ex: i2chid_read_fwid -P 2a03 -f fwid_mapping_table.txt -s chrome -W\r\n");
+    printf("-U <uevent_file>. (Replay uevents recorded by \"udevadm monitor --kernel --property\", touch controllers simulated)\r\n");
+    printf("Ex: i2chid_read_fwid -P 2a03 -U uevents.txt\r\n");
+
+    // Daemon Mode & Client Mode
+    printf("\n[Daemon Mode]\r\n");
+    printf("-D <socket_path>. (Keep device open and answer queries over Unix domain socket)\r\n");
+    printf("Ex: i2chid_read_fwid -P 2a03 -f fwid_mapping_table.txt -s chrome -D /run/elan_fwid.sock\r\n");
+    printf("-Q <request>. (Query daemon: ping, fwid [chrome|windows], info_fwid, version, system_info, refresh, quit)\r\n");
+    printf("Ex: i2chid_read_fwid -D /run/elan_fwid.sock -Q \"fwid chrome\"\r\n");
+
+    // Simulator
+    printf("\n[Simulator]\r\n");
+    printf("-S <config>. (Simulated touch controller instead of hidraw device: default | gen5/6/7 | gen8, normal | recovery,\r\n");
+    printf("              delay=<us>, frame=<us>, flash=<us>, touch=<hz>, fwid=<hex>, fwver=<hex>, bc=<hex>, pid=<hex>)\r\n");
+    printf("Ex: i2chid_read_fwid -S default -b page_read\r\n");
+    printf("Ex: i2chid_read_fwid -S gen8,recovery,delay=500,touch=120 -i\r\n");
+    printf("-H <config>. (Virtual device through /dev/uhid, served by simulated touch controller (same config as \"-S\"),\r\n");
+    printf("              so the run talks to a real /dev/hidrawN; add \"-D\" to keep it for other processes)\r\n");
+    printf("Ex: i2chid_read_fwid -H default -P 2a03 -b page_read\r\n");
+    printf("Ex: i2chid_read_fwid -H gen8,delay=500 -P 2a03 -f /tmp/fwid_mapping_table.txt -s chrome -D /tmp/elan_fwid.sock\r\n");
+
+    // HID Transaction Trace
+    printf("\n[Trace]\r\n");
+    printf("-k <trace_file>. (Record every output / input report of the run to binary trace file)\r\n");
+    printf("Ex: i2chid_read_fwid -P 2a03 -f /tmp/fwid_mapping_table.txt -s chrome -k /tmp/elan_fwid.trace\r\n");
+    printf("-K <trace_file>[,<speed>]. (Replay recorded reports instead of device, speed: 1 (original, default), N (N times faster), 0 (no wait))\r\n");
+    printf("Ex: i2chid_read_fwid -f /tmp/fwid_mapping_table.txt -s chrome -K /tmp/elan_fwid.trace\r\n");
+    printf("Ex: i2chid_read_fwid -i -K /tmp/elan_fwid.trace,0\r\n");
+
+    // Retry Policy
+    printf("\n[Retry Policy]\r\n");
+    printf("-R <backoff>[,<base_ms>[,<max_delay_ms>[,<deadline_ms>[,<max_attempts>]]]]. (backoff: immediate, fixed, linear, exp)\r\n");
+    printf("Ex: i2chid_read_fwid -P 2a03 -f fwid_mapping_table.txt -s chrome -R exp,5,100,300\r\n");
+
+    // Benchmark
+    printf("\n[Benchmark]\r\n");
+    printf("-b <benchmark>. (mapping, page_read)\r\n");
+    printf("Ex: i2chid_read_fwid -b mapping\r\n");
+    printf("Ex: i2chid_read_fwid -P 2a03 -b page_read\r\n");
+
+    // Profile
+    printf("\n[Profile]\r\n");
+    printf("--profile[=<format>]. (Phase timing & hidraw I/O latency histogram to stderr, format: table (default), json)\r\n");
+    printf("Ex: i2chid_read_fwid -P 2a03 -f /tmp/fwid_mapping_table.txt -s chrome --profile\r\n");
+    printf("Ex: i2chid_read_fwid -S default -i --profile=json\r\n");
+
     // Help Information
     printf("\n[Help]\r\n");
     printf("-h.\r\n");
@@ -531,6 +2188,11 @@ int open_device(void)
     err = g_pIntfGet->GetDeviceHandle(ELAN_USB_VID, g_pid);
     if (err != TP_SUCCESS)
         ERROR_PRINTF("Device can't connected! err=0x%x.\n", err);
+    else if (g_trace_record == true) // Record Reports from Now on (VID / PID of Connected Device in Trace Header)
+        g_pIntfGet->StartTrace(g_trace_record_file_path);
+
+    // New Handle => Drop Device Information of Previous Session
+    reset_session_context();
 
 OPEN_DEVICE_EXIT:
     /*********************************/
@@ -553,6 +2215,7 @@ int close_device(void)
 
     // Release acquired touch device handler
     g_pIntfGet->Close();
+    reset_session_context();
 
 CLOSE_DEVICE_EXIT:
     /*********************************/
@@ -572,8 +2235,43 @@ int resource_init(void)
 
     /*** example *********************/
 
+    // Virtual Device through uhid (Found by Device Open as Any Other hidraw Device)
+    if(g_uhid == true)
+    {
+        if(g_simulator == true)
+        {
+            ERROR_PRINTF("\"-S\" and \"-H\" Can Not Be Used Together!\r\n");
+            g_uhid = false;
+            err = TP_ERR_INVALID_PARAM;
+            goto RESOURCE_INIT_EXIT;
+        }
+
+        err = uhid_standin_start(g_uhid_config, &g_uhid_standin);
+        if (err != TP_SUCCESS)
+        {
+            ERROR_PRINTF("Fail to Create Virtual Device! err=0x%x.\r\n", err);
+            g_uhid = false;
+            goto RESOURCE_INIT_EXIT;
+        }
+        if(g_silent_mode == false)
+            printf("Virtual Device: %s.\r\n", g_uhid_standin.hidraw_path);
+    }
+
+    // Replay Recorded Reports instead of Any Device
+    if((g_trace_replay == true) && ((g_simulator == true) || (g_uhid == true)))
+    {
+        ERROR_PRINTF("\"-K\" Can Not Be Used with \"-S\" or \"-H\"!\r\n");
+        err = TP_ERR_INVALID_PARAM;
+        goto RESOURCE_INIT_EXIT;
+    }
+
     // Initialize I2C-HID Interface
-    g_pIntfGet = new CI2CHIDLinuxGet();
+    if(g_trace_replay == true) // Replay of HID Transaction Trace
+        g_pIntfGet = new CI2CHIDReplayGet();
+    else if(g_simulator == true) // Simulated Touch Controller
+        g_pIntfGet = new CI2CHIDSimulatorGet();
+    else
+        g_pIntfGet = new CI2CHIDLinuxGet();
     DEBUG_PRINTF("g_pIntfGet=%p.\n", g_pIntfGet);
     if (g_pIntfGet == NULL)
     {
@@ -582,6 +2280,30 @@ int resource_init(void)
         goto RESOURCE_INIT_EXIT;
     }
 
+    // Configure Simulated Touch Controller
+    if(g_simulator == true)
+    {
+        err = dynamic_cast<CI2CHIDSimulatorGet *>(g_pIntfGet)->SetConfig(g_simulator_config);
+        if (err != TP_SUCCESS)
+        {
+            ERROR_PRINTF("Invalid Simulator Config \"%s\"! err=0x%x.\r\n", g_simulator_config, err);
+            goto RESOURCE_INIT_EXIT;
+        }
+        DEBUG_PRINTF("%s: %s.\r\n", __func__, g_pIntfGet->GetInterfaceVersion());
+    }
+
+    // Load Trace to Replay
+    if(g_trace_replay == true)
+    {
+        err = dynamic_cast<CI2CHIDReplayGet *>(g_pIntfGet)->LoadTrace(g_trace_replay_file_path, g_trace_replay_speed);
+        if (err != TP_SUCCESS)
+        {
+            ERROR_PRINTF("Fail to Load Trace \"%s\"! err=0x%x.\r\n", g_trace_replay_file_path, err);
+            goto RESOURCE_INIT_EXIT;
+        }
+        DEBUG_PRINTF("%s: %s.\r\n", __func__, g_pIntfGet->GetInterfaceVersion());
+    }
+
     // Success
     err = TP_SUCCESS;
 
@@ -606,6 +2328,13 @@ int resource_free(void)
         g_pIntfGet = NULL;
     }
 
+    // Remove Virtual Device
+    if (g_uhid == true)
+    {
+        uhid_standin_stop(&g_uhid_standin);
+        g_uhid = false;
+    }
+
     /*********************************/
 
     return err;
@@ -624,8 +2353,12 @@ int process_parameter(int argc, char **argv)
         pid_str_len = 0,
         file_path_len = 0,
         system_str_len = 0;
+    long speed = 0;
     char file_path[FILE_NAME_LENGTH_MAX] = {0},
                                            system[SYSTEM_NAME_LENGTH] = {0};
+    char *p_speed = NULL,
+         *p_end = NULL;
+    struct retry_policy retry_policy;
 
     while (1)
     {
@@ -741,6 +2474,234 @@ int process_parameter(int argc, char **argv)
                 }
                 break;
 
+            case 'e': /* DRM sysfs Root of Panel EDID */
+
+                // Make Sure Format Valid
+                file_path_len = strlen(optarg);
+                if ((file_path_len == 0) || ((size_t)file_path_len >= sizeof(g_drm_sysfs_root)))
+                {
+                    ERROR_PRINTF("%s: DRM sysfs Root (%s) Invalid!\r\n", __func__, optarg);
+                    err = TP_ERR_INVALID_PARAM;
+                    goto PROCESS_PARAM_EXIT;
+                }
+
+                // Set DRM sysfs Root
+                memset(g_drm_sysfs_root, 0, sizeof(g_drm_sysfs_root));
+                strncpy(g_drm_sysfs_root, optarg, sizeof(g_drm_sysfs_root) - 1);
+                DEBUG_PRINTF("%s: DRM sysfs Root: \"%s\".\r\n", __func__, g_drm_sysfs_root);
+                break;
+
+            case 'c': /* FWID Resolution Cache File Path */
+
+                // Make Sure Format Valid
+                file_path_len = strlen(optarg);
+                if ((file_path_len == 0) || ((size_t)file_path_len >= sizeof(g_fwid_cache_file_path)))
+                {
+                    ERROR_PRINTF("%s: FWID Cache File Path (%s) Invalid!\r\n", __func__, optarg);
+                    err = TP_ERR_INVALID_PARAM;
+                    goto PROCESS_PARAM_EXIT;
+                }
+
+                // Enable FWID Resolution Cache
+                g_fwid_cache = true;
+
+                // Set FWID Cache File Path
+                memset(g_fwid_cache_file_path, 0, sizeof(g_fwid_cache_file_path));
+                strncpy(g_fwid_cache_file_path, optarg, sizeof(g_fwid_cache_file_path) - 1);
+                DEBUG_PRINTF("%s: FWID Cache: %s, Cache File: \"%s\".\r\n", __func__, (g_fwid_cache) ? "Enable" : "Disable", g_fwid_cache_file_path);
+                break;
+
+            case 'r': /* Revalidate FWID Resolution Cache */
+
+                // Ignore Cached Result & Rewrite Cache
+                g_revalidate_cache = true;
+                DEBUG_PRINTF("%s: Revalidate FWID Cache: %s.\r\n", __func__, (g_revalidate_cache) ? "Enable" : "Disable");
+                break;
+
+            case 'C': /* Compile FWID Mapping Table */
+
+                // Compile Mapping File into Binary Image
+                g_compile_mapping = true;
+                DEBUG_PRINTF("%s: Compile FWID Mapping Table: %s.\r\n", __func__, (g_compile_mapping) ? "Enable" : "Disable");
+                break;
+
+            case 'b': /* Benchmark */
+
+                // Make Sure Benchmark Name Valid
+                if ((strcmp(optarg, "mapping") != 0) && (strcmp(optarg, "page_read") != 0))
+                {
+                    ERROR_PRINTF("%s: Unknown Benchmark: \"%s\"!\r\n", __func__, optarg);
+                    err = TP_ERR_INVALID_PARAM;
+                    goto PROCESS_PARAM_EXIT;
+                }
+
+                // Set Benchmark
+                memset(g_benchmark, 0, sizeof(g_benchmark));
+                strncpy(g_benchmark, optarg, sizeof(g_benchmark) - 1);
+                DEBUG_PRINTF("%s: Benchmark: \"%s\".\r\n", __func__, g_benchmark);
+                break;
+
+            case 't': /* Concurrent Mode */
+
+                // Resolve Panel EDID & Mapping File on Worker Thread
+                g_concurrent = true;
+                DEBUG_PRINTF("%s: Concurrent Mode: %s.\r\n", __func__, (g_concurrent) ? "Enable" : "Disable");
+                break;
+
+            case 'D': /* Daemon Mode (Socket Path) */
+
+                // Make Sure Path Valid
+                if((strlen(optarg) == 0) || (strlen(optarg) >= sizeof(g_daemon_socket_path)))
+                {
+                    ERROR_PRINTF("%s: Invalid Socket Path \"%s\"!\r\n", __func__, optarg);
+                    err = TP_ERR_INVALID_PARAM;
+                    goto PROCESS_PARAM_EXIT;
+                }
+                strncpy(g_daemon_socket_path, optarg, sizeof(g_daemon_socket_path) - 1);
+                g_daemon = true;
+                DEBUG_PRINTF("%s: Daemon Socket: \"%s\".\r\n", __func__, g_daemon_socket_path);
+                break;
+
+            case 'Q': /* Client Mode (Request) */
+
+                // Make Sure Request Valid
+                if((strlen(optarg) == 0) || (strlen(optarg) >= sizeof(g_daemon_request)))
+                {
+                    ERROR_PRINTF("%s: Invalid Request \"%s\"!\r\n", __func__, optarg);
+                    err = TP_ERR_INVALID_PARAM;
+                    goto PROCESS_PARAM_EXIT;
+                }
+                strncpy(g_daemon_request, optarg, sizeof(g_daemon_request) - 1);
+                g_daemon_query = true;
+                DEBUG_PRINTF("%s: Daemon Request: \"%s\".\r\n", __func__, g_daemon_request);
+                break;
+
+            case 'W': /* Watch Mode */
+
+                // Wait for Kernel Uevents
+                g_watch = true;
+                DEBUG_PRINTF("%s: Watch Mode: %s.\r\n", __func__, (g_watch) ? "Enable" : "Disable");
+                break;
+
+            case 'U': /* Watch Mode (Replay Recorded Uevents) */
+
+                // Make Sure Path Valid
+                if((strlen(optarg) == 0) || (strlen(optarg) >= sizeof(g_uevent_replay_file_path)))
+                {
+                    ERROR_PRINTF("%s: Invalid Uevent File Path \"%s\"!\r\n", __func__, optarg);
+                    err = TP_ERR_INVALID_PARAM;
+                    goto PROCESS_PARAM_EXIT;
+                }
+                strncpy(g_uevent_replay_file_path, optarg, sizeof(g_uevent_replay_file_path) - 1);
+                g_uevent_replay = true;
+                g_watch = true;
+                DEBUG_PRINTF("%s: Uevent Replay File: \"%s\".\r\n", __func__, g_uevent_replay_file_path);
+                break;
+
+            case 'M': /* Multi-Device Mode */
+
+                // Read All Elan Touch Controllers in Parallel
+                g_multi_device = true;
+                DEBUG_PRINTF("%s: Multi-Device Mode: %s.\r\n", __func__, (g_multi_device) ? "Enable" : "Disable");
+                break;
+
+            case 'R': /* Retry Policy */
+
+                // Make Sure Format Valid
+                err = parse_retry_policy(optarg, &retry_policy);
+                if (err != TP_SUCCESS)
+                {
+                    ERROR_PRINTF("%s: Retry Policy (%s) Invalid!\r\n", __func__, optarg);
+                    goto PROCESS_PARAM_EXIT;
+                }
+
+                // Apply to All Operations with Error Retry
+                set_retry_policy_override(&retry_policy);
+                DEBUG_PRINTF("%s: Retry Policy: \"%s\".\r\n", __func__, optarg);
+                break;
+
+            case 'S': /* Simulated Touch Controller */
+
+                // Make Sure Config Valid (Items Checked when Simulator Created)
+                if(strlen(optarg) >= sizeof(g_simulator_config))
+                {
+                    ERROR_PRINTF("%s: Invalid Simulator Config \"%s\"!\r\n", __func__, optarg);
+                    err = TP_ERR_INVALID_PARAM;
+                    goto PROCESS_PARAM_EXIT;
+                }
+                strncpy(g_simulator_config, optarg, sizeof(g_simulator_config) - 1);
+                g_simulator = true;
+                DEBUG_PRINTF("%s: Simulator: \"%s\".\r\n", __func__, g_simulator_config);
+                break;
+
+            case 'H': /* Virtual Device through uhid */
+
+                // Make Sure Config Valid (Items Checked when Virtual Device Created)
+                if(strlen(optarg) >= sizeof(g_uhid_config))
+                {
+                    ERROR_PRINTF("%s: Invalid uhid Config \"%s\"!\r\n", __func__, optarg);
+                    err = TP_ERR_INVALID_PARAM;
+                    goto PROCESS_PARAM_EXIT;
+                }
+                strncpy(g_uhid_config, optarg, sizeof(g_uhid_config) - 1);
+                g_uhid = true;
+                DEBUG_PRINTF("%s: uhid: \"%s\".\r\n", __func__, g_uhid_config);
+                break;
+
+            case 'k': /* Record HID Transaction Trace */
+
+                // Make Sure File Path Valid
+                if(strlen(optarg) >= sizeof(g_trace_record_file_path))
+                {
+                    ERROR_PRINTF("%s: Invalid Trace File Path \"%s\"!\r\n", __func__, optarg);
+                    err = TP_ERR_INVALID_PARAM;
+                    goto PROCESS_PARAM_EXIT;
+                }
+                strncpy(g_trace_record_file_path, optarg, sizeof(g_trace_record_file_path) - 1);
+                g_trace_record = true;
+                DEBUG_PRINTF("%s: Trace Record: \"%s\".\r\n", __func__, g_trace_record_file_path);
+                break;
+
+            case 'K': /* Replay HID Transaction Trace */
+
+                // Make Sure File Path Valid, Speed Follows Last Comma (Default: Original)
+                if(strlen(optarg) >= sizeof(g_trace_replay_file_path))
+                {
+                    ERROR_PRINTF("%s: Invalid Trace File Path \"%s\"!\r\n", __func__, optarg);
+                    err = TP_ERR_INVALID_PARAM;
+                    goto PROCESS_PARAM_EXIT;
+                }
+                strncpy(g_trace_replay_file_path, optarg, sizeof(g_trace_replay_file_path) - 1);
+                p_speed = strrchr(g_trace_replay_file_path, ',');
+                if(p_speed != NULL)
+                {
+                    *p_speed++ = '\0';
+                    speed = strtol(p_speed, &p_end, 10);
+                    if((*p_speed == '\0') || (*p_end != '\0') || (speed < 0))
+                    {
+                        ERROR_PRINTF("%s: Invalid Replay Speed \"%s\"!\r\n", __func__, p_speed);
+                        err = TP_ERR_INVALID_PARAM;
+                        goto PROCESS_PARAM_EXIT;
+                    }
+                    g_trace_replay_speed = (unsigned int)speed;
+                }
+                g_trace_replay = true;
+                DEBUG_PRINTF("%s: Trace Replay: \"%s\" (Speed %u).\r\n", __func__, g_trace_replay_file_path, g_trace_replay_speed);
+                break;
+
+            case 'T': /* Profile Report */
+
+                // Make Sure Format Valid (Default: Table)
+                err = parse_profile_format(optarg, &g_profile_format);
+                if(err != TP_SUCCESS)
+                {
+                    ERROR_PRINTF("%s: Invalid Profile Format \"%s\"!\r\n", __func__, optarg);
+                    goto PROCESS_PARAM_EXIT;
+                }
+                g_profile = true;
+                DEBUG_PRINTF("%s: Profile: %s.\r\n", __func__, (g_profile_format == PROFILE_FORMAT_JSON) ? "json" : "table");
+                break;
+
             case 'i': /* Sytem Information */
 
                 // Show System Information
@@ -775,6 +2736,27 @@ int process_parameter(int argc, char **argv)
         }
     }
 
+    // Trace Covers One Device Handle of Main Thread Only
+    if(((g_trace_record == true) || (g_trace_replay == true)) && \
+       ((g_multi_device == true) || (g_watch == true) || (g_daemon == true)))
+    {
+        ERROR_PRINTF("%s: \"-k\" / \"-K\" Can Not Be Used with \"-M\", \"-W\", \"-U\" or \"-D\"!\r\n", __func__);
+        err = TP_ERR_INVALID_PARAM;
+        goto PROCESS_PARAM_EXIT;
+    }
+
+    // Compile mode only requires mapping file
+    if(g_compile_mapping == true)
+    {
+        if(g_lookup_fwid == false)
+        {
+            ERROR_PRINTF("%s: Please Input FW Mapping File!\r\n", __func__);
+            err = TP_ERR_INVALID_PARAM;
+            goto PROCESS_PARAM_EXIT;
+        }
+        return TP_SUCCESS;
+    }
+
     // Make sure mapping file and system type set at the same time
     if((g_lookup_fwid == true) && (g_system_type == UNKNOWN))
     {
@@ -784,10 +2766,24 @@ int process_parameter(int argc, char **argv)
     }
     if((g_system_type != UNKNOWN) && (g_lookup_fwid == false))
     {
+        // Built-in Mapping Table Only (No File I/O)
+        if(get_default_fwid_mapping_entry_count() > 0)
+        {
+            g_lookup_fwid = true;
+            DEBUG_PRINTF("%s: FWID Lookup: Enable, Built-in Mapping Table Only.\r\n", __func__);
+            return TP_SUCCESS;
+        }
+
         ERROR_PRINTF("%s: Please Input FW Mapping File!\r\n", __func__);
         err = TP_ERR_INVALID_PARAM;
         goto PROCESS_PARAM_EXIT;
     }
+    if((g_revalidate_cache == true) && (g_fwid_cache == false))
+    {
+        ERROR_PRINTF("%s: Please Input FWID Cache File!\r\n", __func__);
+        err = TP_ERR_INVALID_PARAM;
+        goto PROCESS_PARAM_EXIT;
+    }
 
     return TP_SUCCESS;
 
@@ -805,7 +2801,9 @@ int main(int argc, char **argv)
     int err = TP_SUCCESS;
     bool recovery = false,		// True if Recovery Mode
          gen8_touch = false,	// True if Gen8 Touch
-         edid_info_found = true;
+         edid_info_found = true,
+         cache_hit = false;		// True if FWID Resolved from Cache
+    struct system_info_task system_info_task;
     unsigned char hello_packet = 0;
     unsigned short fw_bc_version = 0,
                    bc_bc_version = 0,
@@ -815,11 +2813,22 @@ int main(int argc, char **argv)
                    edid_manufacturer_code = 0,
                    edid_product_code = 0;
     struct hidraw_devinfo hid_dev_info[DEV_INFO_SET_MAX];
-    struct lcm_dev_info   lcm_panel_info[DEV_INFO_SET_MAX];
+    struct lcm_dev_table  lcm_dev_table;
+    struct fwid_cache_key  cache_key;
+    struct fwid_cache_data cache_data;
+    struct daemon_state daemon_state;
 
     // Initialize Data Variables
     memset(hid_dev_info, 0, sizeof(hid_dev_info));
-    memset(lcm_panel_info, 0, sizeof(lcm_panel_info));
+    init_lcm_dev_table(&lcm_dev_table);
+    memset(&cache_key, 0, sizeof(cache_key));
+    memset(&cache_data, 0, sizeof(cache_data));
+    memset(&daemon_state, 0, sizeof(daemon_state));
+    memset(&system_info_task, 0, sizeof(system_info_task));
+    system_info_task.p_hid_dev_info = hid_dev_info;
+    system_info_task.hid_dev_info_size = sizeof(hid_dev_info);
+    system_info_task.p_lcm_dev_table = &lcm_dev_table;
+    g_start_time_us = get_monotonic_time_us();
 
     /* Process Parameter */
     err = process_parameter(argc, argv);
@@ -838,78 +2847,118 @@ int main(int argc, char **argv)
         goto EXIT;
     }
 
+    /* Compile FWID Mapping Table (No Device Required) */
+    if(g_compile_mapping == true)
+    {
+        err = compile_fwid_mapping_image(g_fwid_mapping_file_path);
+        goto EXIT;
+    }
+
+    /* Run Benchmark (No Device Required) */
+    if(strcmp(g_benchmark, "mapping") == 0)
+    {
+        err = benchmark_fwid_mapping_file(BENCHMARK_MAPPING_ROW_COUNT);
+        goto EXIT;
+    }
+
+    /* Query Daemon (Client Mode, No Device Required) */
+    if(g_daemon_query == true)
+    {
+        err = run_daemon_query();
+        goto EXIT;
+    }
+
+    /* Run Watch Mode (Each Change Queries Its Own Device) */
+    if(g_watch == true)
+    {
+        err = run_watch();
+        goto EXIT;
+    }
+
+    /* Run Multi-Device Mode (Each Worker Opens Its Own Device) */
+    if(g_multi_device == true)
+    {
+        err = run_multi_device();
+        goto EXIT;
+    }
+
     /* Initialize Resource */
+    begin_phase(PHASE_RESOURCE_INIT);
     err = resource_init();
+    end_phase(PHASE_RESOURCE_INIT);
     if (err != TP_SUCCESS)
         goto EXIT1;
 
+    /* Start System Info. Task (Concurrent Mode) */
+    if(g_concurrent == true)
+    {
+        err = start_system_info_task(&system_info_task);
+        if (err != TP_SUCCESS)
+            goto EXIT1;
+    }
+
     /* Open Device */
+    begin_phase(PHASE_OPEN_DEVICE);
     err = open_device() ;
+    end_phase(PHASE_OPEN_DEVICE);
     if (err != TP_SUCCESS)
     {
         ERROR_PRINTF("Fail to Open Device! err=0x%x.\r\n", err);
         goto EXIT2;
     }
 
-    /* Detect Touch State */
-
-    // Get Hello Packet
-    err = get_hello_packet_bc_version_with_error_retry(&hello_packet, &bc_bc_version, ERROR_RETRY_COUNT);
-    if(err != TP_SUCCESS)
+    /* Run Page Read Benchmark (Device Required) */
+    if(strcmp(g_benchmark, "page_read") == 0)
     {
-        ERROR_PRINTF("Fail to Get Hello Packet (& BC Version)! err=0x%x.\r\n", err);
+        err = benchmark_page_read(BENCHMARK_PAGE_READ_COUNT);
         goto EXIT2;
     }
-    DEBUG_PRINTF("Hello Packet: 0x%02x, Recovery Mode BC Version: 0x%04x.\r\n", hello_packet, bc_bc_version);
 
-    // Identify HW Series & Touch State
-    switch (hello_packet)
+    /* Look up FWID Resolution Cache (Panel Info. Taken Only when Key is Built) */
+    // [Note] System information (-i) is always collected from device.
+    if((g_fwid_cache == true) && (g_show_system_info == false) && (g_daemon == false))
     {
-        case ELAN_I2CHID_NORMAL_MODE_HELLO_PACKET:
-            // BC Version (Normal Mode)
-            err = get_boot_code_version(&fw_bc_version);
-            if(err != TP_SUCCESS)
-            {
-                ERROR_PRINTF("%s: Fail to Get BC Version (Normal Mode)! err=0x%x.\r\n", __func__, err);
-                goto EXIT2;
-            }
-            DEBUG_PRINTF("Normal Mode BC Version: 0x%04x.\r\n", fw_bc_version);
-
-            // Special Case: First BC of EM32F901 / EM32F902
-            if((HIGH_BYTE(fw_bc_version) == BC_VER_H_BYTE_FOR_EM32F901_I2CHID) /* EM32F901 */ ||
-               (HIGH_BYTE(fw_bc_version) == BC_VER_H_BYTE_FOR_EM32F902_I2CHID) /* FM32F902 */)
-                gen8_touch = true;	// Gen8 Touch
-            else
-                gen8_touch = false;	// Gen5/6/7 Touch
-            recovery = false;		// Normal Mode
-            break;
-
-        case ELAN_GEN8_I2CHID_NORMAL_MODE_HELLO_PACKET:
-            gen8_touch = true;		// Gen8 Touch
-            recovery = false;		// Normal Mode
-            break;
-
-        case ELAN_I2CHID_RECOVERY_MODE_HELLO_PACKET:
-            // Special Case: First BC of EM32F901 / EM32F902
-            if((HIGH_BYTE(bc_bc_version) == BC_VER_H_BYTE_FOR_EM32F901_I2CHID) /* EM32F901 */ ||
-               (HIGH_BYTE(bc_bc_version) == BC_VER_H_BYTE_FOR_EM32F902_I2CHID) /* FM32F902 */)
-                gen8_touch = true;	// Gen8 Touch
-            else
-                gen8_touch = false;	// Gen5/6/7 Touch
-            recovery = true;		// Recovery Mode
-            break;
+        begin_phase(PHASE_FWID_CACHE);
+        err = lookup_fwid_cache(&system_info_task, &cache_key, &cache_data);
+        end_phase(PHASE_FWID_CACHE);
+        cache_hit = (err == TP_SUCCESS);
+        DEBUG_PRINTF("FWID Cache %s.\r\n", (cache_hit) ? "Hit" : "Miss");
+    }
 
-        case ELAN_GEN8_I2CHID_RECOVERY_MODE_HELLO_PACKET:
-            gen8_touch = true;		// Gen8 Touch
-            recovery = true;		// Recovery Mode
-            break;
+    // Serial Mode: Skip Mapping File Parsing on Cache Hit (Worker of Concurrent Mode is Already Loading It)
+    if(g_concurrent == false)
+        system_info_task.cache_hit = cache_hit;
 
-        default:
-            ERROR_PRINTF("%s: Unknown Hello Packet! (0x%02x) \r\n", __func__, hello_packet);
-            err = TP_UNKNOWN_DEVICE_TYPE;
+    if(cache_hit == true) // Resolved from Cache, Skip Touch Controller I/O & Mapping File Parsing
+    {
+        hello_packet = cache_data.hello_packet;
+        fw_bc_version = cache_data.fw_bc_version;
+        bc_bc_version = cache_data.bc_bc_version;
+        gen8_touch = ((cache_data.flags & FWID_CACHE_FLAG_GEN8_TOUCH) != 0);
+        recovery = ((cache_data.flags & FWID_CACHE_FLAG_RECOVERY) != 0);
+        info_fwid = cache_data.info_fwid;
+    }
+    else
+    {
+        /* Get Touch Info. */
+        begin_phase(PHASE_TOUCH_INFO);
+        err = get_touch_info(&hello_packet, &fw_bc_version, &bc_bc_version, &gen8_touch, &recovery, &info_fwid);
+        end_phase(PHASE_TOUCH_INFO);
+        if (err != TP_SUCCESS)
             goto EXIT2;
     }
 
+    /* Get Panel Info. (Concurrent Mode: Read by Worker while Touch Controller was Queried) */
+    err = take_panel_info(&system_info_task);
+    if (err != TP_SUCCESS)
+    {
+        ERROR_PRINTF("Fail to Get Panel Info.! err=0x%x.\r\n", err);
+        goto EXIT2;
+    }
+    edid_info_found = system_info_task.edid_info_found;
+    edid_manufacturer_code = system_info_task.edid_manufacturer_code;
+    edid_product_code = system_info_task.edid_product_code;
+
     // Check if Recovery Mode
     if(recovery == true)
     {
@@ -918,33 +2967,54 @@ int main(int argc, char **argv)
     }
 
     /* Get System Info. */
-    err = get_system_info(hid_dev_info, sizeof(hid_dev_info), \
-                          &edid_manufacturer_code, &edid_product_code, &edid_info_found, \
-                          g_fwid_mapping_file_path, sizeof(g_fwid_mapping_file_path), \
-                          lcm_panel_info, sizeof(lcm_panel_info));
+    if(g_concurrent == true)
+        stop_system_info_task(&system_info_task); // Join
+    else
+        run_system_info_task(&system_info_task);
+    err = system_info_task.system_info_err;
     if (err != TP_SUCCESS)
     {
         ERROR_PRINTF("Fail to Get System Info.! err=0x%x.\r\n", err);
         goto EXIT2;
     }
 
-    /* Read Information FWID */
-    if(gen8_touch) // Gen8 Touch
-        err = gen8_read_info_fwid(&info_fwid, recovery);
-    else // Gen5/6/7 Touch
-        err = read_info_fwid(&info_fwid, recovery);
-    if (err != TP_SUCCESS)
+    /* Update FWID Resolution Cache */
+    if((g_fwid_cache == true) && (cache_hit == false) && (cache_key.hid_vid != 0))
     {
-        ERROR_PRINTF("Fail to Read Information FWID! err=0x%x.\r\n", err);
+        update_fwid_cache(&cache_key, hello_packet, fw_bc_version, bc_bc_version, gen8_touch, recovery, \
+                          info_fwid, edid_info_found, edid_manufacturer_code, edid_product_code, \
+                          &lcm_dev_table);
+    }
+
+    /* Run Daemon (Answer Queries from Memory until Stopped) */
+    if(g_daemon == true)
+    {
+        daemon_state.hello_packet = hello_packet;
+        daemon_state.fw_bc_version = fw_bc_version;
+        daemon_state.bc_bc_version = bc_bc_version;
+        daemon_state.gen8_touch = gen8_touch;
+        daemon_state.recovery = recovery;
+        daemon_state.info_fwid = info_fwid;
+        daemon_state.edid_info_found = edid_info_found;
+        daemon_state.edid_manufacturer_code = edid_manufacturer_code;
+        daemon_state.edid_product_code = edid_product_code;
+        daemon_state.p_hid_dev_info = hid_dev_info;
+        daemon_state.hid_dev_info_size = sizeof(hid_dev_info);
+        daemon_state.p_lcm_dev_table = &lcm_dev_table;
+
+        err = run_daemon(&daemon_state);
         goto EXIT2;
     }
 
+    /* Output */
+    begin_phase(PHASE_OUTPUT);
+
     /* Show System Information */
     if(g_show_system_info == true)
     {
         err = show_system_info(hid_dev_info, sizeof(hid_dev_info), \
                                edid_info_found, edid_manufacturer_code, edid_product_code, \
-                               g_lookup_fwid, lcm_panel_info, sizeof(lcm_panel_info), \
+                               g_lookup_fwid, &lcm_dev_table, \
                                info_fwid);
         if (err != TP_SUCCESS)
         {
@@ -966,10 +3036,18 @@ int main(int argc, char **argv)
 
     if(g_lookup_fwid == true) // Lookup FWID has been Requested
     {
-        if(edid_info_found == true) // EDID Info. Found
+        if((cache_hit == true) && (edid_info_found == true)) // Resolved from Cache
+        {
+            if(g_system_type == CHROME)
+                fwid = ((cache_data.flags & FWID_CACHE_FLAG_CHROME_FWID_FOUND) != 0) ? cache_data.chrome_fwid : info_fwid;
+            else // if(g_system_type == WINDOWS)
+                fwid = ((cache_data.flags & FWID_CACHE_FLAG_WINDOWS_FWID_FOUND) != 0) ? cache_data.windows_fwid : info_fwid;
+            DEBUG_PRINTF("FWID from Cache: 0x%x.\r\n", fwid);
+        }
+        else if(edid_info_found == true) // EDID Info. Found
         {
             /* Get FWID from EDID */
-            err = get_fwid_from_edid(lcm_panel_info, sizeof(lcm_panel_info), edid_manufacturer_code, edid_product_code, g_system_type, &fwid_from_edid);
+            err = get_fwid_from_edid(&lcm_dev_table, edid_manufacturer_code, edid_product_code, g_system_type, &fwid_from_edid);
             if (err == TP_SUCCESS) // FWID from EDID Found
             {
                 DEBUG_PRINTF("fwid_from_edid Found: 0x%x.\r\n", fwid_from_edid);
@@ -1006,16 +3084,35 @@ int main(int argc, char **argv)
         }
     }
 
+    end_phase(PHASE_OUTPUT);
+
     // Success
     err = TP_SUCCESS;
 
 EXIT2:
+    /* Stop System Info. Task */
+    stop_system_info_task(&system_info_task);
+
     /* Close Device */
     close_device();
 
+    /* Show Phase Timing */
+    show_phase_timing();
+
+    /* Show Report Statistics */
+    show_report_statistics();
+
+    /* Show Retry Statistics */
+    show_retry_statistics();
+
+    /* Show Profile Report */
+    if(g_profile == true)
+        show_profile(stderr, g_profile_format, (g_concurrent) ? "Concurrent" : "Serial", g_phase_timing, PHASE_COUNT, get_elapsed_time_us(g_start_time_us));
+
 EXIT1:
     /* Release Resource */
     resource_free();
+    free_lcm_dev_table(&lcm_dev_table);
 
 EXIT:
     /* End of Output Stream */
@@ -0,0 +1,435 @@
+/** @file
+
+  Build-time Generator of Default (Built-in) FWID Mapping Table.
+
+  Copyright (c) ELAN microelectronics corp. 2022, All Rights Reserved
+
+  Module Name:
+	GenDefaultFwidMappingTable.cpp
+
+  Environment:
+	Build Host (Linux-like Platform).
+
+  Usage:
+	GenDefaultFwidMappingTable <fwid_mapping_table.txt> <output_header>
+
+  Reads the FWID mapping table (same columns as parse_fwid_mapping_file()) and
+  writes a header with a perfect hash table of panel keys:
+	bucket = hash(panel_key, 0) & (bucket_count - 1)
+	slot   = hash(panel_key, seed[bucket]) & (slot_count - 1)
+  Lookup is two hashes and one key compare.
+
+**/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ErrCode.h"
+#include "ElanTsDefaultFwidMappingUtility.h"
+
+/***************************************************
+ * Definitions
+ ***************************************************/
+
+// Maximum Seed Tried per Bucket before Growing Slot Array
+#ifndef GEN_SEED_TRY_MAX
+#define GEN_SEED_TRY_MAX	(1 << 20)
+#endif //GEN_SEED_TRY_MAX
+
+/***************************************************
+ * Global Variable Declaration
+ ***************************************************/
+
+bool g_debug = false;
+
+/***************************************************
+ * Function Implements
+ ***************************************************/
+
+static size_t get_power_of_2(size_t value)
+{
+    size_t power_of_2 = 1;
+
+    while (power_of_2 < value)
+        power_of_2 <<= 1;
+
+    return power_of_2;
+}
+
+// Parse "mmmm.pppp" (Hex) into Panel Key
+static bool parse_panel_key(const char *panel_info, uint32_t *p_panel_key)
+{
+    char *p_end = NULL;
+    unsigned long manufacturer_code = 0,
+                  product_code = 0;
+
+    manufacturer_code = strtoul(panel_info, &p_end, 16);
+    if ((p_end == panel_info) || (*p_end != '.') || (manufacturer_code == 0) || (manufacturer_code > 0xFFFF))
+        return false;
+
+    panel_info = p_end + 1;
+    product_code = strtoul(panel_info, &p_end, 16);
+    if ((p_end == panel_info) || ((*p_end != '\0') && (*p_end != '\r') && (*p_end != '\n')) || (product_code > 0xFFFF))
+        return false;
+
+    *p_panel_key = LCM_PANEL_KEY(manufacturer_code, product_code);
+    return true;
+}
+
+// Sort Row Indexes by (Panel Key, Row)
+static const struct fwid_mapping_image_entry *g_p_sort_entry = NULL;
+
+static int compare_entry_row(const void *p_row1, const void *p_row2)
+{
+    size_t row1 = *(const size_t *)p_row1,
+           row2 = *(const size_t *)p_row2;
+
+    if (g_p_sort_entry[row1].panel_key != g_p_sort_entry[row2].panel_key)
+        return (g_p_sort_entry[row1].panel_key > g_p_sort_entry[row2].panel_key) ? 1 : -1;
+
+    return (row1 > row2) - (row1 < row2);
+}
+
+static size_t remove_duplicated_entry(struct fwid_mapping_image_entry *p_entry, size_t entry_count)
+{
+    size_t *p_row = NULL,
+           index = 0,
+           unique_count = 0;
+    bool *p_duplicated = NULL;
+
+    if (entry_count == 0)
+        return 0;
+
+    p_row = (size_t *)calloc(entry_count, sizeof(size_t));
+    p_duplicated = (bool *)calloc(entry_count, sizeof(bool));
+    if ((p_row == NULL) || (p_duplicated == NULL))
+    {
+        unique_count = entry_count;
+        goto REMOVE_DUPLICATED_ENTRY_EXIT;
+    }
+
+    for (index = 0; index < entry_count; index++)
+        p_row[index] = index;
+    g_p_sort_entry = p_entry;
+    qsort(p_row, entry_count, sizeof(size_t), compare_entry_row);
+
+    for (index = 1; index < entry_count; index++)
+    {
+        if (p_entry[p_row[index]].panel_key == p_entry[p_row[index - 1]].panel_key)
+            p_duplicated[p_row[index]] = true;
+    }
+
+    for (index = 0; index < entry_count; index++)
+    {
+        if (p_duplicated[index] == false)
+            p_entry[unique_count++] = p_entry[index];
+    }
+
+REMOVE_DUPLICATED_ENTRY_EXIT:
+    free(p_row);
+    free(p_duplicated);
+
+    return unique_count;
+}
+
+static int read_mapping_file(const char *p_mapping_file_path, struct fwid_mapping_image_entry **pp_entry, size_t *p_entry_count)
+{
+    int err = TP_SUCCESS,
+        token_index = 0;
+    bool panel_key_valid = false;
+    uint32_t panel_key = 0;
+    unsigned short chrome_fwid = 0,
+                   windows_fwid = 0;
+    char line[1024] = {0},
+         *token = NULL,
+         *p_next_token = NULL;
+    size_t entry_count = 0,
+           entry_capacity = 0;
+    struct fwid_mapping_image_entry *p_entry = NULL;
+    FILE *p_fd_mapping_file = NULL;
+
+    p_fd_mapping_file = fopen(p_mapping_file_path, "r");
+    if (p_fd_mapping_file == NULL)
+    {
+        fprintf(stderr, "%s: Fail to open \"%s\"!\n", __func__, p_mapping_file_path);
+        err = TP_ERR_FILE_NOT_FOUND;
+        goto READ_MAPPING_FILE_EXIT;
+    }
+
+    while (fgets(line, sizeof(line), p_fd_mapping_file) != NULL)
+    {
+        token_index = 0;
+        panel_key_valid = false;
+        chrome_fwid = 0;
+        windows_fwid = 0;
+
+        // Split by ',' (Empty Fields Kept)
+        token = line;
+        while (token != NULL)
+        {
+            p_next_token = strchr(token, ',');
+            if (p_next_token != NULL)
+                *p_next_token++ = '\0';
+
+            if ((strcmp(token, "\n") != 0) && (strcmp(token, "\r\n") != 0) && (strcmp(token, "") != 0))
+            {
+                if (token_index == 0)
+                    panel_key_valid = parse_panel_key(token, &panel_key);
+                else if ((token_index == 1) && (strlen(token) < FWID_LENGTH_MAX))
+                    chrome_fwid = strtol(token, NULL, 16);
+                else if ((token_index == 2) && (strlen(token) < FWID_LENGTH_MAX))
+                    windows_fwid = strtol(token, NULL, 16);
+            }
+
+            token = p_next_token;
+            token_index++;
+        }
+
+        if (panel_key_valid == false)
+            continue;
+
+        if (entry_count == entry_capacity)
+        {
+            entry_capacity = (entry_capacity == 0) ? LCM_DEV_TABLE_INIT_CAPACITY : (entry_capacity * 2);
+            p_entry = (struct fwid_mapping_image_entry *)realloc(p_entry, entry_capacity * sizeof(struct fwid_mapping_image_entry));
+            if (p_entry == NULL)
+            {
+                err = TP_ERR_NO_INTERFACE_CREATE;
+                goto READ_MAPPING_FILE_EXIT;
+            }
+        }
+        p_entry[entry_count].panel_key = panel_key;
+        p_entry[entry_count].chrome_fwid = chrome_fwid;
+        p_entry[entry_count].windows_fwid = windows_fwid;
+        entry_count++;
+    }
+
+    // Keep First Row of Duplicated Panel
+    entry_count = remove_duplicated_entry(p_entry, entry_count);
+
+    *pp_entry = p_entry;
+    *p_entry_count = entry_count;
+    p_entry = NULL;
+
+READ_MAPPING_FILE_EXIT:
+    if (p_fd_mapping_file != NULL)
+        fclose(p_fd_mapping_file);
+    free(p_entry);
+
+    return err;
+}
+
+// Hash-and-Displace: Place Largest Buckets First, Search a Seed per Bucket
+static bool build_perfect_hash(const struct fwid_mapping_image_entry *p_entry, size_t entry_count, \
+                               size_t bucket_count, size_t slot_count, \
+                               uint32_t *p_seed, struct fwid_mapping_image_entry *p_slot)
+{
+    size_t *p_bucket_start = NULL,	// Members of Bucket b: p_bucket_member[p_bucket_start[b] .. p_bucket_start[b + 1])
+           *p_bucket_member = NULL,
+           *p_bucket_order = NULL,
+           *p_size_start = NULL,
+           *p_bucket_fill = NULL,
+           max_bucket_size = 0,
+           member_count = 0,
+           index = 0,
+           order = 0,
+           member = 0,
+           size = 0;
+    uint32_t bucket = 0,
+             seed = 0,
+             *p_member_slot = NULL;
+    bool *p_used = NULL,
+         placed = false,
+         success = false;
+
+    p_bucket_start = (size_t *)calloc(bucket_count + 1, sizeof(size_t));
+    p_bucket_member = (size_t *)calloc(entry_count + 1, sizeof(size_t));
+    p_bucket_order = (size_t *)calloc(bucket_count, sizeof(size_t));
+    p_member_slot = (uint32_t *)calloc(entry_count + 1, sizeof(uint32_t));
+    p_bucket_fill = (size_t *)calloc(bucket_count, sizeof(size_t));
+    p_used = (bool *)calloc(slot_count, sizeof(bool));
+    if ((p_bucket_start == NULL) || (p_bucket_member == NULL) || (p_bucket_order == NULL) || (p_member_slot == NULL) || \
+        (p_bucket_fill == NULL) || (p_used == NULL))
+        goto BUILD_PERFECT_HASH_EXIT;
+
+    memset(p_seed, 0, bucket_count * sizeof(uint32_t));
+    memset(p_slot, 0, slot_count * sizeof(struct fwid_mapping_image_entry));
+
+    // Group Entries by Bucket (Counting Sort)
+    for (index = 0; index < entry_count; index++)
+        p_bucket_start[(get_default_fwid_mapping_hash(p_entry[index].panel_key, 0) & (bucket_count - 1)) + 1]++;
+    for (index = 0; index < bucket_count; index++)
+    {
+        if (p_bucket_start[index + 1] > max_bucket_size)
+            max_bucket_size = p_bucket_start[index + 1];
+        p_bucket_start[index + 1] += p_bucket_start[index];
+    }
+    for (index = 0; index < entry_count; index++)
+    {
+        bucket = get_default_fwid_mapping_hash(p_entry[index].panel_key, 0) & (bucket_count - 1);
+        p_bucket_member[p_bucket_start[bucket] + p_bucket_fill[bucket]++] = index;
+    }
+
+    // Order Buckets by Size, Descending (Counting Sort)
+    p_size_start = (size_t *)calloc(max_bucket_size + 2, sizeof(size_t));
+    if (p_size_start == NULL)
+        goto BUILD_PERFECT_HASH_EXIT;
+    for (index = 0; index < bucket_count; index++)
+        p_size_start[max_bucket_size - (p_bucket_start[index + 1] - p_bucket_start[index]) + 1]++;
+    for (size = 0; size <= max_bucket_size; size++)
+        p_size_start[size + 1] += p_size_start[size];
+    for (index = 0; index < bucket_count; index++)
+        p_bucket_order[p_size_start[max_bucket_size - (p_bucket_start[index + 1] - p_bucket_start[index])]++] = index;
+
+    for (order = 0; order < bucket_count; order++)
+    {
+        bucket = p_bucket_order[order];
+        member_count = p_bucket_start[bucket + 1] - p_bucket_start[bucket];
+        if (member_count == 0)
+            break;
+
+        // Search Seed Placing All Members into Distinct Free Slots
+        placed = false;
+        for (seed = 1; seed < GEN_SEED_TRY_MAX; seed++)
+        {
+            placed = true;
+            for (member = 0; (member < member_count) && (placed == true); member++)
+            {
+                p_member_slot[member] = get_default_fwid_mapping_hash(p_entry[p_bucket_member[p_bucket_start[bucket] + member]].panel_key, seed) & (slot_count - 1);
+                if (p_used[p_member_slot[member]] == true)
+                    placed = false;
+                for (index = 0; (index < member) && (placed == true); index++)
+                {
+                    if (p_member_slot[index] == p_member_slot[member])
+                        placed = false;
+                }
+            }
+            if (placed == true)
+                break;
+        }
+        if (placed == false)
+            goto BUILD_PERFECT_HASH_EXIT;
+
+        p_seed[bucket] = seed;
+        for (member = 0; member < member_count; member++)
+        {
+            p_used[p_member_slot[member]] = true;
+            p_slot[p_member_slot[member]] = p_entry[p_bucket_member[p_bucket_start[bucket] + member]];
+        }
+    }
+
+    success = true;
+
+BUILD_PERFECT_HASH_EXIT:
+    free(p_bucket_start);
+    free(p_bucket_member);
+    free(p_bucket_order);
+    free(p_size_start);
+    free(p_bucket_fill);
+    free(p_member_slot);
+    free(p_used);
+
+    return success;
+}
+
+static uint32_t get_slot_checksum(const struct fwid_mapping_image_entry *p_slot, size_t slot_count)
+{
+    const unsigned char *p_data = (const unsigned char *)p_slot;
+    size_t data_size = slot_count * sizeof(struct fwid_mapping_image_entry),
+           index = 0;
+    uint32_t checksum = 0x811C9DC5;
+
+    for (index = 0; index < data_size; index++)
+    {
+        checksum ^= p_data[index];
+        checksum *= 0x01000193;
+    }
+
+    return checksum;
+}
+
+int main(int argc, char **argv)
+{
+    int err = TP_SUCCESS;
+    size_t entry_count = 0,
+           bucket_count = 0,
+           slot_count = 0,
+           index = 0;
+    uint32_t *p_seed = NULL;
+    struct fwid_mapping_image_entry *p_entry = NULL,
+                                    *p_slot = NULL;
+    FILE *p_fd_header = NULL;
+
+    if (argc != 3)
+    {
+        fprintf(stderr, "Usage: %s <fwid_mapping_table.txt> <output_header>\n", argv[0]);
+        err = TP_ERR_INVALID_PARAM;
+        goto EXIT;
+    }
+
+    err = read_mapping_file(argv[1], &p_entry, &entry_count);
+    if (err != TP_SUCCESS)
+        goto EXIT;
+
+    // Bucket Count ~ n/2, Slot Count >= 2n (Load Factor <= 1/2)
+    bucket_count = get_power_of_2((entry_count / 2) + 1);
+    slot_count = get_power_of_2((entry_count * 2) + 1);
+    while (1)
+    {
+        p_seed = (uint32_t *)realloc(p_seed, bucket_count * sizeof(uint32_t));
+        p_slot = (struct fwid_mapping_image_entry *)realloc(p_slot, slot_count * sizeof(struct fwid_mapping_image_entry));
+        if ((p_seed == NULL) || (p_slot == NULL))
+        {
+            err = TP_ERR_NO_INTERFACE_CREATE;
+            goto EXIT;
+        }
+
+        if (build_perfect_hash(p_entry, entry_count, bucket_count, slot_count, p_seed, p_slot) == true)
+            break;
+
+        slot_count *= 2;
+    }
+
+    p_fd_header = fopen(argv[2], "w");
+    if (p_fd_header == NULL)
+    {
+        fprintf(stderr, "%s: Fail to create \"%s\"!\n", argv[0], argv[2]);
+        err = TP_ERR_FILE_IO_ERROR;
+        goto EXIT;
+    }
+
+    fprintf(p_fd_header, "/** @file\n\n");
+    fprintf(p_fd_header, "  Default (Built-in) FWID Mapping Table.\n\n");
+    fprintf(p_fd_header, "  Generated from \"%s\" by GenDefaultFwidMappingTable. DO NOT EDIT.\n\n", argv[1]);
+    fprintf(p_fd_header, "**/\n\n");
+    fprintf(p_fd_header, "#ifndef _ELAN_TS_DEFAULT_FWID_MAPPING_TABLE_H_\n");
+    fprintf(p_fd_header, "#define _ELAN_TS_DEFAULT_FWID_MAPPING_TABLE_H_\n\n");
+    fprintf(p_fd_header, "#define DEFAULT_FWID_MAPPING_ENTRY_COUNT\t%zu\n", entry_count);
+    fprintf(p_fd_header, "#define DEFAULT_FWID_MAPPING_BUCKET_COUNT\t%zu\n", bucket_count);
+    fprintf(p_fd_header, "#define DEFAULT_FWID_MAPPING_SLOT_COUNT\t\t%zu\n", slot_count);
+    fprintf(p_fd_header, "#define DEFAULT_FWID_MAPPING_CHECKSUM\t\t0x%08X\n\n", get_slot_checksum(p_slot, slot_count));
+
+    fprintf(p_fd_header, "static const uint32_t g_default_fwid_mapping_seed[DEFAULT_FWID_MAPPING_BUCKET_COUNT] =\n{");
+    for (index = 0; index < bucket_count; index++)
+        fprintf(p_fd_header, "%s%u,", ((index % 16) == 0) ? "\n    " : " ", p_seed[index]);
+    fprintf(p_fd_header, "\n};\n\n");
+
+    fprintf(p_fd_header, "static const struct fwid_mapping_image_entry g_default_fwid_mapping_slot[DEFAULT_FWID_MAPPING_SLOT_COUNT] =\n{\n");
+    for (index = 0; index < slot_count; index++)
+    {
+        fprintf(p_fd_header, "    {0x%08X, 0x%04X, 0x%04X},\n", p_slot[index].panel_key, p_slot[index].chrome_fwid, p_slot[index].windows_fwid);
+    }
+    fprintf(p_fd_header, "};\n\n");
+    fprintf(p_fd_header, "#endif //_ELAN_TS_DEFAULT_FWID_MAPPING_TABLE_H_\n");
+
+    printf("%s: %zu entries, %zu buckets, %zu slots.\n", argv[2], entry_count, bucket_count, slot_count);
+
+EXIT:
+    if (p_fd_header != NULL)
+        fclose(p_fd_header);
+    free(p_entry);
+    free(p_seed);
+    free(p_slot);
+
+    return (err == TP_SUCCESS) ? 0 : 1;
+}